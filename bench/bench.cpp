@@ -0,0 +1,317 @@
+// lug - Embedded DSL for PE grammar parser combinators in C++
+// Copyright (c) 2017 Jesse W. Towner
+// See LICENSE.md file for license details
+
+#include <lug/lug.hpp>
+#include <lug/native.hpp>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <new>
+#include <sstream>
+
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+static std::size_t allocations = 0;
+
+void* operator new(std::size_t n)
+{
+	++allocations;
+	if (void* p = std::malloc(n ? n : 1))
+		return p;
+	throw std::bad_alloc{};
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+namespace bench {
+
+using clock = std::chrono::steady_clock;
+
+struct corpus
+{
+	char const* name;
+	std::function<lug::grammar()> compile;
+	std::string text;
+	bool streamed;
+};
+
+class generator
+{
+	std::uint32_t state_{0x9e3779b9u};
+public:
+	std::uint32_t operator()(std::uint32_t n) { state_ = state_ * 1664525u + 1013904223u; return (state_ >> 8) % n; }
+};
+
+template <class Func>
+double seconds(Func&& f)
+{
+	auto const start = clock::now();
+	f();
+	return std::chrono::duration<double>(clock::now() - start).count();
+}
+
+template <class Func>
+double best_of(int runs, Func&& f)
+{
+	double best = seconds(f);
+	while (--runs > 0)
+		best = (std::min)(best, seconds(f));
+	return best;
+}
+
+lug::grammar json_grammar()
+{
+	using namespace lug::language;
+	rule JSON;
+	rule ExponentPart   = lexeme[ "[Ee]"_rx > ~"[+-]"_rx > +"[0-9]"_rx ];
+	rule FractionalPart = lexeme[ "."_sx > +"[0-9]"_rx ];
+	rule IntegralPart   = lexeme[ "0"_sx | "[1-9]"_rx > *"[0-9]"_rx ];
+	rule Number         = lexeme[ ~"-"_sx > IntegralPart > ~FractionalPart > ~ExponentPart ];
+	rule Boolean        = lexeme[ "true"_sx | "false" ];
+	rule Null           = lexeme[ "null" ];
+	rule UnicodeEscape  = lexeme[ chr('u') > "[0-9A-Fa-f][0-9A-Fa-f][0-9A-Fa-f][0-9A-Fa-f]"_rx ];
+	rule Escape         = lexeme[ "\\" > ("[/\\bfnrt]"_rx | UnicodeEscape) ];
+	rule String         = lexeme[ "\"" > *(u8"[^\"\\\u0000-\u001F]"_rx | Escape) > "\"" ];
+	rule Array          = "[" > JSON > *("," > JSON) > "]";
+	rule Object         = "{" > String > ":" > JSON > *("," > String > ":" > JSON) > "}";
+	JSON                = Object | Array | String | Number | Boolean | Null;
+	return start(JSON > eoi);
+}
+
+struct native_json_grammar
+{
+	template <class Environment = lug::environment> using rule = lug::native::rule<Environment>;
+	rule<> JSON, Array, Object, String, Value;
+
+	native_json_grammar()
+	{
+		using namespace lug::native::language;
+		auto const ws = *space;
+		auto const Number = ~chr('-') > (chr('0') | chr('1', '9') > *digit) > ~(chr('.') > +digit) > ~((chr('E') | chr('e')) > ~(chr('+') | chr('-')) > +digit);
+		auto const Escape = chr('\\') > (chr('/') | chr('\\') | chr('b') | chr('f') | chr('n') | chr('r') | chr('t') | chr('u') > xdigit > xdigit > xdigit > xdigit);
+		String = chr('"') > *(chr(0x20, 0x21) | chr(0x23, 0x5B) | chr(0x5D, 0x10FFFF) | Escape) > chr('"');
+		Array  = chr('[') > JSON > *(ws > chr(',') > JSON) > ws > chr(']');
+		Object = chr('{') > ws > String > ws > chr(':') > JSON > *(ws > chr(',') > ws > String > ws > chr(':') > JSON) > ws > chr('}');
+		Value  = Object | Array | String | Number | str("true") | str("false") | str("null");
+		JSON   = ws > Value;
+	}
+};
+
+double native_json_mbps(std::string const& text, int runs)
+{
+	native_json_grammar const grammar;
+	auto const parse = [&grammar, &text] {
+		if (!lug::native::parse(grammar.JSON > *lug::native::language::space > lug::native::language::eoi, text))
+			throw std::runtime_error{"failed to parse corpus json-native"};
+	};
+	parse();
+	return static_cast<double>(text.size()) / best_of(runs, parse) / 1e6;
+}
+
+lug::grammar calc_grammar()
+{
+	using namespace lug::language;
+	rule Expr;
+	rule Number = lexeme[ +"[0-9]"_rx ];
+	rule Value  = Number | "(" > Expr > ")";
+	Expr        = Expr[1] > "+" > Expr[2] | Expr[1] > "-" > Expr[2]
+	            | Expr[2] > "*" > Expr[3] | Expr[2] > "/" > Expr[3]
+	            | Value;
+	rule Line   = noskip[ Expr > *"[ \t]"_rx > eol ];
+	return start(*Line > eoi);
+}
+
+lug::grammar keyword_grammar()
+{
+	using namespace lug::language;
+	rule Keyword    = lexeme[ ("select"_isx | "from"_isx | "where"_isx | "group"_isx | "order"_isx | "by"_isx | "having"_isx
+	                | "insert"_isx | "into"_isx | "values"_isx | "update"_isx | "delete"_isx | "join"_isx | "inner"_isx
+	                | "outer"_isx | "left"_isx | "right"_isx | "on"_isx | "and"_isx | "or"_isx | "not"_isx) > !alnum ];
+	rule Identifier = lexeme[ alpha > *alnum ];
+	return start(*(Keyword | Identifier | +punct | +digit) > eoi);
+}
+
+lug::grammar whitespace_grammar()
+{
+	using namespace lug::language;
+	rule Word = lexeme[ +alnum ];
+	return start(*(Word | punct) > eoi);
+}
+
+std::string json_corpus(std::size_t size)
+{
+	std::ifstream file{"samples/sample.json"};
+	std::string const sample{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+	if (sample.empty())
+		throw std::runtime_error{"unable to read samples/sample.json"};
+	std::string text = "[";
+	while (text.size() < size)
+		text.append(text.size() > 1 ? ",\n" : "").append(sample);
+	return text.append("]");
+}
+
+std::string calc_corpus(std::size_t size)
+{
+	static char const operators[] = "+-*/";
+	generator random;
+	std::string text;
+	while (text.size() < size) {
+		int depth = 0;
+		text.append(std::to_string(random(1000)));
+		for (int i = 0; i < 48; ++i) {
+			text.append(1, ' ').append(1, operators[random(4)]).append(1, ' ');
+			if (random(5) == 0)
+				text.append(1, '('), ++depth;
+			text.append(std::to_string(random(1000)));
+			if (depth > 0 && random(3) == 0)
+				text.append(1, ')'), --depth;
+		}
+		text.append(static_cast<std::size_t>(depth), ')').append(1, '\n');
+	}
+	return text;
+}
+
+std::string keyword_corpus(std::size_t size)
+{
+	static char const* const words[] = { "SELECT", "select", "SeLeCt", "FROM", "from", "Where", "GROUP", "by", "ORDER",
+		"Having", "inner", "JOIN", "outer", "on", "and", "OR", "not", "selection", "fromage", "wherever", "column_a",
+		"t1", "orders", "byline", "x42", "insert", "INTO", "values", "Update", "delete" };
+	static char const* const separators[] = { " ", " ", "\n", ", ", " - ", "; ", " (", ") " };
+	generator random;
+	std::string text;
+	while (text.size() < size)
+		text.append(words[random(std::size(words))]).append(separators[random(std::size(separators))]);
+	return text.append("end");
+}
+
+std::string whitespace_corpus(std::size_t size)
+{
+	static char const blanks[] = " \t\n\r";
+	generator random;
+	std::string text;
+	while (text.size() < size) {
+		text.append(1, static_cast<char>('a' + random(26)));
+		for (auto n = random(40); n > 0; --n)
+			text.append(1, blanks[random(random(8) == 0 ? 4 : 1)]);
+		if (random(10) == 0)
+			text.append(1, ';');
+	}
+	return text.append(1, '.');
+}
+
+struct measurement
+{
+	double compile_ms, mbps, allocs_per_parse;
+	std::size_t instructions, max_frames, max_responses, hottest_calls, hottest_backtracks;
+};
+
+measurement measure(corpus const& c, int runs)
+{
+	measurement m{};
+	lug::grammar grammar;
+	m.compile_ms = best_of(runs, [&c, &grammar] { grammar = c.compile(); }) * 1e3;
+	lug::environment environment;
+	lug::parser parser{grammar, environment};
+	auto run = [&c, &parser] {
+		bool parsed;
+		if (c.streamed) {
+			std::istringstream input{c.text};
+			parsed = parser.reset().push_source(lug::istream_source{input}).parse();
+		} else {
+			parsed = parser.reset().bind(c.text).parse();
+		}
+		if (!parsed)
+			throw std::runtime_error{std::string{"failed to parse corpus "} + c.name};
+	};
+	run();
+	m.instructions = parser.instruction_count();
+	auto const& profile = parser.profile();
+	m.max_frames = profile.max_stack_frames, m.max_responses = profile.max_responses;
+	for (auto const& r : profile.rules)
+		if (r.calls > m.hottest_calls)
+			m.hottest_calls = r.calls, m.hottest_backtracks = r.backtracks;
+	auto const before = allocations;
+	m.mbps = static_cast<double>(c.text.size()) / best_of(runs, run) / 1e6;
+	m.allocs_per_parse = static_cast<double>(allocations - before) / runs;
+	return m;
+}
+
+double unicode_queries_per_second()
+{
+	std::size_t hits = 0;
+	auto const elapsed = best_of(3, [&hits] {
+		for (char32_t r = 0; r < 0x30000; ++r)
+			hits += static_cast<std::size_t>(lug::unicode::query(r).any_of(lug::unicode::ctype::alpha));
+	});
+	if (hits == 0)
+		throw std::runtime_error{"unicode query benchmark produced no matches"};
+	return 0x30000 / elapsed / 1e6;
+}
+
+double large_grammar_compile_ms(std::size_t count, int runs)
+{
+	using namespace lug::language;
+	std::vector<std::string> keywords(count), classes(count);
+	for (std::size_t i = 0; i < count; ++i) {
+		keywords[i] = "k" + std::to_string(i);
+		classes[i] = std::string{"["} + static_cast<char>('a' + i % 26) + "-z" + std::to_string(i % 10) + "]";
+	}
+	return best_of(runs, [count, &keywords, &classes] {
+		std::vector<rule> rules(count);
+		for (std::size_t i = count; i-- > 0; ) {
+			auto& a = rules[(i * 2 + 1) % count];
+			auto& b = rules[(i * 2 + 2) % count];
+			auto& c = rules[(i * 7 + 3) % count];
+			if (i % 3 == 0)
+				rules[i] = a > "+" > b | b > "-" | str(keywords[i]) > ~c;
+			else
+				rules[i] = lexeme[ str(keywords[i]) > +bre(classes[i]) ] > ~(a | "(" > b > ")") | "#" > c;
+		}
+		lug::grammar const grammar = start(rules[0] > eoi);
+		if (grammar.program().instructions.empty())
+			throw std::runtime_error{"large grammar compiled to an empty program"};
+	}) * 1e3;
+}
+
+} // namespace bench
+
+int main(int argc, char** argv)
+{
+	try {
+		std::size_t const size = argc > 1 ? static_cast<std::size_t>(std::strtoul(argv[1], nullptr, 10)) << 10 : std::size_t{4} << 20;
+		bench::corpus const corpora[] = {
+			{ "json", bench::json_grammar, bench::json_corpus(size), false },
+			{ "json-istream", bench::json_grammar, bench::json_corpus(size), true },
+			{ "calc-leftrec", bench::calc_grammar, bench::calc_corpus(size / 8), false },
+			{ "keywords", bench::keyword_grammar, bench::keyword_corpus(size), false },
+			{ "whitespace", bench::whitespace_grammar, bench::whitespace_corpus(size), false }
+		};
+#ifdef LUG_COUNT_INSTRUCTIONS
+		std::printf("%-14s %10s %14s %12s %12s %12s %14s\n", "corpus", "bytes", "instructions", "instr/byte", "peak frames", "peak resp", "hot rule b/c");
+		for (auto const& c : corpora) {
+			auto const m = bench::measure(c, 1);
+			std::printf("%-14s %10zu %14zu %12.2f %12zu %12zu %7zu/%-7zu\n", c.name, c.text.size(), m.instructions, static_cast<double>(m.instructions) / static_cast<double>(c.text.size()),
+				m.max_frames, m.max_responses, m.hottest_backtracks, m.hottest_calls);
+		}
+#else
+		int const runs = argc > 2 ? std::atoi(argv[2]) : 5;
+		std::printf("%-14s %10s %10s %12s %12s\n", "corpus", "bytes", "MB/s", "allocs/parse", "compile ms");
+		for (auto const& c : corpora) {
+			auto const m = bench::measure(c, (std::max)(runs, 1));
+			std::printf("%-14s %10zu %10.2f %12.1f %12.3f\n", c.name, c.text.size(), m.mbps, m.allocs_per_parse, m.compile_ms);
+		}
+		std::printf("%-14s %10zu %10.2f\n", "json-native", corpora[0].text.size(), bench::native_json_mbps(corpora[0].text, (std::max)(runs, 1)));
+		std::printf("%-14s %10s %10.1f M queries/s\n", "unicode-query", "-", bench::unicode_queries_per_second());
+		std::printf("%-14s %10d %10.1f compile ms\n", "large-grammar", 2000, bench::large_grammar_compile_ms(2000, (std::max)(runs, 1)));
+#endif
+	} catch (std::exception& e) {
+		std::cerr << "Error: " << e.what() << std::endl;
+		return -1;
+	}
+	return 0;
+}
@@ -0,0 +1,133 @@
+// lug - Embedded DSL for PE grammar parser combinators in C++
+// Copyright (c) 2017 Jesse W. Towner
+// See LICENSE.md file for license details
+
+#ifndef LUG_BATCH_HPP__
+#define LUG_BATCH_HPP__
+
+#include <lug/lug.hpp>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+namespace lug
+{
+
+inline std::vector<std::string_view> split_records(std::string_view text, char delimiter = '\n')
+{
+	std::vector<std::string_view> records;
+	while (!text.empty()) {
+		auto const n = (std::min)(text.find(delimiter), text.size());
+		records.push_back(text.substr(0, n));
+		text.remove_prefix((std::min)(n + 1, text.size()));
+	}
+	return records;
+}
+
+template <class Environment = environment>
+class batch_parser
+{
+	static_assert(std::is_base_of_v<environment, Environment>, "batch environment must derive from lug::environment");
+
+	struct worker
+	{
+		Environment envr;
+		lug::parser parser;
+		explicit worker(grammar const& grmr) : envr{}, parser{grmr, envr} {}
+	};
+
+	std::vector<std::unique_ptr<worker>> workers_;
+
+	template <class T>
+	static std::string_view view_of(T const& input)
+	{
+		if constexpr (std::is_convertible_v<T const&, std::string_view>)
+			return input;
+		else
+			return input.view();
+	}
+
+public:
+	explicit batch_parser(grammar const& grmr, std::size_t concurrency = 0)
+	{
+		if (concurrency == 0)
+			concurrency = (std::max)(std::thread::hardware_concurrency(), 1u);
+		workers_.reserve(concurrency);
+		while (workers_.size() < concurrency)
+			workers_.push_back(std::make_unique<worker>(grmr));
+	}
+
+	std::size_t concurrency() const noexcept { return workers_.size(); }
+
+	template <class Range, class Func>
+	auto parse(Range const& inputs, Func&& collect)
+	{
+		using result_type = std::decay_t<std::invoke_result_t<Func&, Environment&, lug::parser const&, bool>>;
+		auto const first = std::begin(inputs);
+		std::size_t const count = static_cast<std::size_t>(std::distance(first, std::end(inputs)));
+		std::vector<std::optional<result_type>> slots(count);
+		std::atomic<std::size_t> next{0};
+		std::exception_ptr error;
+		std::mutex error_mutex;
+		auto run = [&](worker& w) {
+			try {
+				for (std::size_t i; (i = next.fetch_add(1, std::memory_order_relaxed)) < count; ) {
+					bool const parsed = w.parser.reset().bind(view_of(first[static_cast<std::ptrdiff_t>(i)])).parse();
+					slots[i].emplace(std::invoke(collect, w.envr, std::as_const(w.parser), parsed));
+				}
+			} catch (...) {
+				next.store(count, std::memory_order_relaxed);
+				std::lock_guard<std::mutex> lock{error_mutex};
+				if (!error)
+					error = std::current_exception();
+			}
+		};
+		std::vector<std::thread> threads;
+		auto const n = (std::min)(workers_.size(), count);
+		threads.reserve(n);
+		try {
+			for (std::size_t t = 1; t < n; ++t)
+				threads.emplace_back(run, std::ref(*workers_[t]));
+		} catch (...) {
+			next.store(count, std::memory_order_relaxed);
+			for (auto& t : threads)
+				t.join();
+			throw;
+		}
+		if (n > 0)
+			run(*workers_[0]);
+		for (auto& t : threads)
+			t.join();
+		if (error)
+			std::rethrow_exception(error);
+		std::vector<result_type> results;
+		results.reserve(count);
+		for (auto& s : slots)
+			results.push_back(std::move(*s));
+		return results;
+	}
+
+	template <class Range>
+	std::vector<bool> parse(Range const& inputs)
+	{
+		return parse(inputs, [](Environment&, lug::parser const&, bool parsed) { return parsed; });
+	}
+};
+
+template <class Environment = environment, class Range, class Func, class = std::enable_if_t<std::is_invocable_v<Func&, Environment&, lug::parser const&, bool>>>
+inline auto parse_batch(Range const& inputs, grammar const& grmr, Func&& collect, std::size_t concurrency = 0)
+{
+	return batch_parser<Environment>{grmr, concurrency}.parse(inputs, ::std::forward<Func>(collect));
+}
+
+template <class Environment = environment, class Range>
+inline std::vector<bool> parse_batch(Range const& inputs, grammar const& grmr, std::size_t concurrency = 0)
+{
+	return batch_parser<Environment>{grmr, concurrency}.parse(inputs);
+}
+
+} // namespace lug
+
+#endif
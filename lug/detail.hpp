@@ -6,12 +6,16 @@
 #define LUG_DETAIL_HPP__
 
 #include <algorithm>
+#include <any>
 #include <functional>
 #include <iterator>
 #include <limits>
+#include <memory>
+#include <new>
 #include <string>
 #include <string_view>
 #include <type_traits>
+#include <vector>
 
 #ifdef __GNUC__
 
@@ -21,16 +25,39 @@ _Pragma("GCC diagnostic ignored \"-Wparentheses\"") \
 _Pragma("GCC diagnostic ignored \"-Wlogical-not-parentheses\"")
 _Pragma("GCC diagnostic ignored \"-Wunused-but-set-variable\"")
 
+#define LUG_DIAGNOSTIC_PUSH_AND_IGNORE_PEDANTIC \
+_Pragma("GCC diagnostic push") \
+_Pragma("GCC diagnostic ignored \"-Wpedantic\"")
+
 #define LUG_DIAGNOSTIC_POP \
 _Pragma("GCC diagnostic pop")
 
+#ifndef LUG_NO_THREADED_DISPATCH
+#define LUG_THREADED_DISPATCH
+#endif
+
 #else
 
 #define LUG_DIAGNOSTIC_PUSH_AND_IGNORE
+#define LUG_DIAGNOSTIC_PUSH_AND_IGNORE_PEDANTIC
 #define LUG_DIAGNOSTIC_POP
 
 #endif
 
+#ifndef LUG_NO_SIMD
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define LUG_SSE2
+#include <emmintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define LUG_NEON
+#include <arm_neon.h>
+#endif
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
 namespace lug
 {
 
@@ -87,6 +114,9 @@ namespace detail
 template <class... Args>
 constexpr void ignore(Args&&...) noexcept {}
 
+template <class T, class = void> struct is_chunked_source : std::false_type {};
+template <class T> struct is_chunked_source<T, std::void_t<decltype(std::declval<T const&>().chunked())>> : std::true_type {};
+
 template <class T> struct member_pointer_object {};
 template <class T, class U> struct member_pointer_object<T U::*> { typedef U type; };
 template <class T> struct member_pointer_value {};
@@ -198,6 +228,20 @@ inline InputIt escaping_find_if(InputIt first, InputIt last, UnaryPredicate p)
 	return last;
 }
 
+constexpr std::size_t hash_combine(std::size_t seed, std::size_t h) noexcept
+{
+	return seed ^ (h + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2));
+}
+
+struct pair_hash
+{
+	template <class T, class U>
+	std::size_t operator()(std::pair<T, U> const& p) const noexcept
+	{
+		return hash_combine(std::hash<T>{}(p.first), std::hash<U>{}(p.second));
+	}
+};
+
 template <class Sequence, class T>
 inline std::size_t push_back_unique(Sequence& s, T&& x)
 {
@@ -207,6 +251,20 @@ inline std::size_t push_back_unique(Sequence& s, T&& x)
 	return s.size() - 1;
 }
 
+template <class Sequence, class Index, class T, class Hash>
+inline std::size_t push_back_unique(Sequence& s, Index& index, T&& x, Hash const& hash)
+{
+	for (auto n = index.size(); n < s.size(); ++n)
+		index.emplace(hash(s[n]), n);
+	auto const h = hash(x);
+	for (auto [i, e] = index.equal_range(h); i != e; ++i)
+		if (s[i->second] == x)
+			return i->second;
+	index.emplace(h, s.size());
+	s.push_back(::std::forward<T>(x));
+	return s.size() - 1;
+}
+
 template <class Sequence>
 inline auto pop_back(Sequence& s)
 {
@@ -215,6 +273,87 @@ inline auto pop_back(Sequence& s)
 	return result;
 }
 
+class attribute_stack
+{
+	struct block { std::unique_ptr<unsigned char[]> data; std::size_t size; };
+	struct entry { void* object; void const* type; void (*destroy)(void*) noexcept; std::size_t block, offset; };
+	template <class T> struct type_key { static constexpr char id = 0; };
+	static constexpr std::size_t block_size = 16384;
+	std::vector<block> blocks_;
+	std::vector<entry> entries_;
+	std::size_t block_ = 0, offset_ = 0;
+
+	template <class T>
+	static void destroy(void* p) noexcept
+	{
+		static_cast<T*>(p)->~T();
+	}
+
+	void* allocate(std::size_t size, std::size_t alignment)
+	{
+		for (;;) {
+			for ( ; block_ < blocks_.size(); ++block_, offset_ = 0) {
+				void* p = blocks_[block_].data.get() + offset_;
+				std::size_t space = blocks_[block_].size - offset_;
+				if (::std::align(alignment, size, p, space)) {
+					offset_ = blocks_[block_].size - space + size;
+					return p;
+				}
+			}
+			std::size_t const n = (::std::max)(block_size, size + alignment);
+			blocks_.push_back(block{::std::make_unique<unsigned char[]>(n), n});
+			block_ = blocks_.size() - 1, offset_ = 0;
+		}
+	}
+
+public:
+	attribute_stack() = default;
+	attribute_stack(attribute_stack const&) : attribute_stack{} {}
+	attribute_stack(attribute_stack&&) = default;
+	attribute_stack& operator=(attribute_stack const&) { clear(); return *this; }
+	attribute_stack& operator=(attribute_stack&& x) { clear(); blocks_ = ::std::move(x.blocks_); entries_ = ::std::move(x.entries_); block_ = x.block_, offset_ = x.offset_; x.block_ = x.offset_ = 0; return *this; }
+	~attribute_stack() { clear(); }
+	bool empty() const noexcept { return entries_.empty(); }
+	std::size_t size() const noexcept { return entries_.size(); }
+
+	void clear() noexcept
+	{
+		for (auto i = entries_.crbegin(), e = entries_.crend(); i != e; ++i)
+			if (i->destroy)
+				i->destroy(i->object);
+		entries_.clear();
+		block_ = offset_ = 0;
+	}
+
+	template <class T, class... Args>
+	void push(Args&&... args)
+	{
+		static_assert(::std::is_object_v<T> && !::std::is_const_v<T>, "attributes must be non-const object types");
+		auto& e = entries_.emplace_back(entry{nullptr, &type_key<T>::id, ::std::is_trivially_destructible_v<T> ? nullptr : &destroy<T>, block_, offset_});
+		try {
+			e.object = ::new (allocate(sizeof(T), alignof(T))) T(::std::forward<Args>(args)...);
+		} catch (...) {
+			block_ = e.block, offset_ = e.offset;
+			entries_.pop_back();
+			throw;
+		}
+	}
+
+	template <class T>
+	T pop()
+	{
+		if (entries_.empty() || entries_.back().type != &type_key<T>::id)
+			throw ::std::bad_any_cast{};
+		entry const e = entries_.back();
+		T* object = static_cast<T*>(e.object);
+		T result{::std::move(*object)};
+		object->~T();
+		entries_.pop_back();
+		block_ = e.block, offset_ = e.offset;
+		return result;
+	}
+};
+
 template <class Integral>
 inline std::string string_pack(Integral n)
 {
@@ -227,6 +366,17 @@ inline Integral string_unpack(std::string_view s)
 	return *reinterpret_cast<Integral const*>(s.data());
 }
 
+inline unsigned int count_trailing_zeros(unsigned int x) noexcept
+{
+#ifdef _MSC_VER
+	unsigned long index;
+	_BitScanForward(&index, x);
+	return static_cast<unsigned int>(index);
+#else
+	return static_cast<unsigned int>(__builtin_ctz(x));
+#endif
+}
+
 } // namespace detail
 
 } // namespace lug
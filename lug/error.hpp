@@ -13,6 +13,7 @@ namespace lug
 class lug_error : public std::runtime_error { using std::runtime_error::runtime_error; };
 class program_limit_error : public lug_error { public: program_limit_error() : lug_error{"length or offset of program exceeds internal limit"} {} };
 class resource_limit_error : public lug_error { public: resource_limit_error() : lug_error{"number of resources exceeds internal limit"} {} };
+class input_limit_error : public lug_error { public: input_limit_error() : lug_error{"retained input exceeds the parser input limit"} {} };
 class reenterant_parse_error : public lug_error { public: reenterant_parse_error() : lug_error{"parsing is non-reenterant"} {} };
 class reenterant_read_error : public lug_error { public: reenterant_read_error() : lug_error{"attempted to read or modify input source while reading"} {} };
 class reenterant_accept_error : public lug_error { public: reenterant_accept_error() : lug_error{"accepting parse input is non-reenterant" } {} };
@@ -20,8 +21,11 @@ class accept_context_error : public lug_error{ public: accept_context_error() :
 class bad_string_expression : public lug_error { public: bad_string_expression(const char* s = "invalid string or bracket expression") : lug_error{s} {} };
 class bad_character_class : public bad_string_expression { public: bad_character_class() : bad_string_expression{"invalid character class"} {} };
 class bad_character_range : public bad_string_expression { public: bad_character_range() : bad_string_expression{"character range is reversed"} {} };
+class bad_octet_range : public bad_string_expression { public: bad_octet_range() : bad_string_expression{"character is outside of the octet range"} {} };
+class bad_field_width : public lug_error { public: bad_field_width() : lug_error{"octet field width must be between 1 and 8"} {} };
 class bad_grammar : public lug_error { public: bad_grammar() : lug_error{"invalid or empty grammar"} {} };
 class bad_opcode : public lug_error { public: bad_opcode() : lug_error{"invalid opcode"} {} };
+class bad_grammar_image : public lug_error { public: bad_grammar_image(const char* s = "invalid grammar image") : lug_error{s} {} };
 
 } // namespace lug
 
@@ -0,0 +1,259 @@
+// lug - Embedded DSL for PE grammar parser combinators in C++
+// Copyright (c) 2017 Jesse W. Towner
+// See LICENSE.md file for license details
+
+#ifndef LUG_IMAGE_HPP__
+#define LUG_IMAGE_HPP__
+
+#include <lug/lug.hpp>
+#include <cstdint>
+
+namespace lug
+{
+
+struct grammar_bindings
+{
+	std::vector<semantic_predicate> predicates;
+	std::vector<semantic_action> actions;
+	std::vector<syntactic_capture> captures;
+};
+
+namespace detail
+{
+
+constexpr char image_magic[4] = {'l', 'u', 'g', 'i'};
+constexpr std::uint32_t image_version = 2;
+constexpr std::size_t image_header_size = 16;
+
+inline std::uint64_t image_fnv1a(std::string_view bytes) noexcept
+{
+	std::uint64_t h = UINT64_C(0xcbf29ce484222325);
+	for (char c : bytes)
+		h = (h ^ static_cast<unsigned char>(c)) * UINT64_C(0x100000001b3);
+	return h;
+}
+
+class image_writer
+{
+	std::string out_;
+public:
+	void bytes(void const* p, std::size_t n) { out_.append(static_cast<char const*>(p), n); }
+	void octet(unsigned int x) { out_.push_back(static_cast<char>(x & 0xff)); }
+	void fixed(std::uint64_t x, std::size_t n) { for (std::size_t i = 0; i < n; ++i, x >>= 8) octet(static_cast<unsigned int>(x)); }
+	void varint(std::uint64_t x) { for ( ; x >= 0x80; x >>= 7) octet(static_cast<unsigned int>(x) | 0x80); octet(static_cast<unsigned int>(x)); }
+	void svarint(std::int64_t x) { varint((static_cast<std::uint64_t>(x) << 1) ^ static_cast<std::uint64_t>(x >> 63)); }
+	void string(std::string_view s) { varint(s.size()); bytes(s.data(), s.size()); }
+	std::string release() { return std::move(out_); }
+};
+
+class image_reader
+{
+	std::string_view in_;
+	std::size_t pos_{0};
+	void require(std::size_t n) const { if (in_.size() - pos_ < n) throw bad_grammar_image{"truncated grammar image"}; }
+public:
+	explicit image_reader(std::string_view in) noexcept : in_{in} {}
+	bool done() const noexcept { return pos_ == in_.size(); }
+	std::string_view bytes(std::size_t n) { require(n); auto const s = in_.substr(pos_, n); pos_ += n; return s; }
+	unsigned int octet() { require(1); return static_cast<unsigned char>(in_[pos_++]); }
+	std::uint64_t fixed(std::size_t n) { std::uint64_t x = 0; for (std::size_t i = 0; i < n; ++i) x |= std::uint64_t{octet()} << (i * 8); return x; }
+
+	std::uint64_t varint()
+	{
+		std::uint64_t x = 0;
+		for (unsigned int shift = 0; shift < 64; shift += 7) {
+			auto const b = octet();
+			x |= std::uint64_t{b & 0x7f} << shift;
+			if ((b & 0x80) == 0)
+				return x;
+		}
+		throw bad_grammar_image{"malformed integer in grammar image"};
+	}
+
+	std::int64_t svarint() { auto const x = varint(); return static_cast<std::int64_t>(x >> 1) ^ -static_cast<std::int64_t>(x & 1); }
+	std::string_view string() { return bytes(count(1)); }
+
+	std::size_t count(std::size_t element_size)
+	{
+		auto const n = varint();
+		if (n > (in_.size() - pos_) / (std::max)(element_size, std::size_t{1}))
+			throw bad_grammar_image{"truncated grammar image"};
+		return static_cast<std::size_t>(n);
+	}
+
+	template <class T>
+	T value(std::uint64_t max)
+	{
+		auto const x = varint();
+		if (x > max)
+			throw bad_grammar_image{"value out of range in grammar image"};
+		return static_cast<T>(x);
+	}
+};
+
+} // namespace detail
+
+inline std::string save_grammar(grammar const& grmr)
+{
+	auto const& p = grmr.program();
+	auto const& r = grmr.optimizer_report();
+	detail::image_writer payload;
+	payload.varint(static_cast<unsigned int>(p.mandate));
+	payload.varint(p.instructions.size());
+	for (auto i = p.instructions.begin(), e = p.instructions.end(); i != e; ) {
+		auto const pf = i->pf;
+		auto const last = std::next(i, instruction::length(pf));
+		payload.octet(static_cast<unsigned int>(pf.op));
+		payload.octet(static_cast<unsigned int>(pf.aux));
+		payload.varint(pf.val);
+		if ((pf.aux & operands::off) != operands::none)
+			payload.svarint((++i)->off);
+		while (++i != last)
+			payload.bytes(i->str.data(), i->str.size());
+	}
+	payload.varint(p.runesets.size());
+	for (auto const& runes : p.runesets) {
+		payload.varint(runes.size());
+		std::int64_t prev = 0;
+		for (auto const& [first, last] : runes)
+			payload.svarint(std::int64_t{first} - prev), payload.varint(last - first), prev = last;
+	}
+	payload.varint(p.octetsets.size());
+	for (auto const& octets : p.octetsets)
+		for (std::size_t i = 0; i < 256; i += 8)
+			payload.octet(static_cast<unsigned int>(((octets >> i) & std::bitset<256>{0xff}).to_ulong()));
+	payload.varint(p.literalsets.size());
+	for (auto const& set : p.literalsets) {
+		payload.octet(set.caseless ? 1 : 0);
+		payload.varint(set.literals.size());
+		for (auto const& l : set.literals)
+			payload.string(l);
+	}
+	payload.varint(p.predicates.size());
+	payload.varint(p.actions.size());
+	payload.varint(p.captures.size());
+	for (auto n : {r.instructions_before, r.instructions_after, r.inlined_calls, r.removed_instructions, r.folded_spans, r.literal_tries, r.dispatched_choices, r.merged_matches})
+		payload.varint(n);
+	auto const body = payload.release();
+	detail::image_writer image;
+	image.bytes(detail::image_magic, sizeof(detail::image_magic));
+	image.fixed(detail::image_version, 2);
+	image.fixed(static_cast<unsigned int>(opcode::jump_table), 2);
+	image.fixed(detail::image_fnv1a(body), 8);
+	image.bytes(body.data(), body.size());
+	return image.release();
+}
+
+inline std::uint64_t grammar_image_hash(std::string_view image)
+{
+	detail::image_reader header{image};
+	if (header.bytes(sizeof(detail::image_magic)) != std::string_view{detail::image_magic, sizeof(detail::image_magic)})
+		throw bad_grammar_image{"not a grammar image"};
+	if (header.fixed(2) != detail::image_version || header.fixed(2) != static_cast<unsigned int>(opcode::jump_table))
+		throw bad_grammar_image{"incompatible grammar image version"};
+	return header.fixed(8);
+}
+
+inline grammar load_grammar(std::string_view image, grammar_bindings bindings = {})
+{
+	auto const hash = grammar_image_hash(image);
+	auto const body = image.substr(detail::image_header_size);
+	if (detail::image_fnv1a(body) != hash)
+		throw bad_grammar_image{"grammar image hash mismatch"};
+	constexpr auto maxval = (std::numeric_limits<unsigned short>::max)();
+	detail::image_reader in{body};
+	program p;
+	p.mandate = in.value<directives>((std::numeric_limits<unsigned int>::max)());
+	auto const n = in.count(1);
+	p.instructions.reserve(n);
+	while (p.instructions.size() < n) {
+		auto const op = static_cast<opcode>(in.octet());
+		auto const aux = static_cast<operands>(in.octet());
+		auto const pf = p.instructions.emplace_back(op, aux, static_cast<immediate>(in.value<unsigned short>(maxval))).pf;
+		auto const length = instruction::length(pf);
+		if ((pf.aux & operands::off) != operands::none)
+			p.instructions.emplace_back(static_cast<std::ptrdiff_t>(in.svarint()));
+		for (auto k = std::ptrdiff_t{(pf.aux & operands::off) != operands::none ? 2 : 1}; k < length; ++k)
+			p.instructions.emplace_back(in.bytes(4));
+		if (p.instructions.size() > n)
+			throw bad_grammar_image{"truncated instruction in grammar image"};
+	}
+	p.runesets.resize(in.count(1));
+	for (auto& runes : p.runesets) {
+		runes.resize(in.count(2));
+		std::int64_t prev = 0;
+		for (auto& [first, last] : runes) {
+			auto const start = prev + in.svarint();
+			if (start < 0 || start > std::int64_t{(std::numeric_limits<char32_t>::max)()})
+				throw bad_grammar_image{"value out of range in grammar image"};
+			first = static_cast<char32_t>(start);
+			last = first + in.value<char32_t>((std::numeric_limits<char32_t>::max)() - first);
+			prev = last;
+		}
+	}
+	p.octetsets.resize(in.count(32));
+	for (auto& octets : p.octetsets)
+		for (std::size_t i = 0; i < 256; i += 8)
+			octets |= std::bitset<256>{in.octet()} << i;
+	p.literalsets.resize(in.count(2));
+	for (auto& set : p.literalsets) {
+		set.caseless = in.octet() != 0;
+		set.literals.resize(in.count(1));
+		for (auto& l : set.literals)
+			l = in.string();
+	}
+	if (in.value<std::size_t>(maxval) != bindings.predicates.size() || in.value<std::size_t>(maxval) != bindings.actions.size() ||
+			in.value<std::size_t>(maxval) != bindings.captures.size())
+		throw bad_grammar_image{"grammar bindings do not match grammar image"};
+	std::vector<bool> starts(p.instructions.size(), false);
+	std::vector<std::ptrdiff_t> targets;
+	auto last_op = opcode::fail;
+	for (std::ptrdiff_t pc = 0, m = static_cast<std::ptrdiff_t>(p.instructions.size()); pc < m; ) {
+		starts[static_cast<std::size_t>(pc)] = true;
+		auto const offset = (p.instructions[pc].pf.aux & operands::off) != operands::none;
+		auto [op, imm, off, str] = instruction::decode(p.instructions, pc);
+		if (op >= opcode::jump_table)
+			throw bad_grammar_image{"invalid opcode in grammar image"};
+		if (offset)
+			targets.push_back(pc + off);
+		last_op = op;
+	}
+	switch (last_op) {
+		case opcode::commit: case opcode::commit_back: case opcode::commit_partial:
+		case opcode::jump: case opcode::ret: case opcode::fail: case opcode::accept_final: break;
+		default: throw bad_grammar_image{"grammar image program falls through its end"};
+	}
+	for (auto target : targets)
+		if (target < 0 || target >= static_cast<std::ptrdiff_t>(starts.size()) || !starts[static_cast<std::size_t>(target)])
+			throw bad_grammar_image{"branch target out of range in grammar image"};
+	for (auto i = p.instructions.begin(), e = p.instructions.end(); i != e; i = std::next(i, instruction::length(i->pf))) {
+		std::size_t limit;
+		switch (i->pf.op) {
+			case opcode::match_set:
+			case opcode::span_set: limit = p.runesets.size(); break;
+			case opcode::test_set:
+			case opcode::match_octet:
+			case opcode::span_octet: limit = p.octetsets.size(); break;
+			case opcode::match_trie: limit = p.literalsets.size(); break;
+			case opcode::predicate: limit = bindings.predicates.size(); break;
+			case opcode::action: limit = bindings.actions.size(); break;
+			case opcode::end: limit = bindings.captures.size(); break;
+			default: continue;
+		}
+		if (i->pf.val >= limit)
+			throw bad_grammar_image{"resource index out of range in grammar image"};
+	}
+	p.predicates = std::move(bindings.predicates);
+	p.actions = std::move(bindings.actions);
+	p.captures = std::move(bindings.captures);
+	optimizer_report r;
+	for (auto n : {&r.instructions_before, &r.instructions_after, &r.inlined_calls, &r.removed_instructions, &r.folded_spans, &r.literal_tries, &r.dispatched_choices, &r.merged_matches})
+		*n = in.value<std::size_t>((std::numeric_limits<std::size_t>::max)());
+	if (!in.done())
+		throw bad_grammar_image{"trailing data in grammar image"};
+	return grammar{std::move(p), r, {}};
+}
+
+} // namespace lug
+
+#endif
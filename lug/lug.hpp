@@ -7,8 +7,12 @@
 
 #include <lug/error.hpp>
 #include <lug/utf8.hpp>
-#include <any>
+#include <array>
+#include <bitset>
+#include <deque>
 #include <iostream>
+#include <map>
+#include <mutex>
 #include <numeric>
 #include <unordered_map>
 #include <unordered_set>
@@ -18,6 +22,7 @@ namespace lug
 {
 
 struct program;
+struct grammar_bindings;
 class rule;
 class grammar;
 class encoder;
@@ -52,7 +57,10 @@ enum class opcode : unsigned char
 	choice,         commit,         commit_back,    commit_partial,
 	jump,           call,           ret,            fail,
 	accept,         accept_final,   predicate,      action,
-	begin,          end
+	begin,          end,            call_memo,      test_set,
+	span_any_of,    span_all_of,    span_none_of,   span_set,
+	skip_space,     match_trie,     match_octet,    match_octets,
+	match_field,    span_octet,     jump_table
 };
 
 enum class immediate : unsigned short {};
@@ -99,13 +107,51 @@ static_assert(sizeof(unicode::sctype) <= sizeof(immediate), "immediate must be l
 static_assert(sizeof(instruction) == sizeof(int), "expected instruction to be same size as int");
 static_assert(sizeof(int) <= sizeof(std::ptrdiff_t), "expected int to be no larger than ptrdiff_t");
 
-enum class directives : unsigned int { none = 0, caseless = 1, eps = 2, lexeme = 4, noskip = 8, preskip = 16, postskip = 32, is_bitfield_enum };
+enum class source_options : unsigned int { none = 0, interactive = 1, is_bitfield_enum };
+enum class parse_status : unsigned char { needs_input, complete, failed };
+enum class directives : unsigned int { none = 0, caseless = 1, eps = 2, lexeme = 4, noskip = 8, preskip = 16, postskip = 32, memoize = 64, octet = 128, is_bitfield_enum };
 using program_callees = std::vector<std::tuple<lug::rule const*, lug::program const*, std::ptrdiff_t, directives>>;
+using program_entry_points = std::vector<std::pair<std::ptrdiff_t, lug::rule const*>>;
+
+struct literal_set
+{
+	std::vector<std::string> literals;
+	bool caseless{false};
+	friend bool operator==(literal_set const& x, literal_set const& y) { return x.caseless == y.caseless && x.literals == y.literals; }
+};
+
+struct program_set_hash
+{
+	std::size_t operator()(unicode::rune_set const& runes) const noexcept
+	{
+		std::size_t h = runes.size();
+		for (auto const& r : runes)
+			h = detail::hash_combine(h, detail::pair_hash{}(r));
+		return h;
+	}
+
+	std::size_t operator()(std::bitset<256> const& octets) const noexcept { return std::hash<std::bitset<256>>{}(octets); }
+
+	std::size_t operator()(literal_set const& set) const noexcept
+	{
+		std::size_t h = static_cast<std::size_t>(set.caseless);
+		for (auto const& l : set.literals)
+			h = detail::hash_combine(h, std::hash<std::string>{}(l));
+		return h;
+	}
+};
+
+struct program_set_index
+{
+	std::unordered_multimap<std::size_t, std::size_t> runesets, octetsets, literalsets;
+};
 
 struct program
 {
 	std::vector<instruction> instructions;
 	std::vector<unicode::rune_set> runesets;
+	std::vector<std::bitset<256>> octetsets;
+	std::vector<literal_set> literalsets;
 	std::vector<semantic_predicate> predicates;
 	std::vector<semantic_action> actions;
 	std::vector<syntactic_capture> captures;
@@ -113,12 +159,24 @@ struct program
 
 	void concatenate(program const& src)
 	{
+		program_set_index index;
+		concatenate(src, index);
+	}
+
+	void concatenate(program const& src, program_set_index& index)
+	{
+		program_set_hash const hash;
 		instructions.reserve(detail::checked_add<program_limit_error>(instructions.size(), src.instructions.size()));
 		for (auto i = src.instructions.begin(), j = i, e = src.instructions.end(); i != e; i = j) {
 			instruction instr = *i;
 			std::size_t val;
 			switch (instr.pf.op) {
-				case opcode::match_set: val = detail::push_back_unique(runesets, src.runesets[instr.pf.val]); break;
+				case opcode::match_set:
+				case opcode::span_set: val = detail::push_back_unique(runesets, index.runesets, src.runesets[instr.pf.val], hash); break;
+				case opcode::test_set:
+				case opcode::match_octet:
+				case opcode::span_octet: val = detail::push_back_unique(octetsets, index.octetsets, src.octetsets[instr.pf.val], hash); break;
+				case opcode::match_trie: val = detail::push_back_unique(literalsets, index.literalsets, src.literalsets[instr.pf.val], hash); break;
 				case opcode::predicate: val = predicates.size(); predicates.push_back(src.predicates[instr.pf.val]); break;
 				case opcode::action: val = actions.size(); actions.push_back(src.actions[instr.pf.val]); break;
 				case opcode::end: val = captures.size(); captures.push_back(src.captures[instr.pf.val]); break;
@@ -139,6 +197,8 @@ struct program
 	{
 		instructions.swap(p.instructions);
 		runesets.swap(p.runesets);
+		octetsets.swap(p.octetsets);
+		literalsets.swap(p.literalsets);
 		predicates.swap(p.predicates);
 		actions.swap(p.actions);
 		captures.swap(p.captures);
@@ -146,6 +206,389 @@ struct program
 	}
 };
 
+struct octet_table
+{
+	struct entry { int dst; unsigned short first, count; bool mismatch; };
+	std::array<entry, 257> entries;
+	std::vector<int> backtracks;
+};
+
+struct compiled_rune_set
+{
+	std::bitset<256> latin1;
+	unicode::rune_set const* runes{nullptr};
+
+	compiled_rune_set() = default;
+
+	explicit compiled_rune_set(unicode::rune_set const& r) : runes{&r}
+	{
+		for (auto const& [first, last] : r)
+			for (auto rune = first; rune <= last && rune < 256; ++rune)
+				latin1[rune] = true;
+	}
+
+	bool contains(char32_t rune) const
+	{
+		if (rune < 256)
+			return latin1[rune];
+		auto interval = std::lower_bound(runes->begin(), runes->end(), rune, [](auto& x, auto& y) { return x.second < y; });
+		return interval != runes->end() && interval->first <= rune && rune <= interval->second;
+	}
+};
+
+struct span_scanner
+{
+	std::bitset<256> latin1;
+	std::array<std::pair<unsigned char, unsigned char>, 8> ranges{};
+	std::size_t range_count{0};
+	compiled_rune_set const* runes{nullptr};
+
+	template <class Match>
+	explicit span_scanner(Match&& match, compiled_rune_set const* r = nullptr) : runes{r}
+	{
+		for (char32_t rune = 0; rune < 256; ++rune)
+			latin1[rune] = match(rune);
+		for (unsigned int octet = 0; octet < 0x80; ++octet) {
+			if (!latin1[octet] || (octet > 0 && latin1[octet - 1]))
+				continue;
+			if (range_count == ranges.size()) {
+				range_count = 0;
+				break;
+			}
+			auto last = octet;
+			while (last + 1 < 0x80 && latin1[last + 1])
+				++last;
+			ranges[range_count++] = {static_cast<unsigned char>(octet), static_cast<unsigned char>(last)};
+		}
+	}
+
+	std::size_t skip_ascii(std::string_view subject, std::size_t i) const
+	{
+		auto const data = subject.data();
+		auto const n = subject.size();
+#if defined(LUG_SSE2)
+		if (range_count != 0) {
+			for ( ; n - i >= 16; i += 16) {
+				__m128i const x = _mm_loadu_si128(reinterpret_cast<__m128i const*>(data + i));
+				__m128i member = _mm_setzero_si128();
+				for (std::size_t k = 0; k < range_count; ++k) {
+					__m128i const first = _mm_set1_epi8(static_cast<char>(ranges[k].first)), last = _mm_set1_epi8(static_cast<char>(ranges[k].second));
+					member = _mm_or_si128(member, _mm_and_si128(_mm_cmpeq_epi8(_mm_max_epu8(x, first), x), _mm_cmpeq_epi8(_mm_min_epu8(x, last), x)));
+				}
+				if (auto const mask = static_cast<unsigned int>(_mm_movemask_epi8(member)) ^ 0xffffu; mask != 0)
+					return i + detail::count_trailing_zeros(mask);
+			}
+		}
+#elif defined(LUG_NEON)
+		if (range_count != 0) {
+			for ( ; n - i >= 16; i += 16) {
+				uint8x16_t const x = vld1q_u8(reinterpret_cast<std::uint8_t const*>(data + i));
+				uint8x16_t member = vdupq_n_u8(0);
+				for (std::size_t k = 0; k < range_count; ++k)
+					member = vorrq_u8(member, vandq_u8(vcgeq_u8(x, vdupq_n_u8(ranges[k].first)), vcleq_u8(x, vdupq_n_u8(ranges[k].second))));
+				if (vminvq_u8(member) != 0xff)
+					break;
+			}
+		}
+#endif
+		while (i < n && static_cast<unsigned char>(data[i]) < 0x80 && latin1[static_cast<unsigned char>(data[i])])
+			++i;
+		return i;
+	}
+
+	static std::size_t skip_ascii_space(std::string_view subject, std::size_t i)
+	{
+		auto const data = subject.data();
+		auto const n = subject.size();
+		auto const is_space = [](char c) { return c == ' ' || static_cast<unsigned char>(c - '\t') <= '\r' - '\t'; };
+		if (i >= n || !is_space(data[i]))
+			return i;
+#if defined(LUG_SSE2)
+		__m128i const tab = _mm_set1_epi8('\t'), width = _mm_set1_epi8('\r' - '\t'), blank = _mm_set1_epi8(' ');
+		for (++i; n - i >= 16; i += 16) {
+			__m128i const x = _mm_loadu_si128(reinterpret_cast<__m128i const*>(data + i)), d = _mm_sub_epi8(x, tab);
+			__m128i const member = _mm_or_si128(_mm_cmpeq_epi8(_mm_min_epu8(d, width), d), _mm_cmpeq_epi8(x, blank));
+			if (auto const mask = static_cast<unsigned int>(_mm_movemask_epi8(member)) ^ 0xffffu; mask != 0)
+				return i + detail::count_trailing_zeros(mask);
+		}
+#elif defined(LUG_NEON)
+		uint8x16_t const tab = vdupq_n_u8('\t'), width = vdupq_n_u8('\r' - '\t'), blank = vdupq_n_u8(' ');
+		for (++i; n - i >= 16; i += 16) {
+			uint8x16_t const x = vld1q_u8(reinterpret_cast<std::uint8_t const*>(data + i));
+			if (vminvq_u8(vorrq_u8(vcleq_u8(vsubq_u8(x, tab), width), vceqq_u8(x, blank))) != 0xff)
+				break;
+		}
+#endif
+		while (i < n && is_space(data[i]))
+			++i;
+		return i;
+	}
+
+	static std::size_t skip_line_text(std::string_view subject, std::size_t i)
+	{
+		auto const data = subject.data();
+		auto const n = subject.size();
+		auto const is_break = [](char c) { auto const o = static_cast<unsigned char>(c); return static_cast<unsigned char>(o - '\n') <= '\r' - '\n' || o == 0xc2 || o == 0xe2; };
+#if defined(LUG_SSE2)
+		__m128i const lf = _mm_set1_epi8('\n'), width = _mm_set1_epi8('\r' - '\n'), nel = _mm_set1_epi8(static_cast<char>(0xc2)), lsps = _mm_set1_epi8(static_cast<char>(0xe2));
+		for ( ; n - i >= 16; i += 16) {
+			__m128i const x = _mm_loadu_si128(reinterpret_cast<__m128i const*>(data + i)), d = _mm_sub_epi8(x, lf);
+			__m128i const member = _mm_or_si128(_mm_cmpeq_epi8(_mm_min_epu8(d, width), d), _mm_or_si128(_mm_cmpeq_epi8(x, nel), _mm_cmpeq_epi8(x, lsps)));
+			if (auto const mask = static_cast<unsigned int>(_mm_movemask_epi8(member)); mask != 0)
+				return i + detail::count_trailing_zeros(mask);
+		}
+#elif defined(LUG_NEON)
+		uint8x16_t const lf = vdupq_n_u8('\n'), width = vdupq_n_u8('\r' - '\n'), nel = vdupq_n_u8(0xc2), lsps = vdupq_n_u8(0xe2);
+		for ( ; n - i >= 16; i += 16) {
+			uint8x16_t const x = vld1q_u8(reinterpret_cast<std::uint8_t const*>(data + i));
+			if (vmaxvq_u8(vorrq_u8(vcleq_u8(vsubq_u8(x, lf), width), vorrq_u8(vceqq_u8(x, nel), vceqq_u8(x, lsps)))) != 0)
+				break;
+		}
+#endif
+		while (i < n && !is_break(data[i]))
+			++i;
+		return i;
+	}
+};
+
+struct merged_match
+{
+	std::string str;
+	std::vector<std::size_t> splits;
+
+	std::size_t failure_offset(std::string_view subject) const
+	{
+		auto const prefix = static_cast<std::size_t>(std::mismatch(str.begin(), str.end(), subject.begin(), subject.end()).first - str.begin());
+		auto const split = std::upper_bound(splits.begin(), splits.end(), prefix);
+		return split != splits.begin() ? *std::prev(split) : 0;
+	}
+};
+
+struct literal_trie
+{
+	static constexpr unsigned short none = (std::numeric_limits<unsigned short>::max)();
+	struct node { unsigned int first, count; unsigned short accept, best; };
+	std::array<unsigned int, 256> roots{};
+	std::vector<node> nodes;
+	std::vector<std::pair<unsigned char, unsigned int>> edges;
+	bool caseless;
+
+	explicit literal_trie(literal_set const& set) : caseless{set.caseless}
+	{
+		std::vector<std::map<unsigned char, unsigned int>> children(1);
+		std::vector<unsigned short> accepts(1, none);
+		for (std::size_t i = 0; i < set.literals.size(); ++i) {
+			unsigned int n = 0;
+			for (auto const c : set.literals[i]) {
+				auto [child, inserted] = children[n].try_emplace(static_cast<unsigned char>(c), static_cast<unsigned int>(children.size()));
+				if (inserted)
+					children.emplace_back(), accepts.push_back(none);
+				n = child->second;
+			}
+			accepts[n] = (std::min)(accepts[n], static_cast<unsigned short>(i));
+		}
+		nodes.resize(children.size());
+		for (std::size_t n = 0; n < children.size(); ++n) {
+			nodes[n] = {static_cast<unsigned int>(edges.size()), static_cast<unsigned int>(children[n].size()), accepts[n], accepts[n]};
+			edges.insert(edges.end(), children[n].begin(), children[n].end());
+		}
+		for (auto n = nodes.size(); n-- > 0; )
+			for (auto e = nodes[n].first, m = e + nodes[n].count; e < m; ++e)
+				nodes[n].best = (std::min)(nodes[n].best, nodes[edges[e].second].best);
+		for (auto const& [octet, child] : children[0])
+			roots[octet] = child;
+	}
+
+	unsigned int next(unsigned int n, unsigned char octet) const noexcept
+	{
+		if (n == 0)
+			return roots[octet];
+		auto const first = edges.begin() + nodes[n].first, last = first + nodes[n].count;
+		auto const e = std::lower_bound(first, last, octet, [](auto const& x, unsigned char o) { return x.first < o; });
+		return e != last && e->first == octet ? e->second : 0;
+	}
+};
+
+struct decoded_instruction
+{
+	opcode op;
+	unsigned short imm;
+	int dst;
+	std::string_view str;
+	union { compiled_rune_set const* runes; std::bitset<256> const* octets; octet_table const* table; merged_match const* merged; span_scanner const* span; literal_trie const* trie; };
+};
+
+struct optimizer_report
+{
+	std::size_t instructions_before{0}, instructions_after{0};
+	std::size_t inlined_calls{0}, removed_instructions{0}, folded_spans{0}, literal_tries{0}, dispatched_choices{0}, merged_matches{0};
+};
+
+struct rule_profile
+{
+	lug::rule const* rule{nullptr};
+	std::ptrdiff_t address{0};
+	std::size_t calls{0}, backtracks{0}, regrowths{0}, bytes_consumed{0};
+};
+
+struct parser_profile
+{
+	std::array<std::size_t, static_cast<std::size_t>(opcode::jump_table) + 1> instructions{};
+	std::vector<rule_profile> rules;
+	std::size_t max_stack_frames{0}, max_lrmemo_frames{0}, max_memo_frames{0}, max_input_size{0}, max_responses{0};
+};
+
+struct decoded_program
+{
+	std::vector<decoded_instruction> instructions;
+	std::vector<compiled_rune_set> runesets;
+	std::vector<octet_table> tables;
+	std::deque<merged_match> matches;
+	std::deque<span_scanner> spans;
+	std::deque<literal_trie> tries;
+	std::size_t merged_matches{0};
+
+	decoded_program() = default;
+
+	explicit decoded_program(program const& p, program_entry_points* entry_points = nullptr)
+	{
+		auto const& code = p.instructions;
+		auto const n = static_cast<std::ptrdiff_t>(code.size());
+		std::vector<int> addresses(code.size() + 1, -1);
+		std::vector<std::ptrdiff_t> targets;
+		std::vector<bool> targeted(code.size() + 1, false);
+		for (std::ptrdiff_t pc = 0; pc < n; ) {
+			if (instruction::length(code[pc].pf) > n - pc)
+				throw bad_grammar{};
+			auto const offset = (code[pc].pf.aux & operands::off) != operands::none;
+			auto [op, imm, off, str] = instruction::decode(code, pc);
+			if (offset && pc + off >= 0 && pc + off <= n)
+				targeted[pc + off] = true;
+		}
+		runesets.reserve(p.runesets.size());
+		for (auto const& r : p.runesets)
+			runesets.emplace_back(r);
+		instructions.reserve(code.size());
+		targets.reserve(code.size());
+		for (std::ptrdiff_t pc = 0; pc < n; ) {
+			auto const address = pc;
+			addresses[pc] = static_cast<int>(instructions.size());
+			auto [op, imm, off, str] = instruction::decode(code, pc);
+			if (op >= opcode::jump_table)
+				throw bad_opcode{};
+			if (op == opcode::match && !str.empty() && !targeted[address] && !instructions.empty() &&
+					instructions.back().op == opcode::match && !instructions.back().str.empty()) {
+				auto& prev = instructions.back();
+				auto& merged = prev.imm != 0 ? matches.back() : matches.emplace_back(merged_match{std::string{prev.str}, {}});
+				merged.splits.push_back(merged.str.size());
+				merged.str.append(str);
+				prev.imm = 1, prev.str = merged.str, prev.merged = &merged;
+				addresses[address] = static_cast<int>(instructions.size() - 1);
+				++merged_matches;
+				continue;
+			}
+			compiled_rune_set const* runes = nullptr;
+			if (op == opcode::match_set) {
+				if (imm >= runesets.size())
+					throw bad_grammar{};
+				runes = &runesets[imm];
+			}
+			instructions.push_back({op, imm, 0, str, {runes}});
+			if (op == opcode::test_set || op == opcode::match_octet || op == opcode::span_octet) {
+				if (imm >= p.octetsets.size())
+					throw bad_grammar{};
+				instructions.back().octets = &p.octetsets[imm];
+			}
+			if (op == opcode::match_field && ((imm & 0x0f) < 1 || (imm & 0x0f) > 8))
+				throw bad_grammar{};
+			if (op >= opcode::span_any_of && op <= opcode::span_set)
+				instructions.back().span = &lower_span(op, imm, str);
+			if (op == opcode::match_trie) {
+				if (imm >= p.literalsets.size())
+					throw bad_grammar{};
+				instructions.back().trie = &tries.emplace_back(p.literalsets[imm]);
+			}
+			targets.push_back(pc + off);
+		}
+		addresses[code.size()] = static_cast<int>(instructions.size());
+		for (std::size_t i = 0, m = instructions.size(); i < m; ++i) {
+			if (targets[i] < 0 || targets[i] > n || addresses[targets[i]] < 0)
+				throw bad_grammar{};
+			instructions[i].dst = addresses[targets[i]];
+		}
+		if (entry_points)
+			for (auto& entry : *entry_points)
+				entry.first = entry.first >= 0 && entry.first < n ? addresses[entry.first] : -1;
+		lower_test_chains();
+	}
+
+	void swap(decoded_program& d)
+	{
+		instructions.swap(d.instructions);
+		runesets.swap(d.runesets);
+		tables.swap(d.tables);
+		matches.swap(d.matches);
+		spans.swap(d.spans);
+		tries.swap(d.tries);
+		std::swap(merged_matches, d.merged_matches);
+	}
+
+private:
+	span_scanner const& lower_span(opcode op, unsigned short imm, std::string_view str)
+	{
+		auto const penum = static_cast<unicode::property_enum>(imm);
+		switch (op) {
+			case opcode::span_any_of: return spans.emplace_back([penum, str](char32_t r) { return unicode::any_of(unicode::query(r), penum, str); });
+			case opcode::span_all_of: return spans.emplace_back([penum, str](char32_t r) { return unicode::all_of(unicode::query(r), penum, str); });
+			case opcode::span_none_of: return spans.emplace_back([penum, str](char32_t r) { return unicode::none_of(unicode::query(r), penum, str); });
+			default: break;
+		}
+		if (imm >= runesets.size())
+			throw bad_grammar{};
+		auto const& runes = runesets[imm];
+		return spans.emplace_back([&runes](char32_t r) { return runes.contains(r); }, &runes);
+	}
+
+	void lower_test_chains()
+	{
+		auto const m = instructions.size();
+		auto is_test = [this, m](std::size_t i) { return i < m && instructions[i].op == opcode::test_set; };
+		std::vector<bool> entered(m + 1, false);
+		for (std::size_t i = 0; i < m; ++i) {
+			entered[static_cast<std::size_t>(instructions[i].dst)] = true;
+			if (instructions[i].op != opcode::test_set)
+				entered[i + 1] = true;
+		}
+		std::vector<std::size_t> heads;
+		for (std::size_t i = 0; i < m; ++i)
+			if (is_test(i) && (i == 0 || entered[i]) && (is_test(i + 1) || is_test(static_cast<std::size_t>(instructions[i].dst))))
+				heads.push_back(i);
+		tables.resize(heads.size());
+		for (std::size_t h = 0; h < heads.size(); ++h) {
+			auto& table = tables[h];
+			std::vector<int> backtracks;
+			for (std::size_t octet = 0; octet <= 256; ++octet) {
+				std::size_t i = heads[h];
+				bool mismatch = false;
+				backtracks.clear();
+				for (std::size_t k = 0; k < m && is_test(i); ++k) {
+					if (octet < 256 && (*instructions[i].octets)[octet])
+						backtracks.push_back(instructions[i].dst), ++i;
+					else
+						i = static_cast<std::size_t>(instructions[i].dst), mismatch = true;
+				}
+				auto first = std::search(table.backtracks.begin(), table.backtracks.end(), backtracks.begin(), backtracks.end());
+				if (first == table.backtracks.end())
+					first = table.backtracks.insert(table.backtracks.end(), backtracks.begin(), backtracks.end());
+				detail::assure_in_range<resource_limit_error>(table.backtracks.size(), 0u, (std::numeric_limits<unsigned short>::max)());
+				table.entries[octet] = {static_cast<int>(i), static_cast<unsigned short>(first - table.backtracks.begin()), static_cast<unsigned short>(backtracks.size()), mismatch};
+			}
+		}
+		for (std::size_t h = 0; h < heads.size(); ++h)
+			instructions[heads[h]].op = opcode::jump_table, instructions[heads[h]].table = &tables[h];
+	}
+};
+
 class rule
 {
 	friend class encoder;
@@ -168,12 +611,28 @@ public:
 class grammar
 {
 	friend grammar start(rule const&);
+	friend grammar load_grammar(std::string_view, grammar_bindings);
 	lug::program program_;
-	grammar(lug::program p) : program_{std::move(p)} {}
+	lug::decoded_program decoded_;
+	lug::optimizer_report report_;
+	program_entry_points entry_points_;
+	grammar(lug::program p, lug::optimizer_report r, program_entry_points e) : program_{std::move(p)}, decoded_{program_, &e}, report_{r}, entry_points_{std::move(e)}
+	{
+		report_.instructions_after = decoded_.instructions.size(), report_.merged_matches = decoded_.merged_matches;
+		entry_points_.erase(std::remove_if(entry_points_.begin(), entry_points_.end(), [](auto const& x) { return x.first < 0; }), entry_points_.end());
+		std::sort(entry_points_.begin(), entry_points_.end());
+	}
 public:
 	grammar() = default;
-	void swap(grammar& g) { program_.swap(g.program_); }
+	grammar(grammar const& g) : program_{g.program_}, decoded_{program_}, report_{g.report_}, entry_points_{g.entry_points_} {}
+	grammar(grammar&& g) = default;
+	grammar& operator=(grammar const& g) { grammar{g}.swap(*this); return *this; }
+	grammar& operator=(grammar&& g) = default;
+	void swap(grammar& g) { program_.swap(g.program_); decoded_.swap(g.decoded_); std::swap(report_, g.report_); entry_points_.swap(g.entry_points_); }
 	lug::program const& program() const noexcept { return program_; };
+	lug::decoded_program const& decoded_program() const noexcept { return decoded_; }
+	lug::optimizer_report const& optimizer_report() const noexcept { return report_; }
+	program_entry_points const& entry_points() const noexcept { return entry_points_; }
 	static thread_local std::function<void(encoder&)> implicit_space;
 };
 
@@ -195,19 +654,20 @@ class environment
 	friend class lug::parser;
 
 	lug::parser* parser_ = nullptr;
-	std::vector<std::any> attributes_;
+	detail::attribute_stack attributes_;
 	unsigned int tab_width_ = 8;
 	unsigned int tab_alignment_ = 8;
 
 	virtual void on_accept_started() {}
 	virtual void on_accept_ended() {}
 
-	void start_accept(lug::parser& p)
+	void start_accept(lug::parser& p, bool resume)
 	{
 		if (parser_)
 			throw reenterant_accept_error{};
 		parser_ = &p;
-		attributes_.clear();
+		if (!resume)
+			attributes_.clear();
 		on_accept_started();
 	}
 
@@ -234,19 +694,18 @@ public:
 	template <class T>
 	void push_attribute(T&& x)
 	{
-		attributes_.emplace_back(std::in_place_type<T>, ::std::forward<T>(x));
+		attributes_.push<std::decay_t<T>>(::std::forward<T>(x));
 	}
 
 	template <class T, class... Args>
 	void push_attribute(Args&&... args)
 	{
-		attributes_.emplace_back(std::in_place_type<T>, ::std::forward<Args>(args)...);
+		attributes_.push<T>(::std::forward<Args>(args)...);
 	}
 
 	template <class T> T pop_attribute()
 	{
-		T r{::std::any_cast<T>(detail::pop_back(attributes_))};
-		return r;
+		return attributes_.pop<T>();
 	}
 };
 
@@ -270,6 +729,7 @@ class encoder
 	virtual void do_append(instruction) = 0;
 	virtual void do_append(program const&) = 0;
 	virtual immediate do_add_rune_set(unicode::rune_set) { return immediate{0}; }
+	virtual immediate do_add_octet_set(std::bitset<256>) { return immediate{0}; }
 	virtual immediate do_add_semantic_predicate(semantic_predicate) { return immediate{0}; }
 	virtual immediate do_add_semantic_action(semantic_action) { return immediate{0}; }
 	virtual immediate do_add_syntactic_capture(syntactic_capture) { return immediate{0}; }
@@ -290,9 +750,11 @@ protected:
 	{
 		while (sequence.size() > instruction::maxstrlen) {
 			std::string_view subsequence = sequence.substr(0, instruction::maxstrlen);
-			while (!subsequence.empty() && !utf8::is_lead(subsequence.back()))
-				subsequence.remove_suffix(1);
-			subsequence.remove_suffix(!subsequence.empty());
+			if ((mode() & directives::octet) == directives::none) {
+				while (!subsequence.empty() && !utf8::is_lead(subsequence.back()))
+					subsequence.remove_suffix(1);
+				subsequence.remove_suffix(!subsequence.empty());
+			}
 			encode(op, subsequence);
 			sequence.remove_prefix(subsequence.size());
 		}
@@ -302,8 +764,23 @@ protected:
 	template <class T>
 	encoder& do_match_class(opcode op, T value)
 	{
-		constexpr auto penum = immediate{static_cast<unsigned short>(unicode::to_property_enum_v<std::decay_t<T>>)};
-		return encode(op, detail::string_pack(value), penum);
+		constexpr auto penum = unicode::to_property_enum_v<std::decay_t<T>>;
+		if ((mode() & directives::octet) != directives::none) {
+			return do_match_octets([op, str = detail::string_pack(value)](char32_t r) {
+				auto const& record = unicode::query(r);
+				return op == opcode::match_any_of ? unicode::any_of(record, penum, str) : op == opcode::match_all_of ? unicode::all_of(record, penum, str) : unicode::none_of(record, penum, str);
+			});
+		}
+		return encode(op, detail::string_pack(value), immediate{static_cast<unsigned short>(penum)});
+	}
+
+	template <class Match>
+	encoder& do_match_octets(Match&& match)
+	{
+		std::bitset<256> octets;
+		for (unsigned int octet = 0; octet < 256; ++octet)
+			octets[octet] = match(static_cast<char32_t>(octet));
+		return encode(opcode::match_octet, do_add_octet_set(octets));
 	}
 
 	void do_skip()
@@ -330,9 +807,8 @@ public:
 	std::ptrdiff_t length() const noexcept { return do_length(); }
 	directives mandate() const noexcept { return (mandate_ & ~directives::eps) | mode_.back(); }
 	directives mode() const noexcept { return mode_.back(); }
-	encoder& match(unicode::rune_set runes) { return skip().encode(opcode::match_set, do_add_rune_set(std::move(runes))); }
 	encoder& match_eps() { return skip(directives::lexeme).encode(opcode::match); }
-	encoder& match_any() { return skip().encode(opcode::match_any); }
+	encoder& match_any() { return (mode() & directives::octet) != directives::none ? match_octets(1) : skip().encode(opcode::match_any); }
 	template <class T, class = std::enable_if_t<unicode::is_property_enum_v<T>>>
 	encoder& match_any(T properties) { return skip().do_match_class(opcode::match_any_of, properties); }
 	template <class T, class = std::enable_if_t<unicode::is_property_enum_v<T>>>
@@ -362,7 +838,7 @@ public:
 
 	encoder& call(rule const& r, unsigned short prec, bool allow_inlining = true)
 	{
-		if (auto const& p = r.program_; allow_inlining && prec <= 0 && !r.currently_encoding_ && r.callees_.empty() && !p.instructions.empty() &&
+		if (auto const& p = r.program_; allow_inlining && prec <= 0 && (mode() & directives::memoize) == directives::none && !r.currently_encoding_ && r.callees_.empty() && !p.instructions.empty() &&
 					p.instructions.size() <= 8 && p.predicates.size() <= 1 && p.actions.size() <= 1 && p.captures.size() <= 1)
 			return skip(p.mandate, directives::noskip).append(p);
 		return do_call(&r, &r.program_, 0, prec);
@@ -385,11 +861,47 @@ public:
 	encoder& match(std::string_view subject)
 	{
 		skip(!subject.empty() ? directives::eps : directives::none);
+		if ((mode() & (directives::caseless | directives::octet)) == (directives::caseless | directives::octet)) {
+			for (auto const c : subject)
+				do_match_octets([o = static_cast<char32_t>(static_cast<unsigned char>(c))](char32_t r) { return r == o || r == unicode::tolower(o) || r == unicode::toupper(o); });
+			return *this;
+		}
 		if ((mode() & directives::caseless) != directives::none)
 			return do_match(opcode::match_casefold, utf8::tocasefold(subject));
 		else
 			return do_match(opcode::match, subject);
 	}
+
+	encoder& match(unicode::rune_set runes)
+	{
+		if ((mode() & directives::octet) == directives::none)
+			return skip().encode(opcode::match_set, do_add_rune_set(std::move(runes)));
+		return skip().do_match_octets([&runes](char32_t r) { return std::any_of(runes.begin(), runes.end(), [r](auto const& i) { return i.first <= r && r <= i.second; }); });
+	}
+
+	encoder& match_eol()
+	{
+		if ((mode() & directives::octet) == directives::none)
+			return encode(opcode::match_eol);
+		return encode(opcode::choice, 4).encode(opcode::match, std::string_view{"\r\n"}).encode(opcode::commit, 1).do_match_octets([](char32_t r) {
+			return (unicode::query(r).properties() & unicode::ptype::Line_Ending) != unicode::ptype::None; });
+	}
+
+	encoder& match_octets(std::size_t count)
+	{
+		constexpr std::size_t maxcount = (std::numeric_limits<unsigned short>::max)();
+		skip(count != 0 ? directives::eps : directives::none);
+		for ( ; count > maxcount; count -= maxcount)
+			encode(opcode::match_octets, immediate{static_cast<unsigned short>(maxcount)});
+		return count != 0 ? encode(opcode::match_octets, immediate{static_cast<unsigned short>(count)}) : *this;
+	}
+
+	encoder& match_field(std::size_t width, bool little_endian)
+	{
+		if (width < 1 || width > 8)
+			throw bad_field_width{};
+		return skip().encode(opcode::match_field, immediate{static_cast<unsigned short>(width | (little_endian ? 0x10 : 0))});
+	}
 };
 
 class instruction_length_evaluator final : public encoder
@@ -412,6 +924,7 @@ class program_encoder : public encoder
 	void do_append(program const& p) override final { program_.concatenate(p); }
 	void do_add_callee(rule const* r, program const* p, std::ptrdiff_t n, directives d) override final { callees_.emplace_back(r, p, n, d); }
 	immediate do_add_rune_set(unicode::rune_set r) override final { return add_item(program_.runesets, std::move(r)); }
+	immediate do_add_octet_set(std::bitset<256> o) override final { return add_unique_item(program_.octetsets, o); }
 	immediate do_add_semantic_predicate(semantic_predicate p) override final { return add_item(program_.predicates, std::move(p)); }
 	immediate do_add_semantic_action(semantic_action a) override final { return add_item(program_.actions, std::move(a)); }
 	immediate do_add_syntactic_capture(syntactic_capture a) override final { return add_item(program_.captures, std::move(a)); }
@@ -424,6 +937,14 @@ class program_encoder : public encoder
 		return static_cast<immediate>(items.size() - 1);
 	}
 
+	template <class Item>
+	immediate add_unique_item(std::vector<Item>& items, Item const& item)
+	{
+		auto const index = detail::push_back_unique(items, item);
+		detail::assure_in_range<resource_limit_error>(index, 0u, (std::numeric_limits<unsigned short>::max)() - 1u);
+		return static_cast<immediate>(index);
+	}
+
 public:
 	program_encoder(program& p, program_callees& c, directives initial) : encoder{initial}, program_{p}, callees_{c} {}
 	~program_encoder() { program_.mandate = mandate(); }
@@ -442,6 +963,8 @@ inline auto&& add_rune_range(RuneSet&& runes, directives mode, char32_t first, c
 {
 	if (first > last)
 		throw bad_character_range{};
+	if ((mode & directives::octet) != directives::none && last > 0xff)
+		throw bad_octet_range{};
 	if ((mode & directives::caseless) != directives::none)
 		unicode::push_casefolded_range(runes, first, last);
 	else
@@ -451,8 +974,9 @@ inline auto&& add_rune_range(RuneSet&& runes, directives mode, char32_t first, c
 
 class basic_regular_expression
 {
+	struct compilation { std::once_flag once; lug::program program; };
 	std::string const expression_;
-	std::shared_ptr<program> const program_;
+	std::shared_ptr<std::array<compilation, 4>> const compiled_;
 
 	static grammar make_grammar();
 
@@ -465,8 +989,8 @@ class basic_regular_expression
 		unicode::ctype classes = unicode::ctype::none;
 		unicode::rune_set runes;
 
-		generator(basic_regular_expression const& se, directives mode)
-			: owner{se}, encoder{*se.program_, callees, mode | directives::eps | directives::lexeme} {}
+		generator(basic_regular_expression const& se, lug::program& prog, directives mode)
+			: owner{se}, encoder{prog, callees, mode | directives::eps | directives::lexeme} {}
 
 		void bracket_class(std::string_view s)
 		{
@@ -510,7 +1034,7 @@ class basic_regular_expression
 	};
 
 public:
-	explicit basic_regular_expression(std::string_view e) : expression_{e}, program_{std::make_shared<program>()} {}
+	explicit basic_regular_expression(std::string_view e) : expression_{e}, compiled_{std::make_shared<std::array<compilation, 4>>()} {}
 	void operator()(encoder& d) const;
 };
 
@@ -601,10 +1125,12 @@ constexpr auto caseless = directive_modifier<directives::caseless, directives::n
 constexpr auto lexeme = directive_modifier<directives::lexeme, directives::noskip, directives::eps>{};
 constexpr auto noskip = directive_modifier<directives::lexeme | directives::noskip, directives::none, directives::eps>{};
 constexpr auto skip = directive_modifier<directives::none, directives::lexeme | directives::noskip, directives::eps>{};
+constexpr auto memoize = directive_modifier<directives::memoize, directives::none, directives::eps>{};
+constexpr auto bytes = directive_modifier<directives::octet, directives::none, directives::eps>{};
 constexpr struct { void operator()(encoder&) const {} } nop = {};
 constexpr struct { void operator()(encoder& d) const { d.match_eps(); } } eps = {};
 constexpr struct { void operator()(encoder& d) const { d.encode(opcode::choice, 2).encode(opcode::match_any).encode(opcode::fail, immediate{1}); } } eoi = {};
-constexpr struct { void operator()(encoder& d) const { d.encode(opcode::match_eol); } } eol = {};
+constexpr struct { void operator()(encoder& d) const { d.match_eol(); } } eol = {};
 constexpr struct { void operator()(encoder& d) const { d.encode(opcode::accept); } } cut = {};
 constexpr ctype_combinator<ctype::alpha> alpha = {}; constexpr ctype_combinator<ctype::alnum> alnum = {}; constexpr ctype_combinator<ctype::lower> lower = {};
 constexpr ctype_combinator<ctype::upper> upper = {}; constexpr ctype_combinator<ctype::digit> digit = {}; constexpr ctype_combinator<ctype::xdigit> xdigit = {};
@@ -644,7 +1170,14 @@ constexpr struct
 {
 	auto operator()(char32_t c) const
 	{
-		return [c](encoder& d) { d.match(utf8::encode_rune(c)); };
+		return [c](encoder& d) {
+			if ((d.mode() & directives::octet) == directives::none)
+				d.match(utf8::encode_rune(c));
+			else if (c <= 0xff)
+				d.match(std::string(1, static_cast<char>(c)));
+			else
+				throw bad_octet_range{};
+		};
 	}
 
 	auto operator()(char32_t start, char32_t end) const
@@ -663,6 +1196,24 @@ constexpr struct
 }
 str = {};
 
+constexpr struct
+{
+	auto operator()(std::size_t count) const { return [count](encoder& d) { d.match_octets(count); }; }
+}
+octets = {};
+
+constexpr struct
+{
+	auto operator()(std::size_t width) const { return [width](encoder& d) { d.match_field(width, false); }; }
+}
+prefixed = {};
+
+constexpr struct
+{
+	auto operator()(std::size_t width) const { return [width](encoder& d) { d.match_field(width, true); }; }
+}
+prefixed_le = {};
+
 inline auto operator ""_cx(char32_t c) { return chr(c); }
 inline auto operator ""_sx(char const* s, std::size_t n) { return string_expression{std::string_view{s, n}}; }
 inline auto operator ""_rx(char const* s, std::size_t n) { return basic_regular_expression{std::string_view{s, n}}; }
@@ -812,49 +1363,566 @@ inline auto operator%(variable<T>& v, E const& e)
 
 inline thread_local std::function<void(encoder&)> grammar::implicit_space{language::operator*(language::space)};
 
+class first_set_analyzer
+{
+public:
+	struct first_set { std::bitset<256> octets; bool nullable{true}; bool opaque{false}; };
+
+	explicit first_set_analyzer(program const& p) : program_{p}, boundaries_(p.instructions.size() + 1, false)
+	{
+		auto const n = static_cast<std::ptrdiff_t>(program_.instructions.size());
+		for (std::ptrdiff_t pc = 0; pc < n; pc += instruction::length(program_.instructions[pc].pf))
+			boundaries_[pc] = true;
+		boundaries_[n] = true;
+	}
+
+	first_set evaluate(std::ptrdiff_t first, std::ptrdiff_t last)
+	{
+		if (auto cached = sequences_.find(std::make_pair(first, last)); cached != sequences_.end())
+			return cached->second;
+		first_set result{};
+		for (auto pc = first; result.nullable && !result.opaque && pc < last; ) {
+			auto const element = evaluate_element(pc, last);
+			result.octets |= element.octets, result.nullable = element.nullable, result.opaque = element.opaque;
+		}
+		return sequences_.emplace(std::make_pair(first, last), result).first->second;
+	}
+
+	std::ptrdiff_t previous(std::ptrdiff_t pc) const
+	{
+		while (pc > 0 && !boundaries_[--pc]) {}
+		return pc;
+	}
+
+	std::ptrdiff_t rule_end(std::ptrdiff_t pc) const
+	{
+		auto const n = static_cast<std::ptrdiff_t>(program_.instructions.size());
+		while (pc < n && program_.instructions[pc].pf.op != opcode::ret)
+			pc += instruction::length(program_.instructions[pc].pf);
+		return pc;
+	}
+
+private:
+	program const& program_;
+	std::vector<bool> boundaries_;
+	std::unordered_map<std::pair<std::ptrdiff_t, std::ptrdiff_t>, first_set, detail::pair_hash> sequences_;
+	std::unordered_map<std::ptrdiff_t, first_set> rules_;
+	std::size_t budget_{std::size_t{1} << 20};
+
+	bool consume_budget(std::ptrdiff_t pc)
+	{
+		if (budget_ == 0 || pc < 0 || static_cast<std::size_t>(pc) >= program_.instructions.size() || !boundaries_[pc])
+			return false;
+		return --budget_, true;
+	}
+
+	template <class Predicate>
+	static first_set classify(Predicate&& pred, bool nonascii)
+	{
+		first_set result{{}, false, false};
+		for (unsigned int octet = 0; octet < 0x80; ++octet)
+			result.octets[octet] = pred(static_cast<char32_t>(octet));
+		for (unsigned int octet = 0x80; nonascii && octet < 0x100; ++octet)
+			result.octets[octet] = true;
+		return result;
+	}
+
+	first_set evaluate_rule(std::ptrdiff_t pc)
+	{
+		if (auto cached = rules_.find(pc); cached != rules_.end())
+			return cached->second;
+		rules_.emplace(pc, first_set{{}, false, true});
+		auto const result = evaluate(pc, rule_end(pc));
+		return rules_[pc] = result;
+	}
+
+	first_set evaluate_class(opcode op, unsigned short imm, std::string_view str) const
+	{
+		switch (op) {
+			case opcode::match_any_of: {
+				return classify([imm, str](char32_t r) { return unicode::any_of(unicode::query(r), static_cast<unicode::property_enum>(imm), str); }, true);
+			}
+			case opcode::match_all_of: {
+				return classify([imm, str](char32_t r) { return unicode::all_of(unicode::query(r), static_cast<unicode::property_enum>(imm), str); }, true);
+			}
+			case opcode::match_none_of: {
+				return classify([imm, str](char32_t r) { return unicode::none_of(unicode::query(r), static_cast<unicode::property_enum>(imm), str); }, true);
+			}
+			default: {
+				auto const& runes = program_.runesets[imm];
+				return classify([&runes](char32_t r) { return std::any_of(runes.begin(), runes.end(), [r](auto const& i) { return i.first <= r && r <= i.second; }); },
+						std::any_of(runes.begin(), runes.end(), [](auto const& i) { return i.second >= 0x80; }));
+			}
+		}
+	}
+
+	first_set evaluate_element(std::ptrdiff_t& pc, std::ptrdiff_t last)
+	{
+		first_set const opaque{{}, false, true};
+		if (!consume_budget(pc))
+			return opaque;
+		auto [op, imm, off, str] = instruction::decode(program_.instructions, pc);
+		switch (op) {
+			case opcode::match: {
+				if (str.empty())
+					return first_set{};
+				return classify([c = static_cast<unsigned char>(str[0])](char32_t r) { return r == c; }, static_cast<unsigned char>(str[0]) >= 0x80);
+			}
+			case opcode::match_casefold: {
+				if (str.empty())
+					return first_set{};
+				return classify([c = static_cast<unsigned char>(str[0])](char32_t r) { return unicode::tocasefold(r) == c; }, true);
+			}
+			case opcode::match_trie: {
+				first_set result{{}, false, false};
+				auto const& set = program_.literalsets[imm];
+				for (auto const& literal : set.literals) {
+					auto const c = static_cast<unsigned char>(literal[0]);
+					if (set.caseless)
+						result.octets |= classify([c](char32_t r) { return unicode::tocasefold(r) == c; }, true).octets;
+					else
+						result.octets[c] = true;
+				}
+				return result;
+			}
+			case opcode::match_any: {
+				return classify([](char32_t) { return true; }, true);
+			}
+			case opcode::match_any_of:
+			case opcode::match_all_of:
+			case opcode::match_none_of:
+			case opcode::match_set: {
+				return evaluate_class(op, imm, str);
+			}
+			case opcode::span_any_of:
+			case opcode::span_all_of:
+			case opcode::span_none_of:
+			case opcode::span_set: {
+				auto result = evaluate_class(static_cast<opcode>(static_cast<int>(op) - static_cast<int>(opcode::span_any_of) + static_cast<int>(opcode::match_any_of)), imm, str);
+				return result.nullable = true, result;
+			}
+			case opcode::skip_space: {
+				auto result = evaluate_class(opcode::match_any_of, imm, str);
+				return result.nullable = true, result;
+			}
+			case opcode::match_octet:
+			case opcode::span_octet: {
+				return first_set{program_.octetsets[imm], op == opcode::span_octet, false};
+			}
+			case opcode::match_octets:
+			case opcode::match_field: {
+				return first_set{std::bitset<256>{}.set(), false, false};
+			}
+			case opcode::match_eol: {
+				return classify([](char32_t r) { return (unicode::query(r).properties() & unicode::ptype::Line_Ending) != unicode::ptype::None; }, true);
+			}
+			case opcode::choice: {
+				auto const start = pc, target = pc + off;
+				if (imm != 0 || target <= start || target > last || !boundaries_[target])
+					break;
+				auto const tail = previous(target);
+				auto tail_next = tail;
+				auto [tail_op, tail_imm, tail_off, tail_str] = instruction::decode(program_.instructions, tail_next);
+				auto const tail_target = tail_next + tail_off;
+				if (tail_op == opcode::commit && tail_target >= target && tail_target <= last) {
+					auto const x = evaluate(start, tail), y = evaluate(target, tail_target);
+					pc = tail_target;
+					return first_set{x.octets | y.octets, x.nullable || y.nullable, x.opaque || y.opaque};
+				}
+				if (tail_op == opcode::commit_partial && tail_target == start) {
+					auto const x = evaluate(start, tail);
+					pc = target;
+					return first_set{x.octets, true, x.opaque || x.nullable};
+				}
+				if (auto const negate = previous(tail); tail_op == opcode::fail && negate >= start && target < last &&
+						program_.instructions[negate].pf.op == opcode::commit && negate + 2 + program_.instructions[negate + 1].off == tail &&
+						program_.instructions[target].pf.op == opcode::match_any) {
+					pc = target + instruction::length(program_.instructions[target].pf);
+					return classify([](char32_t) { return true; }, true);
+				}
+			} break;
+			case opcode::call:
+			case opcode::call_memo: {
+				if (imm == 0)
+					return evaluate_rule(pc + off);
+			} break;
+			case opcode::action:
+			case opcode::begin:
+			case opcode::end: {
+				return first_set{};
+			}
+			default: break;
+		}
+		return opaque;
+	}
+};
+
+inline std::size_t optimize_choices(program& p)
+{
+	first_set_analyzer analyzer{p};
+	std::vector<std::pair<std::ptrdiff_t, std::bitset<256>>> rewrites;
+	auto const n = static_cast<std::ptrdiff_t>(p.instructions.size());
+	for (std::ptrdiff_t pc = 0, next = 0; pc < n; pc = next) {
+		auto [op, imm, off, str] = instruction::decode(p.instructions, next);
+		if (op != opcode::choice || imm != 0 || off <= 0 || next + off > n)
+			continue;
+		auto const x = analyzer.evaluate(next, next + off);
+		if (!x.opaque && !x.nullable && !x.octets.all())
+			rewrites.emplace_back(pc, x.octets);
+	}
+	for (auto const& [addr, octets] : rewrites) {
+		auto const val = detail::push_back_unique(p.octetsets, octets);
+		detail::assure_in_range<resource_limit_error>(val, 0u, (std::numeric_limits<unsigned short>::max)());
+		p.instructions[addr].pf.op = opcode::test_set;
+		p.instructions[addr].pf.val = static_cast<unsigned short>(val);
+	}
+	return rewrites.size();
+}
+
+class program_optimizer
+{
+	static constexpr std::ptrdiff_t max_inline_length = 16;
+	struct node { instruction prefix; std::ptrdiff_t source, length, target, entry = -1; };
+	program& program_;
+	optimizer_report& report_;
+	program_entry_points& entry_points_;
+	std::vector<node> nodes_;
+
+	static bool has_offset(node const& n) noexcept { return (n.prefix.pf.aux & operands::off) != operands::none; }
+	opcode op(std::ptrdiff_t i) const noexcept { return nodes_[static_cast<std::size_t>(i)].prefix.pf.op; }
+	auto size() const noexcept { return static_cast<std::ptrdiff_t>(nodes_.size()); }
+
+	void decode()
+	{
+		auto const& code = program_.instructions;
+		auto const n = static_cast<std::ptrdiff_t>(code.size());
+		std::vector<std::ptrdiff_t> indices(code.size() + 1, -1);
+		std::vector<std::ptrdiff_t> targets;
+		for (std::ptrdiff_t pc = 0; pc < n; ) {
+			auto const address = pc;
+			indices[pc] = size();
+			auto [op, imm, off, str] = instruction::decode(code, pc);
+			nodes_.push_back({code[address], address, pc - address, -1});
+			targets.push_back(has_offset(nodes_.back()) ? pc + off : -1);
+		}
+		indices[code.size()] = size();
+		for (std::size_t i = 0; i < nodes_.size(); ++i) {
+			if (targets[i] >= 0) {
+				if (targets[i] > n || indices[targets[i]] < 0)
+					throw bad_grammar{};
+				nodes_[i].target = indices[targets[i]];
+			}
+		}
+		for (std::size_t i = 0; i < entry_points_.size(); ++i)
+			if (auto const address = entry_points_[i].first; address >= 0 && address < n && indices[address] >= 0)
+				nodes_[static_cast<std::size_t>(indices[address])].entry = static_cast<std::ptrdiff_t>(i);
+		report_.instructions_before = nodes_.size();
+	}
+
+	std::ptrdiff_t rule_end(std::ptrdiff_t i) const
+	{
+		while (i < size() && op(i) != opcode::ret)
+			++i;
+		return i;
+	}
+
+	bool inlinable(std::ptrdiff_t first, std::ptrdiff_t last) const
+	{
+		std::ptrdiff_t length = 0;
+		for (auto i = first; i < last; ++i) {
+			auto const& n = nodes_[static_cast<std::size_t>(i)];
+			switch (n.prefix.pf.op) {
+				case opcode::call: case opcode::call_memo: case opcode::ret: case opcode::accept_final:
+				case opcode::predicate: case opcode::action: case opcode::begin: case opcode::end: return false;
+				default: break;
+			}
+			if (n.target >= 0 && (n.target < first || n.target > last))
+				return false;
+			if ((length += n.length) > max_inline_length)
+				return false;
+		}
+		return last < size() && first < last;
+	}
+
+	bool inline_calls()
+	{
+		std::ptrdiff_t first_rule = size();
+		for (auto const& n : nodes_)
+			if (n.prefix.pf.op == opcode::call || n.prefix.pf.op == opcode::call_memo)
+				first_rule = (std::min)(first_rule, n.target);
+		std::vector<node> result;
+		std::vector<bool> resolved;
+		std::vector<std::ptrdiff_t> moved(nodes_.size() + 1);
+		result.reserve(nodes_.size());
+		std::size_t inlined = 0;
+		for (std::ptrdiff_t i = 0; i < size(); ++i) {
+			auto const& n = nodes_[static_cast<std::size_t>(i)];
+			moved[static_cast<std::size_t>(i)] = static_cast<std::ptrdiff_t>(result.size());
+			if (n.prefix.pf.op != opcode::call || n.prefix.pf.val != 0 || i < first_rule) {
+				result.push_back(n);
+				resolved.push_back(false);
+				continue;
+			}
+			if (auto const last = rule_end(n.target); inlinable(n.target, last)) {
+				auto const base = static_cast<std::ptrdiff_t>(result.size());
+				for (auto j = n.target; j < last; ++j) {
+					auto copy = nodes_[static_cast<std::size_t>(j)];
+					bool const internal = copy.target >= 0 && copy.target < last;
+					if (internal)
+						copy.target = base + (copy.target - n.target);
+					else if (copy.target == last)
+						copy.target = i + 1;
+					copy.entry = -1;
+					result.push_back(copy);
+					resolved.push_back(internal);
+				}
+				++inlined;
+				continue;
+			}
+			result.push_back(n);
+			resolved.push_back(false);
+		}
+		moved[nodes_.size()] = static_cast<std::ptrdiff_t>(result.size());
+		for (std::size_t i = 0; i < result.size(); ++i)
+			if (result[i].target >= 0 && !resolved[i])
+				result[i].target = moved[static_cast<std::size_t>(result[i].target)];
+		nodes_.swap(result);
+		report_.inlined_calls += inlined;
+		return inlined != 0;
+	}
+
+	void remove_dead_code()
+	{
+		std::vector<bool> live(nodes_.size(), false);
+		std::vector<std::ptrdiff_t> pending{0};
+		while (!pending.empty()) {
+			auto const i = detail::pop_back(pending);
+			if (i >= size() || live[static_cast<std::size_t>(i)])
+				continue;
+			live[static_cast<std::size_t>(i)] = true;
+			switch (op(i)) {
+				case opcode::jump: case opcode::commit: case opcode::commit_back: case opcode::commit_partial:
+				case opcode::ret: case opcode::fail: case opcode::accept_final: break;
+				default: pending.push_back(i + 1); break;
+			}
+			if (auto const target = nodes_[static_cast<std::size_t>(i)].target; target >= 0)
+				pending.push_back(target);
+		}
+		report_.removed_instructions += compact(live);
+	}
+
+	bool is_space_class(node const& n) const
+	{
+		auto pc = n.source;
+		auto [op, imm, off, str] = instruction::decode(program_.instructions, pc);
+		return op == opcode::match_any_of && static_cast<unicode::property_enum>(imm) == unicode::property_enum::ctype && str == detail::string_pack(unicode::ctype::space);
+	}
+
+	void fold_spans()
+	{
+		std::vector<std::size_t> incoming(nodes_.size() + 1, 0);
+		for (auto const& n : nodes_)
+			if (n.target >= 0)
+				++incoming[static_cast<std::size_t>(n.target)];
+		std::vector<bool> live(nodes_.size(), true);
+		for (std::size_t i = 0; i + 2 < nodes_.size(); ++i) {
+			auto& choice = nodes_[i];
+			auto const& body = nodes_[i + 1];
+			auto const& loop = nodes_[i + 2];
+			auto const op = body.prefix.pf.op;
+			if (!live[i] || choice.prefix.pf.op != opcode::choice || choice.prefix.pf.val != 0 || choice.target != static_cast<std::ptrdiff_t>(i + 3) ||
+					((op < opcode::match_any_of || op > opcode::match_set) && op != opcode::match_octet) || loop.prefix.pf.op != opcode::commit_partial ||
+					loop.target != static_cast<std::ptrdiff_t>(i + 1) || incoming[i + 1] != 1 || incoming[i + 2] != 0)
+				continue;
+			choice = node{body.prefix, body.source, body.length, -1, choice.entry};
+			if (op == opcode::match_octet)
+				choice.prefix.pf.op = opcode::span_octet;
+			else
+				choice.prefix.pf.op = is_space_class(body) ? opcode::skip_space : static_cast<opcode>(static_cast<int>(op) - static_cast<int>(opcode::match_any_of) + static_cast<int>(opcode::span_any_of));
+			live[i + 1] = live[i + 2] = false;
+			++report_.folded_spans;
+		}
+		compact(live);
+	}
+
+	bool literal_alternation(std::ptrdiff_t i, std::ptrdiff_t& end, literal_set& set) const
+	{
+		auto const& n = nodes_[static_cast<std::size_t>(i)];
+		if (n.prefix.pf.op == opcode::match || n.prefix.pf.op == opcode::match_casefold) {
+			auto pc = n.source;
+			auto [op, imm, off, str] = instruction::decode(program_.instructions, pc);
+			if (str.empty() || (!set.literals.empty() && set.caseless != (op == opcode::match_casefold)))
+				return false;
+			set.caseless = op == opcode::match_casefold;
+			set.literals.emplace_back(str);
+			return end = i + 1, true;
+		}
+		if (n.prefix.pf.op != opcode::choice || n.prefix.pf.val != 0 || !literal_alternation(i + 1, end, set) || end + 1 != n.target || op(end) != opcode::commit)
+			return false;
+		auto const exit = nodes_[static_cast<std::size_t>(end)].target;
+		return literal_alternation(n.target, end, set) && end == exit;
+	}
+
+	void fold_literals()
+	{
+		std::vector<std::size_t> incoming(nodes_.size() + 1, 0);
+		for (auto const& n : nodes_)
+			if (n.target >= 0)
+				++incoming[static_cast<std::size_t>(n.target)];
+		std::vector<bool> live(nodes_.size(), true);
+		for (std::ptrdiff_t i = 0; i < size(); ++i) {
+			literal_set set;
+			std::ptrdiff_t end = i;
+			if (op(i) != opcode::choice || !literal_alternation(i, end, set) || set.literals.size() >= literal_trie::none)
+				continue;
+			std::size_t entered = 0, internal = 0;
+			for (auto j = i + 1; j < end; ++j)
+				entered += incoming[static_cast<std::size_t>(j)] + (nodes_[static_cast<std::size_t>(j)].entry >= 0 ? 1 : 0);
+			for (auto j = i; j < end; ++j)
+				if (auto const target = nodes_[static_cast<std::size_t>(j)].target; target > i && target < end)
+					++internal;
+			if (entered != internal)
+				continue;
+			auto const val = detail::push_back_unique(program_.literalsets, std::move(set));
+			detail::assure_in_range<resource_limit_error>(val, 0u, (std::numeric_limits<unsigned short>::max)());
+			auto& n = nodes_[static_cast<std::size_t>(i)];
+			n = node{instruction{opcode::match_trie, operands::none, static_cast<immediate>(val)}, n.source, 1, -1, n.entry};
+			std::fill(live.begin() + i + 1, live.begin() + end, false);
+			i = end - 1;
+			++report_.literal_tries;
+		}
+		compact(live);
+	}
+
+	std::vector<std::ptrdiff_t> forwarding(std::vector<bool> const& live) const
+	{
+		std::vector<std::ptrdiff_t> forward(nodes_.size() + 1);
+		forward[nodes_.size()] = size();
+		for (auto i = size(); i-- > 0; )
+			forward[static_cast<std::size_t>(i)] = live[static_cast<std::size_t>(i)] ? i : forward[static_cast<std::size_t>(i + 1)];
+		return forward;
+	}
+
+	std::size_t compact(std::vector<bool> const& live)
+	{
+		auto const forward = forwarding(live);
+		std::vector<node> result;
+		std::vector<std::ptrdiff_t> moved(nodes_.size() + 1);
+		for (std::size_t i = 0; i < nodes_.size(); ++i)
+			if (auto const f = static_cast<std::size_t>(forward[i]); !live[i] && nodes_[i].entry >= 0 && f < nodes_.size() && nodes_[f].entry < 0)
+				nodes_[f].entry = nodes_[i].entry;
+		for (std::size_t i = 0; i < nodes_.size(); ++i) {
+			moved[i] = static_cast<std::ptrdiff_t>(result.size());
+			if (live[i])
+				result.push_back(nodes_[i]);
+		}
+		moved[nodes_.size()] = static_cast<std::ptrdiff_t>(result.size());
+		for (auto& n : result)
+			if (n.target >= 0)
+				n.target = moved[static_cast<std::size_t>(forward[static_cast<std::size_t>(n.target)])];
+		auto const removed = nodes_.size() - result.size();
+		nodes_.swap(result);
+		return removed;
+	}
+
+	void encode()
+	{
+		std::vector<std::ptrdiff_t> addresses(nodes_.size() + 1, 0);
+		for (std::size_t i = 0; i < nodes_.size(); ++i)
+			addresses[i + 1] = addresses[i] + nodes_[i].length;
+		std::vector<instruction> code;
+		code.reserve(static_cast<std::size_t>(addresses.back()));
+		for (auto& entry : entry_points_)
+			entry.first = -1;
+		for (std::size_t i = 0; i < nodes_.size(); ++i) {
+			auto const& n = nodes_[i];
+			if (n.entry >= 0)
+				entry_points_[static_cast<std::size_t>(n.entry)].first = addresses[i];
+			code.push_back(n.prefix);
+			code.insert(code.end(), program_.instructions.begin() + n.source + 1, program_.instructions.begin() + n.source + n.length);
+			if (has_offset(n))
+				code[static_cast<std::size_t>(addresses[i] + 1)] = instruction{addresses[static_cast<std::size_t>(n.target)] - addresses[i + 1]};
+		}
+		program_.instructions.swap(code);
+	}
+
+public:
+	program_optimizer(program& p, optimizer_report& r, program_entry_points& e) : program_{p}, report_{r}, entry_points_{e} {}
+
+	void run()
+	{
+		decode();
+		for (std::size_t round = 0; round < nodes_.size() && inline_calls(); ++round)
+			remove_dead_code();
+		fold_literals();
+		fold_spans();
+		remove_dead_code();
+		encode();
+	}
+};
+
 inline grammar start(rule const& start_rule)
 {
 	program grprogram;
 	program_callees grcallees;
+	program_entry_points entry_points;
 	std::unordered_map<program const*, std::ptrdiff_t> addresses;
-	std::vector<std::pair<program const*, std::ptrdiff_t>> calls;
+	std::vector<std::tuple<program const*, std::ptrdiff_t, directives>> calls;
 	std::unordered_set<program const*> left_recursive;
-	std::vector<std::pair<std::vector<std::pair<rule const*, bool>>, program const*>> unprocessed;
+	std::vector<std::tuple<rule const*, bool, std::size_t>> callers;
+	std::vector<std::pair<std::size_t, program const*>> unprocessed;
+	program_set_index set_index;
 	program_encoder{grprogram, grcallees, directives::eps | directives::preskip}.call(start_rule, 1, false).encode(opcode::accept_final);
-	calls.emplace_back(&start_rule.program_, std::get<2>(grcallees.back()));
-	unprocessed.emplace_back(std::vector<std::pair<rule const*, bool>>{{&start_rule, false}}, &start_rule.program_);
+	calls.emplace_back(&start_rule.program_, std::get<2>(grcallees.back()), std::get<3>(grcallees.back()));
+	callers.emplace_back(&start_rule, false, 0);
+	unprocessed.emplace_back(0, &start_rule.program_);
+	auto const calls_left_recursively = [&callers](std::size_t caller, rule const* callee_rule) {
+		for (;;) {
+			auto const [caller_rule, caller_eps, parent] = callers[caller];
+			if (caller_rule == callee_rule)
+				return true;
+			if (!caller_eps)
+				return false;
+			caller = parent;
+		}
+	};
 	do {
-		auto [callstack, subprogram] = detail::pop_back(unprocessed);
+		auto const [caller, subprogram] = detail::pop_back(unprocessed);
 		auto const address = static_cast<std::ptrdiff_t>(grprogram.instructions.size());
 		if (addresses.emplace(subprogram, address).second) {
-			grprogram.concatenate(*subprogram);
+			grprogram.concatenate(*subprogram, set_index);
 			grprogram.instructions.emplace_back(opcode::ret, operands::none, immediate{0});
-			if (auto top_rule = callstack.back().first; top_rule) {
+			if (auto top_rule = std::get<0>(callers[caller]); top_rule) {
+				entry_points.emplace_back(address, top_rule);
 				for (auto [callee_rule, callee_program, instr_offset, mode] : top_rule->callees_) {
-					calls.emplace_back(callee_program, address + instr_offset);
-					if (callee_rule && (mode & directives::eps) != directives::none && detail::escaping_find_if(
-							callstack.crbegin(), callstack.crend(), [callee_rule](auto& caller) {
-								return caller.first == callee_rule ? 1 : (caller.second ? 0 : -1); }) != callstack.crend()) {
+					calls.emplace_back(callee_program, address + instr_offset, mode);
+					bool const eps = (mode & directives::eps) != directives::none;
+					if (callee_rule && eps && calls_left_recursively(caller, callee_rule)) {
 						left_recursive.insert(callee_program);
-					} else {
-						auto callee_callstack = callstack;
-						callee_callstack.emplace_back(callee_rule, (mode & directives::eps) != directives::none);
-						unprocessed.emplace_back(std::move(callee_callstack), callee_program);
+					} else if (addresses.count(callee_program) == 0) {
+						callers.emplace_back(callee_rule, eps, caller);
+						unprocessed.emplace_back(callers.size() - 1, callee_program);
 					}
 				}
 			}
 		}
 	} while (!unprocessed.empty());
-	for (auto [subprogram, instr_addr] : calls) {
-		if (auto& iprefix = grprogram.instructions[instr_addr]; iprefix.pf.op == opcode::call)
+	for (auto [subprogram, instr_addr, mode] : calls) {
+		if (auto& iprefix = grprogram.instructions[instr_addr]; iprefix.pf.op == opcode::call) {
 			iprefix.pf.val = left_recursive.count(subprogram) != 0 ? (iprefix.pf.val != 0 ? iprefix.pf.val : 1) : 0;
+			if (iprefix.pf.val == 0 && (mode & directives::memoize) != directives::none)
+				iprefix.pf.op = opcode::call_memo;
+		}
 		auto& ioffset = grprogram.instructions[instr_addr + 1];
 		auto const rel_addr = ioffset.off + addresses[subprogram] - (instr_addr + 2);
 		detail::assure_in_range<program_limit_error>(rel_addr, std::numeric_limits<int>::lowest(), (std::numeric_limits<int>::max)());
 		ioffset.off = static_cast<int>(rel_addr);
 	}
+	optimizer_report report;
+	program_optimizer{grprogram, report, entry_points}.run();
+	report.dispatched_choices = optimize_choices(grprogram);
 	grammar::implicit_space = language::operator*(language::space);
-	return grammar{std::move(grprogram)};
+	return grammar{std::move(grprogram), report, std::move(entry_points)};
 }
 
 struct parser_registers
@@ -866,60 +1934,208 @@ struct parser_registers
 
 class parser
 {
-	enum class stack_frame_type : unsigned char { backtrack, call, capture, lrcall };
-	enum class subject_location : std::size_t {};
-	struct lrmemo { std::size_t srr, sra, prec; std::ptrdiff_t pcr, pca; std::size_t rcr; std::vector<semantic_response> responses; };
+	enum class stack_frame_type : unsigned char { backtrack, call, capture, lrcall, memocall };
+	struct stack_frame { stack_frame_type type; std::size_t sr, rc; std::ptrdiff_t pc; };
+	struct lrmemo { std::size_t srr, sra, prec; std::ptrdiff_t pcr, pca; std::size_t rcr, first, count, srm; };
+	struct memocall { std::size_t srr, mrr, rcr; std::ptrdiff_t pcr, pca; unsigned short depth; };
+	struct memo_entry { std::size_t sra, mra, first, count; };
+	struct suspension {};
 	static constexpr std::size_t lrfailcode = (std::numeric_limits<std::size_t>::max)();
 	static constexpr unsigned short max_call_depth = (std::numeric_limits<unsigned short>::max)();
 	static constexpr std::size_t max_size = (std::numeric_limits<std::size_t>::max)();
+	static constexpr std::size_t stream_batch = 256;
+#ifdef LUG_ENABLE_PROFILER
+	static constexpr bool profiling = true;
+#else
+	static constexpr bool profiling = false;
+#endif
 	lug::grammar const& grammar_;
-	lug::environment& environment_;
-	std::vector<std::function<bool(std::string&)>> sources_;
-	std::string input_;
-	std::unordered_map<std::size_t, std::string> casefolded_subjects_;
+	lug::environment* environment_;
+	std::vector<std::pair<std::function<bool(std::string&)>, bool>> sources_;
+	std::string buffer_, source_text_;
+	std::size_t buffer_base_{0}, input_limit_{max_size};
+	std::string_view input_;
 	syntax_position origin_{1, 1};
 	std::vector<std::pair<std::size_t, syntax_position>> positions_;
+	std::vector<std::size_t> lines_;
+	std::size_t lines_scanned_{0}, validated_{0};
 	parser_registers registers_{0, 0, 0, 0, 0};
-	bool parsing_{false}, reading_{false}, cut_deferred_{false};
-	std::size_t cut_frame_{0};
-	std::vector<stack_frame_type> stack_frames_;
-	std::vector<std::tuple<std::size_t, std::size_t, std::ptrdiff_t>> backtrack_stack_; // sr, rc, pc
-	std::vector<std::ptrdiff_t> call_stack_; // pc
-	std::vector<subject_location> capture_stack_; // sr
+	bool parsing_{false}, reading_{false}, cut_deferred_{false}, external_{false};
+	std::size_t cut_frame_{0}, frame_depth_{0}, capture_depth_{0};
+	std::vector<stack_frame> stack_frames_;
 	std::vector<lrmemo> lrmemo_stack_;
-	std::vector<semantic_response> responses_;
+	std::vector<memocall> memo_stack_;
+	std::vector<semantic_response> responses_, lrmemo_responses_;
+	std::unordered_map<std::pair<std::ptrdiff_t, std::size_t>, memo_entry, detail::pair_hash> memo_table_;
+	std::vector<semantic_response> memo_responses_;
+	std::size_t memo_capacity_{std::size_t{1} << 16}, instruction_count_{0}, profile_base_{0};
+	parser_profile profile_;
+	std::unordered_map<std::ptrdiff_t, std::size_t> profile_rules_;
+	bool packrat_{false}, streaming_{false}, streamed_{false}, pushing_{false}, finished_{false}, suspendable_{false}, chunked_{false};
+	std::size_t stream_threshold_{stream_batch};
 	unsigned short prune_depth_{max_call_depth}, call_depth_{0};
 
+	unsigned short frame_depth() const noexcept
+	{
+		return static_cast<unsigned short>(frame_depth_);
+	}
+
 	bool available(std::size_t sr, std::size_t sn)
 	{
 		do {
 			if (sn <= input_.size() - sr)
 				return true;
-			if (sr < input_.size())
+			if (sr < input_.size() && !pushing_ && !chunked_)
 				return false;
 		} while (read_more());
+		if (suspendable_)
+			throw suspension{};
 		return false;
 	}
 
+	bool available_rune(std::size_t sr)
+	{
+		if (!available(sr, 1))
+			return false;
+		if (suspendable_ || chunked_)
+			available(sr, utf8::sequence_length(input_[sr]));
+		return true;
+	}
+
+	auto decode_rune(std::size_t sr)
+	{
+		if (sr >= validated_)
+			validated_ = utf8::valid_prefix(input_, validated_);
+		auto const curr = input_.cbegin() + static_cast<std::ptrdiff_t>(sr);
+		return sr < validated_ ? utf8::decode_valid_rune(curr) : utf8::decode_rune(curr, input_.cend());
+	}
+
 	bool read_more()
 	{
 		detail::reentrancy_sentinel<reenterant_read_error> guard{reading_};
-		std::string text;
+		auto& text = source_text_;
+		text.clear();
 		while (!sources_.empty() && text.empty()) {
-			bool more = sources_.back()(text);
-			input_.insert(input_.end(), text.begin(), text.end());
+			auto& [source, chunked] = sources_.back();
+			bool more = source(text);
+			chunked_ = chunked;
+			append(text.begin(), text.end());
 			if (!more)
 				sources_.pop_back();
 		}
 		return !text.empty();
 	}
 
-	int casefold_compare(std::size_t sr, std::size_t sn, std::string_view str)
+	template <class InputIt>
+	void append(InputIt first, InputIt last)
+	{
+		if (external_) {
+			buffer_.assign(input_.begin(), input_.end());
+			buffer_base_ = 0, external_ = false;
+		} else if (buffer_base_ > 0 && buffer_base_ >= buffer_.size() - buffer_base_) {
+			buffer_.erase(0, buffer_base_);
+			buffer_base_ = 0;
+		}
+		auto const size = buffer_.size();
+		buffer_.insert(buffer_.end(), first, last);
+		if (buffer_.size() - buffer_base_ > input_limit_) {
+			buffer_.resize(size);
+			input_ = std::string_view{buffer_}.substr(buffer_base_);
+			throw input_limit_error{};
+		}
+		input_ = std::string_view{buffer_}.substr(buffer_base_);
+		if constexpr (profiling)
+			profile_peaks();
+	}
+
+	void profile_peaks() noexcept
+	{
+		profile_.max_stack_frames = (std::max)(profile_.max_stack_frames, stack_frames_.size());
+		profile_.max_lrmemo_frames = (std::max)(profile_.max_lrmemo_frames, lrmemo_stack_.size());
+		profile_.max_memo_frames = (std::max)(profile_.max_memo_frames, memo_stack_.size());
+		profile_.max_input_size = (std::max)(profile_.max_input_size, input_.size());
+		profile_.max_responses = (std::max)(profile_.max_responses, responses_.size());
+	}
+
+	std::size_t profile_offset(std::size_t sr) const noexcept
+	{
+		return profiling ? profile_base_ + sr : 0;
+	}
+
+	rule_profile& profile_rule(std::ptrdiff_t address)
+	{
+		auto const [slot, inserted] = profile_rules_.try_emplace(address, profile_.rules.size());
+		if (inserted) {
+			auto const& entries = grammar_.entry_points();
+			auto const entry = std::lower_bound(entries.begin(), entries.end(), address, [](auto const& x, std::ptrdiff_t a) { return x.first < a; });
+			profile_.rules.push_back({entry != entries.end() && entry->first == address ? entry->second : nullptr, address});
+		}
+		return profile_.rules[slot->second];
+	}
+
+	rule_profile& profile_rule(stack_frame const& frame)
 	{
-		auto& subject = casefolded_subjects_[sr];
-		if (subject.size() < sn)
-			subject = utf8::tocasefold(std::string_view{input_.data() + sr, sn});
-		return subject.compare(0, sn, str);
+		switch (frame.type) {
+			case stack_frame_type::lrcall: return profile_rule(lrmemo_stack_.back().pca);
+			case stack_frame_type::memocall: return profile_rule(memo_stack_.back().pca);
+			default: return profile_rule(std::ptrdiff_t{grammar_.decoded_program().instructions[static_cast<std::size_t>(frame.pc - 1)].dst});
+		}
+	}
+
+	bool match_casefold(std::size_t& sr, std::string_view str)
+	{
+		auto i = sr;
+		for (std::size_t k = 0, n = str.size(); k < n; ) {
+			if (!available(i, 1))
+				return false;
+			if (auto const octet = static_cast<unsigned char>(input_[i]); octet < 0x80) {
+				if (static_cast<char>(static_cast<unsigned int>(octet - 'A') < 26u ? octet + ('a' - 'A') : octet) != str[k])
+					return false;
+				++i, ++k;
+				continue;
+			}
+			if (!available_rune(i))
+				return false;
+			auto const [next, rune] = decode_rune(i);
+			std::array<char, 4> folded;
+			auto const m = static_cast<std::size_t>(utf8::encode_rune(folded.begin(), unicode::tocasefold(rune)).first - folded.begin());
+			if (str.compare(k, m, std::string_view{folded.data(), m}) != 0)
+				return false;
+			i = static_cast<std::size_t>(next - input_.cbegin()), k += m;
+		}
+		sr = i;
+		return true;
+	}
+
+	unsigned short match_trie(std::size_t& sr, literal_trie const& trie)
+	{
+		auto winner = literal_trie::none;
+		auto end = sr;
+		unsigned int n = 0;
+		for (auto i = sr; available(i, 1); ) {
+			if (auto const octet = static_cast<unsigned char>(input_[i]); !trie.caseless) {
+				n = trie.next(n, octet), ++i;
+			} else if (octet < 0x80) {
+				n = trie.next(n, static_cast<unsigned char>(static_cast<unsigned int>(octet - 'A') < 26u ? octet + ('a' - 'A') : octet)), ++i;
+			} else {
+				if (!available_rune(i))
+					break;
+				auto const [next, rune] = decode_rune(i);
+				std::array<char, 4> folded;
+				auto const last = utf8::encode_rune(folded.begin(), unicode::tocasefold(rune)).first;
+				for (auto f = folded.begin(); f != last && (n = trie.next(n, static_cast<unsigned char>(*f))) != 0; ++f) {}
+				i = static_cast<std::size_t>(next - input_.cbegin());
+			}
+			if (n == 0)
+				break;
+			if (auto const& node = trie.nodes[n]; node.accept < winner)
+				winner = node.accept, end = i;
+			if (trie.nodes[n].best >= winner)
+				break;
+		}
+		if (winner != literal_trie::none)
+			sr = end;
+		return winner;
 	}
 
 	template <class Compare>
@@ -932,13 +2148,44 @@ class parser
 		return false;
 	}
 
+	template <class Match>
+	std::size_t match_span(std::size_t sr, span_scanner const& span, Match&& match)
+	{
+		while (available(sr, 1)) {
+			if (sr = span.skip_ascii(input_, sr); sr >= input_.size())
+				continue;
+			if (static_cast<unsigned char>(input_[sr]) < 0x80 || !available_rune(sr))
+				break;
+			auto const [next, rune] = decode_rune(sr);
+			if (!(rune < 256 ? span.latin1[rune] : match(rune)))
+				break;
+			sr = static_cast<std::size_t>(next - input_.cbegin());
+		}
+		return sr;
+	}
+
+	std::size_t match_space(std::size_t sr)
+	{
+		while (available(sr, 1)) {
+			if (sr = span_scanner::skip_ascii_space(input_, sr); sr >= input_.size())
+				continue;
+			if (static_cast<unsigned char>(input_[sr]) < 0x80 || !available_rune(sr))
+				break;
+			auto const [next, rune] = decode_rune(sr);
+			if (!unicode::query(rune).any_of(unicode::ctype::space))
+				break;
+			sr = static_cast<std::size_t>(next - input_.cbegin());
+		}
+		return sr;
+	}
+
 	template <class Match>
 	bool match_single(std::size_t& sr, Match&& match)
 	{
-		if (!available(sr, 1))
+		if (!available_rune(sr))
 			return false;
 		auto const curr = input_.cbegin() + sr, last = input_.cend();
-		auto [next, rune] = utf8::decode_rune(curr, last);
+		auto [next, rune] = decode_rune(sr);
 		bool matched;
 		if constexpr (std::is_invocable_v<Match, decltype(curr), decltype(last), decltype(next)&, char32_t>) {
 			matched = match(curr, last, next, rune);
@@ -956,96 +2203,255 @@ class parser
 	}
 
 	template <opcode Opcode>
-	bool commit(std::size_t& sr, std::size_t& rc, std::ptrdiff_t& pc, int off)
+	bool commit(std::size_t& sr, std::size_t& rc, std::ptrdiff_t& pc, std::ptrdiff_t dst)
 	{
-		if (stack_frames_.empty() || stack_frames_.back() != stack_frame_type::backtrack)
+		if (stack_frames_.empty() || stack_frames_.back().type != stack_frame_type::backtrack)
 			return false;
 		if constexpr (Opcode == opcode::commit_partial) {
-			detail::make_tuple_view<0, 1>(backtrack_stack_.back()) = {sr, rc};
+			stack_frames_.back().sr = sr, stack_frames_.back().rc = rc;
 		} else {
 			detail::ignore(sr, rc);
 			if constexpr (Opcode == opcode::commit_back)
-				sr = std::get<0>(backtrack_stack_.back());
-			pop_stack_frame(backtrack_stack_);
+				sr = stack_frames_.back().sr;
+			pop_stack_frame<stack_frame_type::backtrack>();
 		}
-		pc += off;
+		pc = dst;
 		return true;
 	}
 
-	void accept(std::size_t sr, std::size_t mr, std::size_t rc, std::ptrdiff_t pc)
+	void accept(std::size_t sr, std::size_t mr, std::size_t rc, std::ptrdiff_t pc, std::size_t count = max_size)
 	{
 		registers_ = {sr, (std::max)(mr, sr), rc, pc, 0};
 		auto const& actions = grammar_.program().actions;
 		auto const& captures = grammar_.program().captures;
-		environment_.start_accept(*this);
-		for (auto& response : responses_) {
+		auto const suspendable = std::exchange(suspendable_, false);
+		environment_->start_accept(*this, streamed_);
+		for (auto i = responses_.begin(), e = i + static_cast<std::ptrdiff_t>((std::min)(count, responses_.size())); i != e; ++i) {
+			auto const& response = *i;
 			if (prune_depth_ <= response.call_depth)
 				continue;
 			prune_depth_ = max_call_depth, call_depth_ = response.call_depth;
 			if (response.range.index < max_size)
-				captures[response.action_index](environment_, syntax{*this, response.range});
+				captures[response.action_index](*environment_, syntax{*this, response.range});
 			else
-				actions[response.action_index](environment_);
+				actions[response.action_index](*environment_);
 		}
-		environment_.end_accept();
+		environment_->end_accept();
+		suspendable_ = suspendable;
+	}
+
+	void index_lines(std::size_t index)
+	{
+		auto const data = input_.data();
+		auto i = lines_scanned_;
+		for (std::string_view const text{data, index}; (i = span_scanner::skip_line_text(text, i)) < index; ) {
+			auto const octet = static_cast<unsigned char>(data[i]);
+			std::size_t n = 1;
+			if (octet == 0xc2 || octet == 0xe2) {
+				if (index - i < (octet == 0xc2 ? 2u : 3u))
+					break;
+				n = octet == 0xc2 ? (static_cast<unsigned char>(data[i + 1]) == 0x85 ? 2 : 0)
+				    : (static_cast<unsigned char>(data[i + 1]) == 0x80 && (static_cast<unsigned char>(data[i + 2]) | 1) == 0xa9 ? 3 : 0);
+			} else if (octet == '\n' && !lines_.empty() && lines_.back() == i && i > 0 && data[i - 1] == '\r') {
+				lines_.back() = i + 1;
+				n = 0;
+			}
+			if (n != 0)
+				lines_.push_back(i + n);
+			i += (std::max)(n, std::size_t{1});
+		}
+		lines_scanned_ = (std::max)(lines_scanned_, (std::min)(i, index));
+	}
+
+	void rebase_indices(std::size_t sn)
+	{
+		lines_.erase(lines_.begin(), std::upper_bound(lines_.begin(), lines_.end(), sn));
+		for (auto& line : lines_)
+			line -= sn;
+		lines_scanned_ = lines_scanned_ > sn ? lines_scanned_ - sn : 0;
+		validated_ = validated_ > sn ? validated_ - sn : 0;
 	}
 
 	auto drain()
 	{
 		origin_ = position_at(registers_.sr);
-		input_.erase(0, registers_.sr);
-		casefolded_subjects_.clear();
+		rebase_indices(registers_.sr);
+		input_.remove_prefix(registers_.sr);
+		if (!external_) {
+			buffer_base_ += registers_.sr;
+			if (buffer_base_ == buffer_.size())
+				buffer_.clear(), buffer_base_ = 0;
+		}
 		positions_.clear();
 		responses_.clear();
+		clear_memos();
+		if constexpr (profiling)
+			profile_base_ += registers_.sr;
+		for (auto& frame : memo_stack_)
+			frame.srr = max_size, frame.mrr = frame.mrr > registers_.sr ? frame.mrr - registers_.sr : 0;
 		registers_.mr -= registers_.sr;
 		registers_.sr = 0, registers_.rc = 0;
 		cut_deferred_ = false, cut_frame_ = stack_frames_.size();
 		return registers_.as_tuple();
 	}
 
+	void stream(std::size_t& sr, std::size_t& mr, std::size_t& rc, std::ptrdiff_t pc)
+	{
+		auto rn = rc, sn = sr;
+		for (std::size_t i = 0, n = stack_frames_.size(); i < n; ++i) {
+			if (auto const& frame = stack_frames_[i]; frame.type == stack_frame_type::backtrack && i >= cut_frame_)
+				rn = (std::min)(rn, frame.rc), sn = (std::min)(sn, frame.sr);
+			else if (frame.type == stack_frame_type::capture)
+				sn = (std::min)(sn, frame.sr);
+		}
+		for (auto const& memo : lrmemo_stack_)
+			rn = (std::min)(rn, memo.rcr);
+		for (auto const& frame : memo_stack_)
+			rn = (std::min)(rn, frame.rcr);
+		if (rn > 0) {
+			accept(sr, mr, rc, pc, rn);
+			streamed_ = true;
+			responses_.erase(responses_.begin(), responses_.begin() + static_cast<std::ptrdiff_t>(rn));
+			rc -= rn;
+			for (auto& frame : stack_frames_)
+				frame.rc = frame.rc > rn ? frame.rc - rn : 0;
+			for (auto& memo : lrmemo_stack_)
+				memo.rcr -= rn;
+			for (auto& frame : memo_stack_)
+				frame.rcr -= rn;
+		}
+		for (auto const& response : responses_)
+			if (response.range.index < max_size)
+				sn = (std::min)(sn, response.range.index);
+		if (lrmemo_stack_.empty() && sn > 0) {
+			origin_ = position_at(sn);
+			rebase_indices(sn);
+			input_.remove_prefix(sn);
+			if (!external_) {
+				buffer_base_ += sn;
+				if (buffer_base_ == buffer_.size())
+					buffer_.clear(), buffer_base_ = 0;
+			}
+			positions_.clear();
+			clear_memos();
+			if constexpr (profiling)
+				profile_base_ += sn;
+			for (auto& frame : stack_frames_)
+				if (frame.type == stack_frame_type::backtrack || frame.type == stack_frame_type::capture)
+					frame.sr = frame.sr > sn ? frame.sr - sn : 0;
+			for (auto& frame : memo_stack_)
+				frame.srr = max_size, frame.mrr = frame.mrr > sn ? frame.mrr - sn : 0;
+			for (auto& response : responses_)
+				if (response.range.index < max_size)
+					response.range.index -= sn;
+			mr = (std::max)(mr, sr) - sn, sr -= sn;
+		}
+		stream_threshold_ = (std::max)(stream_batch, responses_.size() * 2);
+	}
+
+	void clear_memos()
+	{
+		memo_table_.clear();
+		memo_responses_.clear();
+	}
+
+	void memoize(memocall const& frame, std::size_t sr, std::size_t mr, std::size_t rc)
+	{
+		if (cut_deferred_ || frame.srr == max_size || memo_capacity_ == 0)
+			return;
+		auto const count = sr != lrfailcode && frame.rcr < rc ? rc - frame.rcr : 0;
+		if (memo_table_.size() + memo_responses_.size() + count >= memo_capacity_)
+			clear_memos();
+		auto const first = memo_responses_.size();
+		for (auto i = frame.rcr, n = frame.rcr + count; i < n; ++i) {
+			auto response = responses_[i];
+			response.call_depth = static_cast<unsigned short>(response.call_depth - (std::min)(response.call_depth, frame.depth));
+			memo_responses_.push_back(response);
+		}
+		memo_table_.insert_or_assign(std::make_pair(frame.pca, frame.srr), memo_entry{sr, mr, first, count});
+	}
+
 	void pop_responses_after(std::size_t n)
 	{
 		if (n < responses_.size())
 			responses_.resize(n);
 	}
 
-	auto drop_responses_after(std::size_t n)
+	void drop_responses_after(lrmemo& memo)
 	{
-		std::vector<semantic_response> dropped;
-		if (n < responses_.size()) {
-			dropped.assign(responses_.begin() + n, responses_.end());
-			responses_.resize(n);
+		lrmemo_responses_.resize(memo.first);
+		if (memo.rcr < responses_.size()) {
+			lrmemo_responses_.insert(lrmemo_responses_.end(), responses_.begin() + memo.rcr, responses_.end());
+			responses_.resize(memo.rcr);
 		}
-		return dropped;
+		memo.count = lrmemo_responses_.size() - memo.first;
 	}
 
-	auto restore_responses_after(std::size_t n, std::vector<semantic_response> const& restore)
+	auto restore_responses_after(std::size_t n, lrmemo const& memo)
 	{
 		pop_responses_after(n);
-		responses_.insert(responses_.end(), restore.begin(), restore.end());
+		responses_.insert(responses_.end(), lrmemo_responses_.begin() + memo.first, lrmemo_responses_.begin() + memo.first + memo.count);
+		if constexpr (profiling)
+			profile_peaks();
 		return responses_.size();
 	}
 
 	auto push_response(std::size_t depth, std::size_t action_index, syntax_range range = {max_size, 0})
 	{
 		responses_.push_back({static_cast<unsigned short>(depth), static_cast<unsigned short>(action_index), range});
+		if constexpr (profiling)
+			profile_peaks();
+		return responses_.size();
+	}
+
+	auto recall(memo_entry const& memo, std::size_t rc)
+	{
+		pop_responses_after(rc);
+		auto const depth = frame_depth();
+		for (auto i = memo.first, n = memo.first + memo.count; i < n; ++i) {
+			auto const& response = memo_responses_[i];
+			push_response(depth + response.call_depth, response.action_index, response.range);
+		}
 		return responses_.size();
 	}
 
-	template <class Stack, class... Args>
-	void pop_stack_frame(Stack& stack, Args&... args)
+	void push_stack_frame(stack_frame_type type, std::size_t sr = 0, std::size_t rc = 0, std::ptrdiff_t pc = 0)
 	{
-		stack.pop_back(), stack_frames_.pop_back();
+		stack_frames_.push_back({type, sr, rc, pc});
+		if (type == stack_frame_type::capture)
+			++capture_depth_;
+		else if (type != stack_frame_type::backtrack)
+			++frame_depth_;
+		if constexpr (profiling)
+			profile_peaks();
+	}
+
+	template <stack_frame_type Type, class... Args>
+	void pop_stack_frame(Args&... args)
+	{
+		stack_frames_.pop_back();
 		cut_frame_ = (std::min)(cut_frame_, stack_frames_.size());
-		if constexpr (std::is_same_v<typename Stack::value_type, subject_location> || std::is_same_v<typename Stack::value_type, lrmemo>)
-			if (cut_deferred_ && capture_stack_.empty() && lrmemo_stack_.empty())
+		if constexpr (Type == stack_frame_type::capture) {
+			--capture_depth_;
+		} else if constexpr (Type != stack_frame_type::backtrack) {
+			--frame_depth_;
+			if constexpr (Type == stack_frame_type::lrcall)
+				lrmemo_responses_.resize(lrmemo_stack_.back().first), lrmemo_stack_.pop_back();
+			else if constexpr (Type == stack_frame_type::memocall)
+				memo_stack_.pop_back();
+		}
+		if constexpr (sizeof...(Args) != 0 && (Type == stack_frame_type::capture || Type == stack_frame_type::lrcall)) {
+			if (cut_deferred_ && capture_depth_ == 0 && lrmemo_stack_.empty()) {
 				accept(args...);
+				std::tie(args..., std::ignore) = drain();
+			}
+		}
 	}
 
 public:
-	parser(lug::grammar const& g, lug::environment& e) : grammar_{g}, environment_{e} {}
+	parser(lug::grammar const& g, lug::environment& e) : grammar_{g}, environment_{&e} {}
 	lug::grammar const& grammar() const noexcept { return grammar_; }
-	lug::environment& environment() const noexcept { return environment_; }
+	lug::environment& environment() const noexcept { return *environment_; }
 	std::string_view match() const noexcept { return {input_.data(), registers_.sr}; }
 	std::string_view subject() const noexcept { return {input_.data() + registers_.sr, input_.size() - registers_.sr}; }
 	std::size_t subject_index() const noexcept { return registers_.sr; }
@@ -1058,37 +2464,48 @@ public:
 	unsigned short call_depth() const noexcept { return call_depth_; }
 	unsigned short prune_depth() const noexcept { return prune_depth_; }
 	void escape() { prune_depth_ = call_depth_; }
+	bool packrat() const noexcept { return packrat_; }
+	void packrat(bool enable) noexcept { packrat_ = enable; }
+	bool streaming() const noexcept { return streaming_; }
+	void streaming(bool enable) noexcept { streaming_ = enable; }
+	std::size_t memo_capacity() const noexcept { return memo_capacity_; }
+	void memo_capacity(std::size_t n) { memo_capacity_ = n; clear_memos(); }
+	std::size_t memo_size() const noexcept { return memo_table_.size(); }
+	std::size_t input_limit() const noexcept { return input_limit_; }
+	void input_limit(std::size_t n) noexcept { input_limit_ = n; }
+	std::size_t instruction_count() const noexcept { return instruction_count_; }
+	parser_profile const& profile() const noexcept { return profile_; }
 
 	syntax_position const& position_at(std::size_t index)
 	{
 		auto pos = std::lower_bound(std::begin(positions_), std::end(positions_), index, [](auto& x, auto& y) { return x.first < y; });
 		if (pos != std::end(positions_) && index == pos->first)
 			return pos->second;
-		std::size_t startindex = 0;
-		syntax_position position = origin_;
+		if (index > lines_scanned_)
+			index_lines(index);
+		auto const line = static_cast<std::size_t>(std::upper_bound(lines_.begin(), lines_.end(), index) - lines_.begin());
+		std::size_t startindex = line > 0 ? lines_[line - 1] : 0;
+		syntax_position position{line > 0 ? 1 : origin_.column, origin_.line + line};
 		if (pos != std::begin(positions_)) {
-			auto prevpos = std::prev(pos);
-			startindex = prevpos->first;
-			position = prevpos->second;
+			if (auto prevpos = std::prev(pos); prevpos->first >= startindex) {
+				startindex = prevpos->first;
+				position = prevpos->second;
+			}
 		}
-		auto first = std::next(std::begin(input_), startindex);
 		auto const last = std::next(std::begin(input_), index);
-		char32_t rune, prevrune = U'\0';
-		for (auto curr = first, next = curr; curr < last; curr = next, prevrune = rune) {
-			std::tie(next, rune) = utf8::decode_rune(curr, last);
-			if ((unicode::query(rune).properties() & unicode::ptype::Line_Ending) != unicode::ptype::None && (prevrune != U'\r' || rune != U'\n')) {
-				position.column = 1, ++position.line;
-				first = next;
+		for (auto curr = std::next(std::begin(input_), startindex), next = curr; curr < last; curr = next) {
+			if (auto const octet = static_cast<unsigned char>(*curr); octet != '\t' && octet - 1u < 0x7fu) {
+				++position.column, ++next;
+				continue;
 			}
-		}
-		for (auto curr = first, next = curr; curr < last; curr = next) {
+			char32_t rune;
 			std::tie(next, rune) = utf8::decode_rune(curr, last);
 			if (rune != U'\t') {
 				position.column += unicode::ucwidth(rune);
 			} else {
 				auto oldcolumn = position.column;
-				auto newcolumn = oldcolumn + environment_.tab_width();
-				auto alignedcolumn = newcolumn - ((newcolumn - 1) % environment_.tab_alignment());
+				auto newcolumn = oldcolumn + environment_->tab_width();
+				auto alignedcolumn = newcolumn - ((newcolumn - 1) % environment_->tab_alignment());
 				position.column = (std::max)((std::min)(newcolumn, alignedcolumn), oldcolumn);
 			}
 		}
@@ -1098,7 +2515,45 @@ public:
 	template <class InputIt, class = utf8::enable_if_char_input_iterator_t<InputIt>>
 	parser& enqueue(InputIt first, InputIt last)
 	{
-		input_.insert(input_.end(), first, last);
+		append(first, last);
+		return *this;
+	}
+
+	parser& reset()
+	{
+		if (parsing_ || reading_)
+			throw reenterant_parse_error{};
+		sources_.clear();
+		buffer_.clear(), buffer_base_ = 0, external_ = false;
+		input_ = std::string_view{};
+		origin_ = {1, 1};
+		positions_.clear();
+		lines_.clear(), lines_scanned_ = 0, validated_ = 0;
+		registers_ = {0, 0, 0, 0, 0};
+		cut_deferred_ = false, streamed_ = false, pushing_ = false, finished_ = false, chunked_ = false, cut_frame_ = 0, instruction_count_ = 0, profile_base_ = 0;
+		profile_ = parser_profile{}, profile_rules_.clear();
+		frame_depth_ = 0, capture_depth_ = 0;
+		stack_frames_.clear(), lrmemo_stack_.clear(), memo_stack_.clear();
+		responses_.clear(), lrmemo_responses_.clear();
+		clear_memos();
+		return *this;
+	}
+
+	parser& reset(lug::environment& e)
+	{
+		reset();
+		environment_ = &e;
+		return *this;
+	}
+
+	parser& bind(std::string_view buffer)
+	{
+		if (!input_.empty())
+			return enqueue(buffer.begin(), buffer.end());
+		buffer_.clear();
+		input_ = buffer, buffer_base_ = 0, external_ = true, validated_ = 0;
+		if constexpr (profiling)
+			profile_peaks();
 		return *this;
 	}
 
@@ -1107,7 +2562,10 @@ public:
 	{
 		if (reading_)
 			throw reenterant_read_error{};
-		sources_.emplace_back(::std::forward<InputFunc>(func));
+		bool chunked = false;
+		if constexpr (detail::is_chunked_source<std::decay_t<InputFunc>>::value)
+			chunked = func.chunked();
+		sources_.emplace_back(::std::forward<InputFunc>(func), chunked);
 		return *this;
 	}
 
@@ -1124,185 +2582,406 @@ public:
 	}
 
 	bool parse()
+	{
+		if (pushing_)
+			throw reenterant_parse_error{};
+		return execute() == parse_status::complete;
+	}
+
+	bool suspended() const noexcept
+	{
+		return pushing_;
+	}
+
+	parse_status feed(std::string_view chunk)
+	{
+		if (parsing_ || reading_)
+			throw reenterant_parse_error{};
+		append(chunk.begin(), chunk.end());
+		return resume();
+	}
+
+	parse_status finish()
+	{
+		if (parsing_ || reading_)
+			throw reenterant_parse_error{};
+		finished_ = true;
+		return resume();
+	}
+
+private:
+	parse_status resume()
+	{
+		bool const resuming = std::exchange(pushing_, true);
+		try {
+			auto const status = execute(resuming);
+			if (status != parse_status::needs_input)
+				pushing_ = false, finished_ = false;
+			return status;
+		} catch (...) {
+			pushing_ = false, finished_ = false;
+			throw;
+		}
+	}
+
+LUG_DIAGNOSTIC_PUSH_AND_IGNORE_PEDANTIC
+
+	parse_status execute(bool resuming = false)
 	{
 		detail::reentrancy_sentinel<reenterant_parse_error> guard{parsing_};
 		program const& prog = grammar_.program();
+		decoded_instruction const* const code = grammar_.decoded_program().instructions.data();
 		if (prog.instructions.empty())
 			throw bad_grammar{};
-		auto [sr, mr, rc, pc, fc] = drain();
-		bool result = false, done = false;
-		prune_depth_ = max_call_depth, call_depth_ = 0;
-		pc = 0, fc = 0;
-		while (!done) {
-			switch (auto [op, imm, off, str] = instruction::decode(prog.instructions, pc); op) {
-				case opcode::match: {
-					if (!match_sequence(sr, str, [this](auto i, auto n, auto s) { return input_.compare(i, n, s) == 0; }))
-						goto failure;
-				} break;
-				case opcode::match_casefold: {
-					if (!match_sequence(sr, str, [this](auto i, auto n, auto s) { return casefold_compare(i, n, s) == 0; }))
-						goto failure;
-				} break;
-				case opcode::match_any: {
-					if (!match_single(sr, []{ return true; }))
-						goto failure;
-				} break;
-				case opcode::match_any_of: {
-					if (!match_single(sr, [imm, str](auto const& r) { return unicode::any_of(r, static_cast<unicode::property_enum>(imm), str); }))
-						goto failure;
-				} break;
-				case opcode::match_all_of: {
-					if (!match_single(sr, [imm, str](auto const& r) { return unicode::all_of(r, static_cast<unicode::property_enum>(imm), str); }))
-						goto failure;
-				} break;
-				case opcode::match_none_of: {
-					if (!match_single(sr, [imm, str](auto const& r) { return unicode::none_of(r, static_cast<unicode::property_enum>(imm), str); }))
-						goto failure;
-				} break;
-				case opcode::match_set: {
-					if (!match_single(sr, [&runes = prog.runesets[imm]](char32_t rune) {
-							auto interval = std::lower_bound(runes.begin(), runes.end(), rune, [](auto& x, auto& y) { return x.second < y; });
-							return interval != runes.end() && interval->first <= rune && rune <= interval->second; }))
-						goto failure;
-				} break;
-				case opcode::match_eol: {
-					if (!match_single(sr, [&prog](auto curr, auto last, auto& next, char32_t rune) {
-							if (curr == next || (unicode::query(rune).properties() & unicode::ptype::Line_Ending) == unicode::ptype::None)
-								return false;
-							if (U'\r' == rune)
-								if (auto [next2, rune2] = utf8::decode_rune(next, last); next2 != next && rune2 == U'\n')
-									next = next2;
-							return true; }))
-						goto failure;
-				} break;
-				case opcode::choice: {
-					stack_frames_.push_back(stack_frame_type::backtrack);
-					backtrack_stack_.emplace_back(sr - imm, rc, pc + off);
-				} break;
-				case opcode::commit: {
-					if (!commit<opcode::commit>(sr, rc, pc, off))
-						goto failure;
-				} break;
-				case opcode::commit_back: {
-					if (!commit<opcode::commit_back>(sr, rc, pc, off))
-						goto failure;
-				} break;
-				case opcode::commit_partial: {
-					if (!commit<opcode::commit_partial>(sr, rc, pc, off))
-						goto failure;
-				} break;
-				case opcode::jump: {
-					pc += off;
-				} break;
-				case opcode::call: {
-					if (imm != 0) {
-						auto memo = detail::escaping_find_if(lrmemo_stack_.crbegin(), lrmemo_stack_.crend(),
-								[sr = sr, pca = pc + off](auto const& m){ return m.srr == sr && m.pca == pca ? 1 : (m.srr < sr ? 0 : -1); });
-						if (memo != lrmemo_stack_.crend()) {
-							if (memo->sra == lrfailcode || imm < memo->prec)
+		auto [sr, mr, rc, pc, fc] = resuming ? registers_.as_tuple() : drain();
+		suspendable_ = pushing_ && !finished_;
+		if (!resuming) {
+			prune_depth_ = max_call_depth, call_depth_ = 0;
+			streamed_ = false, stream_threshold_ = stream_batch;
+			pc = 0, fc = 0;
+		}
+#ifdef LUG_THREADED_DISPATCH
+		static void* const dispatch_table[] = {
+			&&vm_match,         &&vm_match_casefold, &&vm_match_any,      &&vm_match_any_of,
+			&&vm_match_all_of,  &&vm_match_none_of,  &&vm_match_set,      &&vm_match_eol,
+			&&vm_choice,        &&vm_commit,         &&vm_commit_back,    &&vm_commit_partial,
+			&&vm_jump,          &&vm_call,           &&vm_ret,            &&vm_fail,
+			&&vm_accept,        &&vm_accept_final,   &&vm_predicate,      &&vm_action,
+			&&vm_begin,         &&vm_end,            &&vm_call_memo,      &&vm_test_set,
+			&&vm_span_any_of,   &&vm_span_all_of,    &&vm_span_none_of,   &&vm_span_set,
+			&&vm_skip_space,    &&vm_match_trie,     &&vm_match_octet,    &&vm_match_octets,
+			&&vm_match_field,   &&vm_span_octet,     &&vm_jump_table
+		};
+		static_assert(std::size(dispatch_table) == static_cast<std::size_t>(opcode::jump_table) + 1, "dispatch table must cover every opcode");
+#define LUG_VM_CASE(name) case opcode::name: vm_##name
+#define LUG_VM_NEXT do { instr = &code[pc++]; LUG_VM_COUNT; goto *dispatch_table[static_cast<std::size_t>(instr->op)]; } while (false)
+#else
+#define LUG_VM_CASE(name) case opcode::name
+#define LUG_VM_NEXT continue
+#endif
+#if defined(LUG_ENABLE_PROFILER)
+#define LUG_VM_COUNT (++instruction_count_, ++profile_.instructions[static_cast<std::size_t>(instr->op)])
+#elif defined(LUG_COUNT_INSTRUCTIONS)
+#define LUG_VM_COUNT ++instruction_count_
+#else
+#define LUG_VM_COUNT static_cast<void>(0)
+#endif
+		try {
+			for (decoded_instruction const* instr; ; ) {
+				instr = &code[pc++];
+				LUG_VM_COUNT;
+				switch (instr->op) {
+					LUG_VM_CASE(match): {
+						if (!match_sequence(sr, instr->str, [this](auto i, auto n, auto s) { return input_.compare(i, n, s) == 0; })) {
+							if (instr->imm != 0)
+								sr += instr->merged->failure_offset(input_.substr(sr));
+							goto failure;
+						}
+					} LUG_VM_NEXT;
+					LUG_VM_CASE(match_casefold): {
+						if (!match_casefold(sr, instr->str))
+							goto failure;
+					} LUG_VM_NEXT;
+					LUG_VM_CASE(match_trie): {
+						auto const start = sr;
+						auto const index = match_trie(sr, *instr->trie);
+						if (index == literal_trie::none)
+							goto failure;
+						if (index != 0)
+							mr = (std::max)(mr, start);
+					} LUG_VM_NEXT;
+					LUG_VM_CASE(match_any): {
+						if (!match_single(sr, []{ return true; }))
+							goto failure;
+					} LUG_VM_NEXT;
+					LUG_VM_CASE(match_any_of): {
+						if (!match_single(sr, [imm = instr->imm, str = instr->str](auto const& r) { return unicode::any_of(r, static_cast<unicode::property_enum>(imm), str); }))
+							goto failure;
+					} LUG_VM_NEXT;
+					LUG_VM_CASE(match_all_of): {
+						if (!match_single(sr, [imm = instr->imm, str = instr->str](auto const& r) { return unicode::all_of(r, static_cast<unicode::property_enum>(imm), str); }))
+							goto failure;
+					} LUG_VM_NEXT;
+					LUG_VM_CASE(match_none_of): {
+						if (!match_single(sr, [imm = instr->imm, str = instr->str](auto const& r) { return unicode::none_of(r, static_cast<unicode::property_enum>(imm), str); }))
+							goto failure;
+					} LUG_VM_NEXT;
+					LUG_VM_CASE(match_set): {
+						if (available(sr, 1) && static_cast<unsigned char>(input_[sr]) < 0x80) {
+							if (!instr->runes->latin1[static_cast<unsigned char>(input_[sr])])
 								goto failure;
-							sr = memo->sra, rc = restore_responses_after(rc, memo->responses);
-							continue;
+							++sr;
+						} else if (!match_single(sr, [&runes = *instr->runes](char32_t rune) { return runes.contains(rune); })) {
+							goto failure;
 						}
-						stack_frames_.push_back(stack_frame_type::lrcall);
-						lrmemo_stack_.push_back({sr, lrfailcode, imm, pc, pc + off, rc, std::vector<semantic_response>{}});
-					} else {
-						stack_frames_.push_back(stack_frame_type::call);
-						call_stack_.push_back(pc);
-					}
-					pc += off;
-				} break;
-				case opcode::ret: {
-					if (stack_frames_.empty())
-						goto failure;
-					switch (stack_frames_.back()) {
-						case stack_frame_type::call: {
-							pc = call_stack_.back();
-							pop_stack_frame(call_stack_);
-						} break;
-						case stack_frame_type::lrcall: {
-							auto& memo = lrmemo_stack_.back();
-							if (memo.sra == lrfailcode || sr > memo.sra) {
-								memo.sra = sr, memo.responses = drop_responses_after(memo.rcr);
-								sr = memo.srr, pc = memo.pca, rc = memo.rcr;
-								continue;
+					} LUG_VM_NEXT;
+					LUG_VM_CASE(match_octet): {
+						if (!available(sr, 1) || !(*instr->octets)[static_cast<unsigned char>(input_[sr])])
+							goto failure;
+						++sr;
+					} LUG_VM_NEXT;
+					LUG_VM_CASE(match_octets): {
+						if (!available(sr, instr->imm))
+							goto failure;
+						sr += instr->imm;
+					} LUG_VM_NEXT;
+					LUG_VM_CASE(match_field): {
+						auto const width = static_cast<std::size_t>(instr->imm & 0x0f);
+						bool const little_endian = (instr->imm & 0x10) != 0;
+						if (!available(sr, width))
+							goto failure;
+						std::uint64_t length = 0;
+						for (std::size_t i = 0; i < width; ++i)
+							length = (length << 8) | static_cast<unsigned char>(input_[sr + (little_endian ? width - 1 - i : i)]);
+						if (length > (std::numeric_limits<std::size_t>::max)() - sr - width || !available(sr + width, static_cast<std::size_t>(length)))
+							goto failure;
+						sr += width + static_cast<std::size_t>(length);
+					} LUG_VM_NEXT;
+					LUG_VM_CASE(span_octet): {
+						while (available(sr, 1) && (*instr->octets)[static_cast<unsigned char>(input_[sr])])
+							++sr;
+						mr = (std::max)(mr, sr);
+					} LUG_VM_NEXT;
+					LUG_VM_CASE(span_any_of): {
+						sr = match_span(sr, *instr->span, [imm = instr->imm, str = instr->str](char32_t r) { return unicode::any_of(unicode::query(r), static_cast<unicode::property_enum>(imm), str); });
+						mr = (std::max)(mr, sr);
+					} LUG_VM_NEXT;
+					LUG_VM_CASE(span_all_of): {
+						sr = match_span(sr, *instr->span, [imm = instr->imm, str = instr->str](char32_t r) { return unicode::all_of(unicode::query(r), static_cast<unicode::property_enum>(imm), str); });
+						mr = (std::max)(mr, sr);
+					} LUG_VM_NEXT;
+					LUG_VM_CASE(span_none_of): {
+						sr = match_span(sr, *instr->span, [imm = instr->imm, str = instr->str](char32_t r) { return unicode::none_of(unicode::query(r), static_cast<unicode::property_enum>(imm), str); });
+						mr = (std::max)(mr, sr);
+					} LUG_VM_NEXT;
+					LUG_VM_CASE(span_set): {
+						sr = match_span(sr, *instr->span, [&runes = *instr->span->runes](char32_t r) { return runes.contains(r); });
+						mr = (std::max)(mr, sr);
+					} LUG_VM_NEXT;
+					LUG_VM_CASE(skip_space): {
+						sr = match_space(sr);
+						mr = (std::max)(mr, sr);
+					} LUG_VM_NEXT;
+					LUG_VM_CASE(match_eol): {
+						if (!match_single(sr, [](auto curr, auto last, auto& next, char32_t rune) {
+								if (curr == next || (unicode::query(rune).properties() & unicode::ptype::Line_Ending) == unicode::ptype::None)
+									return false;
+								if (U'\r' == rune)
+									if (auto [next2, rune2] = utf8::decode_rune(next, last); next2 != next && rune2 == U'\n')
+										next = next2;
+								return true; }))
+							goto failure;
+					} LUG_VM_NEXT;
+					LUG_VM_CASE(choice): {
+						push_stack_frame(stack_frame_type::backtrack, sr - instr->imm, rc, instr->dst);
+					} LUG_VM_NEXT;
+					LUG_VM_CASE(commit): {
+						if (!commit<opcode::commit>(sr, rc, pc, instr->dst))
+							goto failure;
+					} LUG_VM_NEXT;
+					LUG_VM_CASE(commit_back): {
+						if (!commit<opcode::commit_back>(sr, rc, pc, instr->dst))
+							goto failure;
+					} LUG_VM_NEXT;
+					LUG_VM_CASE(commit_partial): {
+						if (!commit<opcode::commit_partial>(sr, rc, pc, instr->dst))
+							goto failure;
+					} LUG_VM_NEXT;
+					LUG_VM_CASE(jump): {
+						pc = instr->dst;
+					} LUG_VM_NEXT;
+					LUG_VM_CASE(test_set): {
+						if (available(sr, 1) && (*instr->octets)[static_cast<unsigned char>(input_[sr])]) {
+							push_stack_frame(stack_frame_type::backtrack, sr, rc, instr->dst);
+						} else {
+							mr = (std::max)(mr, sr), pc = instr->dst;
+						}
+					} LUG_VM_NEXT;
+					LUG_VM_CASE(jump_table): {
+						auto const& entry = instr->table->entries[available(sr, 1) ? static_cast<unsigned char>(input_[sr]) : 256];
+						for (auto i = entry.first, e = static_cast<unsigned short>(entry.first + entry.count); i != e; ++i) {
+							push_stack_frame(stack_frame_type::backtrack, sr, rc, instr->table->backtracks[i]);
+						}
+						if (entry.mismatch)
+							mr = (std::max)(mr, sr);
+						pc = entry.dst;
+					} LUG_VM_NEXT;
+					LUG_VM_CASE(call): {
+						if constexpr (profiling)
+							++profile_rule(std::ptrdiff_t{instr->dst}).calls;
+						if (auto imm = instr->imm; imm != 0) {
+							auto const srm = lrmemo_stack_.empty() ? 0 : lrmemo_stack_.back().srm;
+							auto memo = lrmemo_stack_.empty() || srm < sr ? lrmemo_stack_.crend() : detail::escaping_find_if(lrmemo_stack_.crbegin(), lrmemo_stack_.crend(),
+									[sr = sr, pca = std::ptrdiff_t{instr->dst}](auto const& m){ return m.srr == sr && m.pca == pca ? 1 : (m.srr < sr ? 0 : -1); });
+							if (memo != lrmemo_stack_.crend()) {
+								if (memo->sra == lrfailcode || imm < memo->prec)
+									goto failure;
+								sr = memo->sra, rc = restore_responses_after(rc, *memo);
+								LUG_VM_NEXT;
 							}
-							sr = memo.sra, pc = memo.pcr, rc = restore_responses_after(memo.rcr, memo.responses);
-							pop_stack_frame(lrmemo_stack_, sr, mr, rc, pc);
-						} break;
-						default: goto failure;
-					}
-				} break;
-				case opcode::fail: {
-					fc = imm;
-				failure:
-					for (mr = (std::max)(mr, sr), ++fc; fc > 0; --fc) {
-						if (done = cut_frame_ >= stack_frames_.size(); done) {
-							registers_ = {sr, mr, rc, pc, 0};
-							break;
+							push_stack_frame(stack_frame_type::lrcall, profile_offset(sr));
+							lrmemo_stack_.push_back({sr, lrfailcode, imm, pc, instr->dst, rc, lrmemo_responses_.size(), 0, (std::max)(srm, sr)});
+							if constexpr (profiling)
+								profile_peaks();
+						} else if (packrat_) {
+							goto memoized_call;
+						} else {
+							push_stack_frame(stack_frame_type::call, profile_offset(sr), 0, pc);
 						}
-						switch (stack_frames_.back()) {
-							case stack_frame_type::backtrack: {
-								std::tie(sr, rc, pc) = backtrack_stack_.back();
-								pop_stack_frame(backtrack_stack_);
-							} break;
+						pc = instr->dst;
+					} LUG_VM_NEXT;
+					LUG_VM_CASE(call_memo): {
+						if constexpr (profiling)
+							++profile_rule(std::ptrdiff_t{instr->dst}).calls;
+					memoized_call:
+						if (!lrmemo_stack_.empty()) {
+							push_stack_frame(stack_frame_type::call, profile_offset(sr), 0, pc);
+						} else if (auto memo = memo_table_.find(std::make_pair(std::ptrdiff_t{instr->dst}, sr)); memo != memo_table_.end()) {
+							mr = (std::max)(mr, memo->second.mra);
+							if (memo->second.sra == lrfailcode)
+								goto failure;
+							sr = memo->second.sra, rc = recall(memo->second, rc);
+							LUG_VM_NEXT;
+						} else {
+							memo_stack_.push_back({sr, mr, rc, pc, instr->dst, frame_depth()});
+							push_stack_frame(stack_frame_type::memocall, profile_offset(sr));
+							mr = 0;
+						}
+						pc = instr->dst;
+					} LUG_VM_NEXT;
+					LUG_VM_CASE(ret): {
+						if (stack_frames_.empty())
+							goto failure;
+						switch (stack_frames_.back().type) {
 							case stack_frame_type::call: {
-								pop_stack_frame(call_stack_), ++fc;
-							} break;
-							case stack_frame_type::capture: {
-								pop_stack_frame(capture_stack_, sr, mr, rc, pc), ++fc;
+								if constexpr (profiling)
+									profile_rule(stack_frames_.back()).bytes_consumed += profile_offset(sr) - stack_frames_.back().sr;
+								pc = stack_frames_.back().pc;
+								pop_stack_frame<stack_frame_type::call>();
 							} break;
 							case stack_frame_type::lrcall: {
-								if (auto& memo = lrmemo_stack_.back(); memo.sra != lrfailcode)
-									sr = memo.sra, pc = memo.pcr, rc = restore_responses_after(memo.rcr, memo.responses);
-								else
-									++fc;
-								pop_stack_frame(lrmemo_stack_, sr, mr, rc, pc);
+								auto& memo = lrmemo_stack_.back();
+								if (memo.sra == lrfailcode || sr > memo.sra) {
+									if constexpr (profiling)
+										profile_rule(memo.pca).regrowths += memo.sra != lrfailcode ? 1 : 0;
+									memo.sra = sr;
+									drop_responses_after(memo);
+									sr = memo.srr, pc = memo.pca, rc = memo.rcr;
+									LUG_VM_NEXT;
+								}
+								sr = memo.sra, pc = memo.pcr, rc = restore_responses_after(memo.rcr, memo);
+								if constexpr (profiling)
+									profile_rule(memo.pca).bytes_consumed += profile_offset(sr) - stack_frames_.back().sr;
+								pop_stack_frame<stack_frame_type::lrcall>(sr, mr, rc, pc);
 							} break;
-							default: break;
+							case stack_frame_type::memocall: {
+								auto const& frame = memo_stack_.back();
+								if constexpr (profiling)
+									profile_rule(frame.pca).bytes_consumed += profile_offset(sr) - stack_frames_.back().sr;
+								memoize(frame, sr, mr, rc);
+								mr = (std::max)(frame.mrr, mr), pc = frame.pcr;
+								pop_stack_frame<stack_frame_type::memocall>();
+							} break;
+							default: goto failure;
 						}
-					}
-					pop_responses_after(rc);
-				} break;
-				case opcode::accept: {
-					if (cut_deferred_ = !capture_stack_.empty() || !lrmemo_stack_.empty(); !cut_deferred_) {
+					} LUG_VM_NEXT;
+					LUG_VM_CASE(fail): {
+						fc = instr->imm;
+					failure:
+						for (mr = (std::max)(mr, sr), ++fc; fc > 0; --fc) {
+							if (cut_frame_ >= stack_frames_.size()) {
+								registers_ = {sr, mr, rc, pc, 0};
+								pop_responses_after(rc);
+								suspendable_ = false;
+								return parse_status::failed;
+							}
+							switch (auto const& frame = stack_frames_.back(); frame.type) {
+								case stack_frame_type::backtrack: {
+									sr = frame.sr, rc = frame.rc, pc = frame.pc;
+									pop_stack_frame<stack_frame_type::backtrack>();
+								} break;
+								case stack_frame_type::call: {
+									if constexpr (profiling)
+										++profile_rule(frame).backtracks;
+									pop_stack_frame<stack_frame_type::call>(), ++fc;
+								} break;
+								case stack_frame_type::capture: {
+									pop_stack_frame<stack_frame_type::capture>(), ++fc;
+								} break;
+								case stack_frame_type::lrcall: {
+									if (auto const& memo = lrmemo_stack_.back(); memo.sra != lrfailcode) {
+										sr = memo.sra, pc = memo.pcr, rc = restore_responses_after(memo.rcr, memo);
+										if constexpr (profiling)
+											profile_rule(memo.pca).bytes_consumed += profile_offset(sr) - frame.sr;
+									} else {
+										if constexpr (profiling)
+											++profile_rule(memo.pca).backtracks;
+										++fc;
+									}
+									pop_stack_frame<stack_frame_type::lrcall>();
+								} break;
+								case stack_frame_type::memocall: {
+									auto const& memo = memo_stack_.back();
+									if constexpr (profiling)
+										++profile_rule(memo.pca).backtracks;
+									memoize(memo, lrfailcode, mr, memo.rcr);
+									mr = (std::max)(memo.mrr, mr);
+									pop_stack_frame<stack_frame_type::memocall>(), ++fc;
+								} break;
+								default: break;
+							}
+						}
+						pop_responses_after(rc);
+					} LUG_VM_NEXT;
+					LUG_VM_CASE(accept): {
+						if (cut_deferred_ = capture_depth_ != 0 || !lrmemo_stack_.empty(); !cut_deferred_) {
+							accept(sr, mr, rc, pc);
+							std::tie(sr, mr, rc, pc, std::ignore) = drain();
+						}
+					} LUG_VM_NEXT;
+					LUG_VM_CASE(accept_final): {
+						suspendable_ = false;
 						accept(sr, mr, rc, pc);
-						std::tie(sr, mr, rc, pc, std::ignore) = drain();
+						return parse_status::complete;
 					}
-				} break;
-				case opcode::accept_final: {
-					accept(sr, mr, rc, pc);
-					result = done = true;
-				} break;
-				case opcode::predicate: {
-					registers_ = {sr, (std::max)(mr, sr), rc, pc, 0};
-					bool accepted = prog.predicates[imm](*this);
-					std::tie(sr, mr, rc, pc, fc) = registers_.as_tuple();
-					pop_responses_after(rc);
-					if (!accepted)
-						goto failure;
-				} break;
-				case opcode::action: {
-					rc = push_response(call_stack_.size() + lrmemo_stack_.size(), imm);
-				} break;
-				case opcode::begin: {
-					stack_frames_.push_back(stack_frame_type::capture);
-					capture_stack_.push_back(static_cast<subject_location>(sr));
-				} break;
-				case opcode::end: {
-					if (stack_frames_.empty() || stack_frames_.back() != stack_frame_type::capture)
-						goto failure;
-					auto sr0 = static_cast<std::size_t>(capture_stack_.back()), sr1 = sr;
-					pop_stack_frame(capture_stack_, sr, mr, rc, pc);
-					if (sr0 > sr1)
-						goto failure;
-					rc = push_response(call_stack_.size() + lrmemo_stack_.size(), imm, {sr0, sr1 - sr0});
-				} break;
-				default: registers_ = {sr, (std::max)(mr, sr), rc, pc, 0}; throw bad_opcode{};
+					LUG_VM_CASE(predicate): {
+						registers_ = {sr, (std::max)(mr, sr), rc, pc, 0};
+						bool accepted = prog.predicates[instr->imm](*this);
+						std::tie(sr, mr, rc, pc, fc) = registers_.as_tuple();
+						pop_responses_after(rc);
+						if (!accepted)
+							goto failure;
+					} LUG_VM_NEXT;
+					LUG_VM_CASE(action): {
+						rc = push_response(frame_depth(), instr->imm);
+						if (streaming_ && rc >= stream_threshold_)
+							stream(sr, mr, rc, pc);
+					} LUG_VM_NEXT;
+					LUG_VM_CASE(begin): {
+						push_stack_frame(stack_frame_type::capture, sr);
+					} LUG_VM_NEXT;
+					LUG_VM_CASE(end): {
+						if (stack_frames_.empty() || stack_frames_.back().type != stack_frame_type::capture || stack_frames_.back().sr > sr)
+							goto failure;
+						rc = push_response(frame_depth(), instr->imm, {stack_frames_.back().sr, sr - stack_frames_.back().sr});
+						pop_stack_frame<stack_frame_type::capture>(sr, mr, rc, pc);
+						if (streaming_ && rc >= stream_threshold_)
+							stream(sr, mr, rc, pc);
+					} LUG_VM_NEXT;
+					default: registers_ = {sr, (std::max)(mr, sr), rc, pc, 0}; throw bad_opcode{};
+				}
 			}
+		} catch (suspension const&) {
+			registers_ = {sr, mr, rc, pc - 1, fc};
+			suspendable_ = false;
+			return parse_status::needs_input;
 		}
-		return result;
+#undef LUG_VM_COUNT
+#undef LUG_VM_NEXT
+#undef LUG_VM_CASE
 	}
+
+LUG_DIAGNOSTIC_POP
 };
 
 template <class InputIt, class = utf8::enable_if_char_input_iterator_t<InputIt>>
@@ -1318,41 +2997,70 @@ inline bool parse(InputIt first, InputIt last, grammar const& grmr)
 	return parse(first, last, grmr, envr);
 }
 
-inline bool parse(std::istream& input, grammar const& grmr, environment& envr)
+class istream_source
 {
-	return parser{grmr, envr}.push_source([&input](std::string& line) {
-		if (std::getline(input, line)) {
-			line.push_back('\n');
-			return true;
+	std::istream& input_;
+	source_options options_;
+	std::size_t block_size_;
+public:
+	static constexpr std::size_t default_block_size = 65536;
+
+	explicit istream_source(std::istream& input, source_options opt = source_options::none, std::size_t block_size = default_block_size)
+		: input_{input}, options_{opt}, block_size_{(std::max)(block_size, std::size_t{1})} {}
+
+	bool chunked() const noexcept { return (options_ & source_options::interactive) == source_options::none; }
+
+	bool operator()(std::string& text)
+	{
+		if ((options_ & source_options::interactive) != source_options::none) {
+			if (std::getline(input_, text)) {
+				text.push_back('\n');
+				return true;
+			}
+			return false;
 		}
-		return false;
-	}).parse();
+		auto const buf = input_.rdbuf();
+		if (!buf || !input_.good())
+			return false;
+		text.resize(block_size_);
+		auto const n = static_cast<std::size_t>((std::max)(buf->sgetn(text.data(), static_cast<std::streamsize>(block_size_)), std::streamsize{0}));
+		text.resize(n);
+		if (n < block_size_)
+			input_.setstate(std::ios_base::eofbit);
+		return n == block_size_;
+	}
+};
+
+inline bool parse(std::istream& input, grammar const& grmr, environment& envr, source_options opt = source_options::none)
+{
+	return parser{grmr, envr}.push_source(istream_source{input, opt}).parse();
 }
 
-inline bool parse(std::istream& input, grammar const& grmr)
+inline bool parse(std::istream& input, grammar const& grmr, source_options opt = source_options::none)
 {
 	environment envr;
-	return parse(input, grmr, envr);
+	return parse(input, grmr, envr, opt);
 }
 
 inline bool parse(std::string_view sv, grammar const& grmr, environment& envr)
 {
-	return parse(sv.cbegin(), sv.cend(), grmr, envr);
+	return parser{grmr, envr}.bind(sv).parse();
 }
 
 inline bool parse(std::string_view sv, grammar const& grmr)
 {
-	return parse(sv.cbegin(), sv.cend(), grmr);
+	environment envr;
+	return parse(sv, grmr, envr);
 }
 
 inline bool parse(grammar const& grmr, environment& envr)
 {
-	return parse(std::cin, grmr, envr);
+	return parse(std::cin, grmr, envr, source_options::interactive);
 }
 
 inline bool parse(grammar const& grmr)
 {
-	return parse(std::cin, grmr);
+	return parse(std::cin, grmr, source_options::interactive);
 }
 
 inline std::string_view syntax::capture() const { return parser_.match().substr(range_.index, range_.size); }
@@ -1389,13 +3097,17 @@ LUG_DIAGNOSTIC_POP
 
 inline void basic_regular_expression::operator()(encoder& d) const
 {
-	if (program_->instructions.empty()) {
+	auto const mode = d.mode() & (directives::caseless | directives::octet);
+	auto& compiled = (*compiled_)[((mode & directives::caseless) != directives::none ? 1 : 0) | ((mode & directives::octet) != directives::none ? 2 : 0)];
+	std::call_once(compiled.once, [this, &compiled, mode] {
 		static grammar const grmr = make_grammar();
-		generator genr(*this, d.mode() & directives::caseless);
+		compiled.program = program{};
+		generator genr(*this, compiled.program, mode);
 		if (!parse(expression_, grmr, genr))
 			throw bad_string_expression{};
-	}
-	d.skip((program_->mandate & directives::eps) ^ directives::eps).append(*program_);
+	});
+	auto const& prog = compiled.program;
+	d.skip((prog.mandate & directives::eps) ^ directives::eps).append(prog);
 }
 
 } // namespace lug
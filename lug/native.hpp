@@ -0,0 +1,361 @@
+// lug - Embedded DSL for PE grammar parser combinators in C++
+// Copyright (c) 2017 Jesse W. Towner
+// See LICENSE.md file for license details
+
+#ifndef LUG_NATIVE_HPP__
+#define LUG_NATIVE_HPP__
+
+#include <lug/lug.hpp>
+
+namespace lug::native
+{
+
+template <class Environment>
+class context
+{
+	struct response { void (*invoke)(void const*, Environment&, std::string_view); void const* action; std::size_t first, last; };
+	std::string_view input_;
+	std::size_t position_{0};
+	std::vector<response> responses_;
+
+public:
+	using environment_type = Environment;
+	explicit context(std::string_view input) noexcept : input_{input} {}
+	std::string_view input() const noexcept { return input_; }
+	std::string_view remaining() const noexcept { return input_.substr(position_); }
+	std::size_t position() const noexcept { return position_; }
+	void advance(std::size_t n) noexcept { position_ += n; }
+	auto save() const noexcept { return std::make_pair(position_, responses_.size()); }
+	void restore(std::pair<std::size_t, std::size_t> s) noexcept { position_ = s.first; responses_.resize(s.second); }
+	void defer(void (*invoke)(void const*, Environment&, std::string_view), void const* action, std::size_t first) { responses_.push_back({invoke, action, first, position_}); }
+
+	void accept(Environment& envr)
+	{
+		for (auto const& r : responses_)
+			r.invoke(r.action, envr, input_.substr(r.first, r.last - r.first));
+		responses_.clear();
+	}
+
+	template <class Match>
+	bool match_rune(Match&& m)
+	{
+		auto const rest = remaining();
+		if (rest.empty())
+			return false;
+		if (auto const octet = static_cast<unsigned char>(rest.front()); octet < 0x80) {
+			if (!m(static_cast<char32_t>(octet)))
+				return false;
+			++position_;
+			return true;
+		}
+		auto const [next, rune] = utf8::decode_rune(rest.begin(), rest.end());
+		if (!m(rune))
+			return false;
+		position_ += static_cast<std::size_t>(next - rest.begin());
+		return true;
+	}
+};
+
+struct expression_base {};
+template <class E> constexpr bool is_expression_v = std::is_base_of_v<expression_base, std::decay_t<E>>;
+template <class E> constexpr bool is_operand_v = is_expression_v<E> || std::is_convertible_v<E const&, std::string_view> || std::is_same_v<std::decay_t<E>, char> || std::is_same_v<std::decay_t<E>, char32_t>;
+
+struct literal : expression_base
+{
+	std::string_view text;
+	constexpr explicit literal(std::string_view s) noexcept : text{s} {}
+	template <class Context> bool match(Context& c) const { return c.remaining().substr(0, text.size()) == text ? (c.advance(text.size()), true) : false; }
+};
+
+struct string_literal : expression_base
+{
+	std::string text;
+	explicit string_literal(std::string s) noexcept : text{std::move(s)} {}
+	template <class Context> bool match(Context& c) const { return c.remaining().substr(0, text.size()) == text ? (c.advance(text.size()), true) : false; }
+};
+
+struct rune_range : expression_base
+{
+	char32_t first, last;
+	constexpr rune_range(char32_t f, char32_t l) noexcept : first{f}, last{l} {}
+	template <class Context> bool match(Context& c) const { return c.match_rune([this](char32_t r) { return first <= r && r <= last; }); }
+};
+
+template <unicode::ctype Property>
+struct ctype_class : expression_base
+{
+	template <class Context> bool match(Context& c) const { return c.match_rune([](char32_t r) { return unicode::query(r).any_of(Property); }); }
+};
+
+struct any_rune : expression_base
+{
+	template <class Context> bool match(Context& c) const { return c.match_rune([](char32_t) { return true; }); }
+};
+
+struct end_of_input : expression_base
+{
+	template <class Context> bool match(Context& c) const { return c.remaining().empty(); }
+};
+
+struct empty : expression_base
+{
+	template <class Context> bool match(Context&) const { return true; }
+};
+
+struct end_of_line : expression_base
+{
+	template <class Context> bool match(Context& c) const
+	{
+		bool cr = false;
+		if (!c.match_rune([&cr](char32_t r) { cr = r == U'\r'; return (unicode::query(r).properties() & unicode::ptype::Line_Ending) != unicode::ptype::None; }))
+			return false;
+		if (cr && !c.remaining().empty() && c.remaining().front() == '\n')
+			c.advance(1);
+		return true;
+	}
+};
+
+template <class R>
+struct reference : expression_base
+{
+	R const* target;
+	template <class Context> bool match(Context& c) const { return target->match(c); }
+};
+
+template <class E>
+constexpr auto make_expression(E const& e)
+{
+	static_assert(is_operand_v<E>, "E must be a native expression, string or character");
+	if constexpr (std::is_same_v<std::decay_t<E>, char> || std::is_same_v<std::decay_t<E>, char32_t>)
+		return rune_range{static_cast<char32_t>(e), static_cast<char32_t>(e)};
+	else if constexpr ((std::is_pointer_v<std::decay_t<E>> || std::is_same_v<std::decay_t<E>, std::string_view>) && !is_expression_v<E>)
+		return literal{std::string_view{e}};
+	else if constexpr (std::is_convertible_v<E const&, std::string_view> && !is_expression_v<E>)
+		return string_literal{std::string{std::string_view{e}}};
+	else if constexpr (std::is_copy_constructible_v<E>)
+		return e;
+	else
+		return reference<E>{{}, std::addressof(e)};
+}
+
+template <class E1, class E2>
+struct sequence : expression_base
+{
+	E1 e1; E2 e2;
+	constexpr sequence(E1 x1, E2 x2) : e1{std::move(x1)}, e2{std::move(x2)} {}
+	template <class Context> bool match(Context& c) const
+	{
+		auto const s = c.save();
+		if (e1.match(c) && e2.match(c))
+			return true;
+		c.restore(s);
+		return false;
+	}
+};
+
+template <class E1, class E2>
+struct ordered_choice : expression_base
+{
+	E1 e1; E2 e2;
+	constexpr ordered_choice(E1 x1, E2 x2) : e1{std::move(x1)}, e2{std::move(x2)} {}
+	template <class Context> bool match(Context& c) const
+	{
+		return e1.match(c) || e2.match(c);
+	}
+};
+
+template <class E>
+struct zero_or_many : expression_base
+{
+	E e;
+	constexpr explicit zero_or_many(E x) : e{std::move(x)} {}
+	template <class Context> bool match(Context& c) const
+	{
+		for (auto s = c.save(); e.match(c) && c.position() != s.first; s = c.save()) {}
+		return true;
+	}
+};
+
+template <class E>
+struct optional : expression_base
+{
+	E e;
+	constexpr explicit optional(E x) : e{std::move(x)} {}
+	template <class Context> bool match(Context& c) const { e.match(c); return true; }
+};
+
+template <class E, bool Expected>
+struct lookahead : expression_base
+{
+	E e;
+	constexpr explicit lookahead(E x) : e{std::move(x)} {}
+	template <class Context> bool match(Context& c) const
+	{
+		auto const s = c.save();
+		bool const matched = e.match(c);
+		c.restore(s);
+		return matched == Expected;
+	}
+};
+
+template <class E, class A>
+struct action : expression_base
+{
+	E e; A a;
+	constexpr action(E x, A y) : e{std::move(x)}, a{std::move(y)} {}
+
+	template <class Environment>
+	static void invoke(void const* self, Environment& envr, std::string_view capture)
+	{
+		auto const& f = static_cast<action const*>(self)->a;
+		if constexpr (std::is_invocable_v<A const&, Environment&, std::string_view>)
+			f(envr, capture);
+		else if constexpr (std::is_invocable_v<A const&, std::string_view>)
+			f(capture);
+		else if constexpr (std::is_invocable_v<A const&, Environment&>)
+			f(envr);
+		else
+			f();
+	}
+
+	template <class Context> bool match(Context& c) const
+	{
+		auto const first = c.position();
+		if (!e.match(c))
+			return false;
+		c.defer(&invoke<typename Context::environment_type>, this, first);
+		return true;
+	}
+};
+
+template <class Environment = lug::environment>
+class rule : public expression_base
+{
+	using context_type = context<Environment>;
+	bool (*match_)(void const*, context_type&) = nullptr;
+	std::shared_ptr<void const> expression_;
+
+public:
+	rule() = default;
+	rule(rule const&) = delete;
+	rule& operator=(rule const&) = delete;
+
+	template <class E, class = std::enable_if_t<is_operand_v<E> && !std::is_same_v<std::decay_t<E>, rule>>>
+	rule(E const& e) { *this = e; }
+
+	template <class E, class = std::enable_if_t<is_operand_v<E> && !std::is_same_v<std::decay_t<E>, rule>>>
+	rule& operator=(E const& e)
+	{
+		using X = decltype(make_expression(e));
+		expression_ = std::make_shared<X const>(make_expression(e));
+		match_ = [](void const* x, context_type& c) { return static_cast<X const*>(x)->match(c); };
+		return *this;
+	}
+
+	bool match(context_type& c) const
+	{
+		if (!match_)
+			throw bad_grammar{};
+		return match_(expression_.get(), c);
+	}
+};
+
+template <class E, class Environment>
+inline bool parse(E const& e, std::string_view input, Environment& envr)
+{
+	context<Environment> c{input};
+	auto const x = make_expression(e);
+	if (!x.match(c))
+		return false;
+	c.accept(envr);
+	return true;
+}
+
+template <class E>
+inline bool parse(E const& e, std::string_view input)
+{
+	lug::environment envr;
+	return parse(e, input, envr);
+}
+
+namespace language
+{
+
+using unicode::ctype;
+template <class Environment = lug::environment> using rule = native::rule<Environment>;
+constexpr empty eps = {};
+constexpr end_of_input eoi = {};
+constexpr end_of_line eol = {};
+constexpr any_rune any = {};
+constexpr ctype_class<ctype::alpha> alpha = {}; constexpr ctype_class<ctype::alnum> alnum = {}; constexpr ctype_class<ctype::lower> lower = {};
+constexpr ctype_class<ctype::upper> upper = {}; constexpr ctype_class<ctype::digit> digit = {}; constexpr ctype_class<ctype::xdigit> xdigit = {};
+constexpr ctype_class<ctype::space> space = {}; constexpr ctype_class<ctype::blank> blank = {}; constexpr ctype_class<ctype::punct> punct = {};
+constexpr ctype_class<ctype::graph> graph = {}; constexpr ctype_class<ctype::print> print = {};
+
+constexpr struct
+{
+	constexpr auto operator()(char32_t c) const noexcept { return rune_range{c, c}; }
+	constexpr auto operator()(char32_t start, char32_t end) const noexcept { return rune_range{start, end}; }
+}
+chr = {};
+
+constexpr struct
+{
+	template <class S, class = std::enable_if_t<std::is_convertible_v<S const&, std::string_view>>>
+	constexpr auto operator()(S const& s) const { return make_expression(s); }
+}
+str = {};
+
+} // namespace language
+
+template <class E1, class E2, class = std::enable_if_t<(is_expression_v<E1> || is_expression_v<E2>) && is_operand_v<E1> && is_operand_v<E2>>>
+constexpr auto operator>(E1 const& e1, E2 const& e2)
+{
+	return sequence<decltype(make_expression(e1)), decltype(make_expression(e2))>{make_expression(e1), make_expression(e2)};
+}
+
+template <class E1, class E2, class = std::enable_if_t<(is_expression_v<E1> || is_expression_v<E2>) && is_operand_v<E1> && is_operand_v<E2>>>
+constexpr auto operator|(E1 const& e1, E2 const& e2)
+{
+	return ordered_choice<decltype(make_expression(e1)), decltype(make_expression(e2))>{make_expression(e1), make_expression(e2)};
+}
+
+template <class E, class = std::enable_if_t<is_expression_v<E>>>
+constexpr auto operator*(E const& e)
+{
+	return zero_or_many<decltype(make_expression(e))>{make_expression(e)};
+}
+
+template <class E, class = std::enable_if_t<is_expression_v<E>>>
+constexpr auto operator+(E const& e)
+{
+	return e > *e;
+}
+
+template <class E, class = std::enable_if_t<is_expression_v<E>>>
+constexpr auto operator~(E const& e)
+{
+	return optional<decltype(make_expression(e))>{make_expression(e)};
+}
+
+template <class E, class = std::enable_if_t<is_expression_v<E>>>
+constexpr auto operator!(E const& e)
+{
+	return lookahead<decltype(make_expression(e)), false>{make_expression(e)};
+}
+
+template <class E, class = std::enable_if_t<is_expression_v<E>>>
+constexpr auto operator&(E const& e)
+{
+	return lookahead<decltype(make_expression(e)), true>{make_expression(e)};
+}
+
+template <class E, class A, class = std::enable_if_t<is_expression_v<E> && !is_operand_v<A>>>
+constexpr auto operator<(E const& e, A a)
+{
+	return action<decltype(make_expression(e)), A>{make_expression(e), std::move(a)};
+}
+
+} // namespace lug::native
+
+#endif
@@ -0,0 +1,99 @@
+// lug - Embedded DSL for PE grammar parser combinators in C++
+// Copyright (c) 2017 Jesse W. Towner
+// See LICENSE.md file for license details
+
+#ifndef LUG_POSIX_HPP__
+#define LUG_POSIX_HPP__
+
+#include <lug/lug.hpp>
+#include <cerrno>
+#include <system_error>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace lug::posix
+{
+
+class mapped_file
+{
+	void* data_{nullptr};
+	std::size_t size_{0};
+
+	[[noreturn]] static void raise_error(int fd, char const* path)
+	{
+		int const error = errno;
+		if (fd >= 0)
+			::close(fd);
+		throw std::system_error{error, std::generic_category(), path};
+	}
+
+public:
+	mapped_file() = default;
+	mapped_file(mapped_file const&) = delete;
+	mapped_file(mapped_file&& m) noexcept : data_{m.data_}, size_{m.size_} { m.data_ = nullptr, m.size_ = 0; }
+	mapped_file& operator=(mapped_file const&) = delete;
+	mapped_file& operator=(mapped_file&& m) noexcept { mapped_file{std::move(m)}.swap(*this); return *this; }
+	~mapped_file() { if (data_) ::munmap(data_, size_); }
+	void swap(mapped_file& m) noexcept { std::swap(data_, m.data_); std::swap(size_, m.size_); }
+	char const* data() const noexcept { return static_cast<char const*>(data_); }
+	std::size_t size() const noexcept { return size_; }
+	std::string_view view() const noexcept { return {data(), size_}; }
+
+	explicit mapped_file(char const* path)
+	{
+		int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+		if (fd < 0)
+			raise_error(fd, path);
+		struct ::stat st;
+		if (::fstat(fd, &st) != 0)
+			raise_error(fd, path);
+		if (st.st_size > 0) {
+			void* p = ::mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+			if (p == MAP_FAILED)
+				raise_error(fd, path);
+			::madvise(p, static_cast<std::size_t>(st.st_size), MADV_SEQUENTIAL);
+			data_ = p, size_ = static_cast<std::size_t>(st.st_size);
+		}
+		::close(fd);
+	}
+};
+
+class fd_source
+{
+	int fd_;
+	std::size_t block_size_;
+public:
+	explicit fd_source(int fd, std::size_t block_size = istream_source::default_block_size)
+		: fd_{fd}, block_size_{(std::max)(block_size, std::size_t{1})} {}
+
+	bool chunked() const noexcept { return true; }
+
+	bool operator()(std::string& text)
+	{
+		text.resize(block_size_);
+		::ssize_t n;
+		do {
+			n = ::read(fd_, text.data(), block_size_);
+		} while (n < 0 && errno == EINTR);
+		if (n < 0)
+			throw std::system_error{errno, std::generic_category(), "read"};
+		text.resize(static_cast<std::size_t>(n));
+		return n > 0;
+	}
+};
+
+inline bool parse(mapped_file const& file, grammar const& grmr, environment& envr)
+{
+	return lug::parse(file.view(), grmr, envr);
+}
+
+inline bool parse(mapped_file const& file, grammar const& grmr)
+{
+	return lug::parse(file.view(), grmr);
+}
+
+} // namespace lug::posix
+
+#endif
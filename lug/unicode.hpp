@@ -655,13 +655,9 @@ class record
 		std::uint_least8_t cuindex;
 	} const* raw_;
 	explicit record(raw_record const* r) noexcept : raw_(r) {}
-	struct raw_record_table {
-		std::array<std::uint_least16_t, 8704> stage1;
-		std::array<std::uint_least16_t, 34176> stage2;
-		std::array<raw_record, 1586> records;
-	};
 	static std::int_least32_t case_mapping(std::size_t index) noexcept;
-	static std::unique_ptr<raw_record_table> decompress_table();
+	static raw_record const* latin1_record(char32_t r) noexcept;
+	static raw_record const* table_record(char32_t r) noexcept;
 	friend record query(char32_t r);
 public:
 	ctype compatibility() const noexcept { return static_cast<ctype>(raw_->cflags); }
@@ -689,13 +685,9 @@ public:
 // Retrieves the UCD record for the given codepoint
 inline record query(char32_t r)
 {
-	static auto const table = record::decompress_table();
-	std::size_t index = 1585;
-	if (r < 0x110000) {
-		index = table->stage1[r >> 7];
-		index = table->stage2[(index << 7) | (r & 0x7f)];
-	}
-	return record{table->records.data() + index};
+	if (r < 0x100)
+		return record{record::latin1_record(r)};
+	return record{record::table_record(r)};
 }
 
 // Checks if the rune matches all of the string-packed property classes
@@ -1238,672 +1230,2711 @@ inline std::int_least32_t record::case_mapping(std::size_t index) noexcept
 	return casemappings[index];
 }
 
-inline std::unique_ptr<record::raw_record_table> record::decompress_table()
+inline record::raw_record const* record::latin1_record(char32_t r) noexcept
 {
-	using detail::run_length_decode;
-	using lug::detail::make_member_accessor;
-
-	static constexpr std::array<std::uint_least16_t, 384> rlestage1 =
-	{
-		0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
-		33, 34, 35, 36, 37, 38, 39, 40, 49154, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61,
-		62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 49153, 78, 79, 80, 49153, 79, 81, 82, 83, 84, 85, 86, 87,
-		88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 49202, 99, 100, 49314, 101, 102, 103, 49159, 104, 105, 49153, 106, 107, 108,
-		109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 49238, 119, 120, 49167, 121, 49201, 122, 49153, 123, 124, 125, 126, 127,
-		128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 140, 49153, 147, 148, 140,
-		149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 49153, 140, 159, 49154, 140, 160, 161, 162, 163, 164, 165, 166, 140, 167,
-		168, 140, 169, 170, 171, 172, 49153, 140, 173, 49153, 140, 174, 175, 49153, 140, 176, 177, 178, 49156, 140, 49157, 179, 180,
-		181, 182, 183, 184, 49172, 140, 49159, 185, 186, 49182, 140, 49155, 187, 188, 49218, 140, 49155, 189, 190, 191, 192, 193,
-		49157, 140, 194, 195, 49198, 196, 197, 49156, 196, 198, 49225, 140, 199, 200, 201, 49153, 202, 203, 49169, 140, 204, 205,
-		49189, 140, 206, 207, 208, 209, 210, 140, 211, 140, 212, 213, 214, 215, 216, 217, 218, 219, 49155, 220, 221, 222, 49161,
-		140, 223, 49166, 140, 224, 225, 226, 49160, 140, 227, 228, 49153, 140, 229, 230, 231, 232, 233, 140, 234, 235, 236, 237,
-		238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 49162, 140, 248, 49484, 249, 250, 49183, 251, 252, 253, 254, 49195, 255,
-		256, 49208, 257, 258, 49175, 140, 49155, 259, 260, 49161, 140, 248, 49662, 140, 248, 49662, 140, 248, 49662, 140, 248, 49662,
-		140, 248, 49662, 140, 248, 49662, 140, 248, 49662, 140, 248, 49662, 140, 248, 49662, 140, 248, 49662, 140, 248, 49662, 140,
-		248, 261, 262, 263, 264, 49179, 262, 49630, 140, 248, 49662, 265, 266, 49662, 265, 266
-	};
-
-	static constexpr std::array<std::uint_least16_t, 5922> rlestage2 =
-	{
-		0, 49159, 1, 2, 49155, 3, 49169, 1, 4, 5, 6, 7, 8, 49153, 7, 9, 10, 11, 7, 12, 13, 14, 15, 7, 49161, 16, 17, 13, 49154, 12,
-		5, 7, 49157, 18, 49171, 19, 10, 7, 11, 20, 21, 22, 49157, 23, 49153, 24, 49153, 25, 49167, 24, 10, 12, 11, 12, 1, 49156,
-		26, 27, 49177, 26, 28, 29, 49155, 30, 31, 29, 32, 31, 33, 34, 35, 36, 31, 32, 31, 35, 49153, 37, 32, 38, 29, 39, 32, 37,
-		33, 40, 49154, 37, 29, 49174, 41, 35, 49158, 41, 42, 49174, 43, 35, 49158, 43, 44, 65535, 23, 45, 46, 45, 47, 48, 49, 65535,
-		3, 45, 46, 50, 65535, 8, 45, 46, 51, 65535, 23, 45, 46, 52, 65535, 3, 45, 46, 53, 54, 55, 45, 46, 45, 46, 56, 45, 46, 49153,
-		57, 45, 46, 50, 58, 59, 60, 45, 46, 57, 61, 62, 63, 64, 45, 46, 65, 50, 63, 66, 67, 68, 65535, 3, 45, 46, 69, 45, 46, 69,
-		49153, 50, 45, 46, 69, 45, 46, 49153, 70, 45, 46, 45, 46, 71, 45, 46, 50, 72, 45, 46, 50, 73, 49155, 72, 74, 75, 76, 74,
-		75, 76, 74, 75, 76, 65535, 8, 45, 46, 77, 65535, 9, 45, 46, 49, 74, 75, 76, 45, 46, 78, 79, 80, 81, 65535, 15, 45, 46, 65535,
-		4, 80, 81, 82, 83, 65535, 9, 80, 81, 49154, 83, 49154, 84, 85, 86, 87, 88, 89, 49153, 90, 86, 91, 92, 93, 94, 95, 91, 95,
-		96, 65535, 3, 95, 91, 97, 98, 99, 100, 101, 50, 49153, 102, 50, 103, 50, 104, 105, 49154, 50, 102, 106, 50, 107, 50, 108,
-		109, 50, 110, 111, 109, 112, 113, 49153, 50, 111, 50, 114, 115, 49153, 50, 116, 49158, 50, 117, 49153, 50, 118, 49153, 50,
-		118, 49154, 50, 119, 118, 120, 49153, 121, 122, 49156, 50, 123, 50, 72, 49159, 50, 124, 125, 49161, 50, 49156, 126, 49153,
-		83, 49153, 127, 128, 49157, 127, 49158, 129, 49153, 130, 49155, 32, 49161, 129, 49153, 131, 49164, 32, 132, 49156, 127, 49156,
-		32, 49153, 133, 134, 132, 134, 49168, 135, 49220, 136, 137, 49160, 138, 139, 49159, 140, 49156, 141, 49154, 140, 49153, 136,
-		138, 49164, 142, 143, 144, 143, 144, 129, 145, 143, 144, 49153, 146, 147, 49154, 148, 149, 150, 49155, 146, 145, 32, 151,
-		152, 49154, 153, 146, 154, 146, 49153, 155, 156, 49168, 157, 146, 49160, 157, 158, 49154, 159, 156, 49168, 160, 161, 49160,
-		160, 162, 49153, 163, 164, 165, 166, 167, 49153, 168, 169, 170, 171, 172, 173, 65535, 4, 174, 175, 65535, 7, 176, 177, 178,
-		179, 180, 181, 182, 183, 184, 185, 186, 187, 185, 186, 188, 49154, 189, 190, 49163, 191, 190, 49153, 191, 49183, 192, 49183,
-		193, 194, 49156, 195, 196, 195, 196, 49155, 195, 194, 49153, 195, 65535, 17, 197, 198, 199, 49153, 200, 49153, 201, 202,
-		49153, 203, 204, 205, 206, 207, 206, 207, 65535, 24, 197, 198, 208, 197, 198, 197, 198, 204, 205, 197, 198, 204, 205, 197,
-		198, 204, 205, 209, 65535, 14, 197, 198, 206, 207, 65535, 4, 197, 198, 210, 211, 197, 198, 65535, 3, 212, 213, 65535, 8,
-		204, 205, 212, 213, 212, 213, 65535, 8, 214, 215, 216, 217, 218, 219, 65535, 4, 220, 221, 222, 49189, 223, 49153, 222, 224,
-		49157, 225, 222, 49189, 226, 227, 222, 228, 229, 49153, 222, 49153, 230, 231, 232, 49168, 233, 234, 49164, 233, 49161, 235,
-		236, 49154, 235, 237, 235, 238, 49153, 235, 239, 240, 241, 242, 241, 49159, 232, 49178, 243, 49156, 232, 49154, 243, 238,
-		244, 49162, 232, 49155, 245, 246, 247, 49154, 248, 49153, 249, 250, 251, 252, 49153, 253, 49157, 254, 49156, 255, 251, 256,
-		257, 258, 259, 260, 49177, 261, 49156, 262, 263, 49161, 261, 49159, 264, 49154, 265, 254, 266, 267, 49157, 268, 269, 49161,
-		270, 49155, 271, 49153, 272, 273, 49222, 261, 49153, 274, 49156, 261, 274, 49166, 261, 274, 49155, 261, 275, 261, 49158,
-		276, 277, 278, 49153, 279, 49155, 276, 49153, 280, 49153, 276, 278, 49154, 279, 276, 49153, 281, 49161, 270, 49154, 274,
-		49153, 282, 281, 49154, 283, 49159, 284, 285, 284, 285, 286, 287, 288, 289, 49178, 288, 49154, 290, 49167, 291, 49162, 292,
-		49153, 286, 49154, 290, 49181, 293, 49169, 262, 49189, 294, 49162, 295, 296, 49165, 297, 49161, 298, 49184, 299, 49160, 300,
-		49153, 301, 302, 303, 304, 305, 306, 49156, 307, 49173, 308, 49153, 309, 49153, 310, 311, 49160, 309, 311, 49154, 309, 311,
-		49155, 309, 312, 49153, 313, 49166, 314, 313, 49176, 315, 49154, 316, 49153, 317, 318, 317, 49162, 319, 49156, 286, 49199,
-		146, 320, 321, 49162, 320, 49157, 321, 49153, 322, 257, 49159, 323, 49173, 257, 49163, 324, 49153, 325, 326, 327, 49157,
-		328, 49157, 329, 49166, 328, 330, 331, 49153, 332, 333, 334, 49204, 335, 336, 337, 338, 335, 49154, 333, 49159, 332, 49155,
-		333, 338, 339, 337, 335, 49153, 340, 49153, 338, 331, 49153, 336, 49161, 335, 49153, 332, 49153, 341, 49161, 342, 343, 344,
-		345, 49156, 346, 347, 49153, 348, 49153, 349, 350, 49153, 349, 351, 352, 49153, 353, 354, 49159, 355, 49153, 354, 49153,
-		355, 49153, 354, 49173, 355, 354, 49158, 355, 354, 355, 49154, 354, 49155, 355, 49153, 354, 356, 357, 358, 49153, 353, 49155,
-		352, 49153, 354, 49153, 353, 49153, 354, 49153, 353, 356, 359, 49159, 354, 358, 49155, 354, 49153, 355, 354, 49154, 355,
-		49153, 352, 49153, 354, 49161, 360, 49153, 355, 49153, 361, 49157, 362, 363, 364, 365, 366, 49153, 354, 367, 368, 369, 370,
-		367, 49157, 371, 49155, 367, 49153, 371, 49153, 367, 49173, 371, 367, 49158, 371, 367, 49153, 371, 367, 49153, 371, 367,
-		49153, 371, 49153, 367, 372, 367, 49154, 373, 49153, 369, 49155, 367, 49153, 369, 49153, 367, 49153, 369, 372, 49154, 367,
-		374, 49158, 367, 49155, 371, 367, 371, 49158, 367, 49161, 375, 49153, 369, 49154, 371, 374, 49161, 367, 376, 49153, 377,
-		378, 376, 49158, 379, 380, 379, 376, 49154, 379, 376, 49173, 379, 376, 49158, 379, 376, 49153, 379, 376, 49156, 379, 49153,
-		376, 381, 379, 49154, 378, 49156, 377, 376, 49153, 377, 378, 376, 49153, 378, 381, 49153, 376, 379, 49166, 376, 379, 380,
-		49153, 382, 49153, 376, 49161, 383, 384, 385, 49158, 376, 386, 49154, 387, 49154, 388, 389, 390, 49153, 391, 389, 49159,
-		392, 49153, 389, 49153, 392, 49153, 389, 49173, 392, 389, 49158, 392, 389, 49153, 392, 389, 393, 49155, 392, 49153, 389,
-		394, 392, 395, 390, 391, 49154, 390, 396, 49153, 389, 49153, 391, 49153, 389, 49153, 391, 394, 49159, 389, 390, 395, 49155,
-		389, 49153, 392, 389, 49154, 392, 49153, 396, 49153, 389, 49161, 397, 398, 393, 49157, 399, 49159, 389, 49153, 400, 401,
-		402, 400, 49157, 402, 49154, 400, 49154, 402, 400, 49155, 402, 49154, 400, 49153, 402, 400, 402, 400, 49153, 402, 49154,
-		400, 49153, 402, 49154, 400, 49154, 402, 49154, 400, 49159, 402, 403, 49154, 402, 49155, 400, 404, 405, 401, 49153, 405,
-		49154, 400, 49154, 405, 400, 49154, 405, 406, 49153, 400, 407, 49157, 400, 404, 49165, 400, 408, 49160, 409, 49154, 410,
-		49157, 411, 412, 411, 49156, 400, 413, 49154, 414, 415, 49159, 416, 415, 49154, 416, 415, 49174, 416, 415, 49161, 416, 417,
-		49156, 416, 49154, 415, 418, 49154, 419, 49155, 414, 415, 49154, 419, 415, 49154, 419, 420, 49158, 415, 49153, 419, 415,
-		49153, 418, 421, 49156, 415, 49153, 416, 49153, 422, 49153, 415, 49161, 423, 49159, 415, 49158, 424, 425, 426, 427, 49153,
-		428, 429, 49159, 430, 429, 49154, 430, 429, 49174, 430, 429, 49161, 430, 429, 49156, 430, 49153, 429, 431, 432, 428, 433,
-		49153, 428, 434, 49153, 428, 429, 433, 49153, 428, 429, 49153, 428, 433, 435, 49158, 429, 49153, 434, 49158, 429, 430, 429,
-		49153, 430, 49153, 436, 49153, 429, 49161, 437, 429, 49153, 438, 49164, 429, 439, 440, 49153, 441, 442, 49159, 443, 442,
-		49154, 443, 442, 49174, 443, 444, 49167, 443, 444, 49153, 445, 446, 447, 49153, 441, 49154, 448, 449, 442, 49154, 441, 442,
-		49154, 441, 450, 444, 451, 49155, 442, 49154, 452, 447, 49158, 453, 454, 49153, 443, 49153, 449, 49153, 442, 49161, 455,
-		49157, 456, 49154, 453, 457, 49157, 446, 49153, 458, 49153, 459, 458, 49169, 460, 49154, 458, 49175, 460, 458, 49160, 460,
-		458, 460, 49153, 458, 49158, 460, 49154, 458, 461, 49155, 458, 462, 49153, 459, 49154, 463, 458, 463, 458, 49158, 459, 462,
-		49157, 458, 49161, 464, 49153, 458, 49153, 459, 465, 49162, 458, 466, 49199, 467, 468, 467, 469, 49158, 468, 49155, 466,
-		470, 49156, 471, 467, 472, 49157, 473, 468, 473, 474, 49161, 475, 49153, 476, 49187, 466, 477, 49153, 478, 477, 478, 49153,
-		477, 49153, 478, 477, 478, 49153, 477, 478, 49157, 477, 49155, 478, 477, 49158, 478, 477, 49154, 478, 477, 478, 477, 478,
-		49153, 477, 49153, 478, 477, 49155, 478, 479, 478, 480, 49157, 479, 477, 49153, 479, 478, 49153, 477, 49156, 481, 477, 482,
-		477, 49156, 483, 479, 49153, 477, 49161, 484, 49153, 477, 49153, 478, 49153, 485, 49183, 477, 486, 49154, 487, 49155, 488,
-		489, 49155, 488, 49157, 489, 487, 488, 49154, 487, 49153, 490, 49157, 487, 49161, 491, 49161, 492, 65535, 3, 487, 490, 493,
-		494, 493, 494, 49153, 495, 49159, 486, 496, 49184, 486, 497, 49153, 498, 49155, 496, 49165, 499, 500, 49153, 499, 49154,
-		490, 488, 49153, 490, 49155, 486, 501, 49154, 502, 49157, 499, 503, 499, 496, 49172, 499, 49154, 503, 49158, 499, 503, 499,
-		49154, 503, 496, 49159, 504, 505, 49157, 504, 496, 506, 504, 49153, 507, 49154, 508, 49155, 509, 49153, 510, 49188, 496,
-		49185, 511, 512, 49156, 511, 512, 49153, 511, 513, 514, 49155, 515, 514, 515, 49154, 516, 515, 517, 514, 517, 518, 49153,
-		513, 49153, 516, 512, 49161, 519, 49153, 520, 49155, 521, 49157, 511, 49153, 514, 49153, 515, 49155, 512, 49154, 516, 512,
-		513, 49153, 522, 49153, 512, 49153, 513, 49156, 522, 49154, 512, 49155, 516, 49164, 512, 516, 49153, 513, 49153, 516, 49157,
-		523, 518, 512, 523, 49161, 524, 49153, 525, 526, 527, 49153, 528, 49189, 529, 530, 531, 49156, 530, 531, 49153, 530, 49190,
-		532, 49153, 533, 49153, 534, 535, 536, 49154, 537, 49241, 538, 49156, 539, 540, 541, 49217, 542, 49156, 543, 49233, 542,
-		49157, 543, 49158, 544, 545, 49214, 544, 545, 544, 546, 49155, 544, 49153, 546, 49158, 544, 546, 544, 546, 49155, 544, 49153,
-		546, 49190, 544, 545, 544, 546, 49155, 544, 49153, 546, 49182, 544, 545, 544, 546, 49155, 544, 49153, 546, 49158, 544, 546,
-		544, 546, 49155, 544, 49153, 546, 49158, 544, 545, 49158, 544, 546, 49174, 544, 545, 49182, 544, 545, 544, 546, 49155, 544,
-		49153, 546, 49158, 544, 545, 49190, 544, 545, 49170, 544, 49153, 546, 49153, 547, 548, 549, 550, 551, 49155, 550, 49153,
-		551, 49160, 552, 49162, 553, 49154, 546, 49167, 545, 49161, 554, 49157, 546, 49231, 555, 49156, 556, 557, 49153, 558, 49157,
-		559, 49153, 558, 560, 49515, 561, 562, 563, 49159, 561, 49160, 564, 565, 49177, 566, 567, 568, 49154, 569, 49226, 570, 49154,
-		571, 49154, 572, 49159, 573, 49158, 574, 49164, 575, 576, 49155, 575, 49153, 577, 578, 49162, 576, 49169, 579, 49153, 580,
-		581, 49153, 582, 49160, 583, 49169, 584, 49153, 585, 49163, 586, 49164, 587, 588, 49154, 587, 588, 49153, 589, 49163, 588,
-		49203, 590, 49153, 591, 592, 49158, 593, 49159, 592, 593, 49153, 592, 49162, 594, 49154, 595, 596, 49153, 597, 595, 598,
-		590, 599, 49153, 600, 49161, 601, 49157, 600, 49161, 602, 49157, 600, 49153, 603, 604, 605, 606, 604, 607, 603, 606, 608,
-		609, 49154, 610, 611, 612, 49161, 613, 49157, 612, 49186, 614, 615, 49203, 614, 49159, 612, 49156, 614, 49153, 616, 49185,
-		614, 617, 618, 49156, 612, 49221, 564, 49161, 146, 49180, 619, 49153, 620, 621, 49154, 622, 49155, 623, 49153, 622, 49154,
-		623, 49155, 621, 49153, 623, 622, 49157, 623, 49154, 624, 49155, 621, 625, 49154, 621, 49153, 626, 49161, 627, 49181, 628,
-		49153, 146, 49156, 628, 49162, 146, 49193, 629, 49153, 630, 49155, 146, 49156, 629, 49154, 631, 49153, 629, 631, 49166, 629,
-		49157, 146, 49161, 632, 633, 49154, 146, 49153, 634, 49183, 635, 49174, 636, 49153, 637, 49153, 638, 637, 49153, 639, 49153,
-		640, 49204, 641, 642, 643, 642, 49158, 643, 146, 644, 642, 643, 49153, 642, 49159, 643, 49157, 642, 49153, 643, 49159, 645,
-		49153, 146, 645, 49161, 646, 49157, 146, 49161, 646, 49157, 146, 49158, 647, 648, 49155, 649, 49153, 647, 49153, 146, 49165,
-		650, 651, 49216, 146, 49155, 652, 653, 49198, 654, 655, 653, 49156, 652, 653, 652, 49156, 653, 652, 653, 656, 49158, 654,
-		49155, 657, 49161, 658, 49153, 659, 660, 661, 49153, 659, 660, 49161, 662, 49160, 655, 49160, 662, 49154, 657, 49153, 663,
-		664, 49181, 665, 664, 49155, 663, 49153, 664, 49153, 663, 666, 667, 49153, 668, 49153, 665, 49161, 669, 49157, 670, 49189,
-		671, 672, 673, 49153, 674, 49154, 673, 674, 673, 49154, 674, 49153, 675, 49159, 676, 49155, 677, 49187, 678, 49159, 679,
-		49159, 680, 49153, 679, 681, 682, 49154, 683, 49153, 684, 49154, 685, 49161, 686, 49154, 683, 49154, 678, 49161, 687, 49181,
-		688, 49154, 689, 690, 49153, 689, 49153, 691, 692, 693, 694, 49153, 695, 696, 697, 698, 699, 49158, 700, 49199, 146, 49159,
-		701, 49159, 702, 49154, 703, 704, 49164, 703, 705, 49158, 703, 49155, 706, 703, 49155, 706, 707, 708, 709, 49153, 710, 711,
-		49153, 650, 49157, 146, 49189, 83, 49156, 712, 713, 49200, 714, 49156, 715, 716, 49154, 714, 49156, 715, 83, 49163, 84, 717,
-		718, 49154, 84, 719, 49175, 84, 720, 49155, 84, 49160, 721, 722, 49154, 721, 722, 49173, 721, 723, 49155, 141, 49158, 724,
-		49156, 725, 49174, 726, 49165, 727, 650, 49155, 728, 146, 729, 730, 703, 49153, 724, 65535, 22, 45, 46, 45, 47, 65535, 52,
-		45, 46, 49155, 49, 51, 731, 49153, 732, 733, 732, 65535, 21, 45, 46, 45, 47, 65535, 23, 45, 46, 65535, 3, 734, 735, 49159,
-		736, 49159, 737, 49157, 736, 49153, 146, 49157, 737, 49153, 146, 49159, 736, 49159, 737, 49159, 736, 49159, 737, 49157, 736,
-		49153, 146, 49157, 737, 49153, 146, 65535, 4, 156, 736, 65535, 4, 146, 737, 49159, 736, 49159, 737, 49153, 738, 49155, 739,
-		49153, 740, 49153, 741, 49153, 742, 49153, 743, 49153, 146, 49159, 744, 49159, 745, 49159, 744, 49159, 745, 49159, 744, 49159,
-		745, 49153, 736, 49154, 744, 146, 156, 744, 49153, 737, 49153, 746, 747, 145, 748, 49154, 145, 49154, 744, 146, 156, 744,
-		49155, 749, 747, 49154, 145, 49153, 736, 49153, 156, 49153, 146, 49153, 156, 49153, 737, 49153, 750, 146, 49154, 145, 49153,
-		736, 49154, 156, 180, 49153, 156, 49153, 737, 49153, 751, 752, 49154, 145, 49153, 146, 49154, 744, 146, 156, 744, 49153,
-		753, 49153, 754, 747, 49153, 145, 146, 49162, 755, 756, 757, 758, 49153, 759, 49157, 760, 761, 29, 762, 763, 764, 49153,
-		34, 40, 764, 34, 49155, 29, 765, 49153, 29, 765, 766, 767, 49156, 768, 769, 49153, 29, 49154, 761, 49155, 29, 34, 40, 29,
-		49153, 770, 29, 771, 772, 49154, 29, 35, 773, 774, 775, 49153, 776, 49155, 777, 49155, 778, 779, 780, 781, 49153, 782, 778,
-		49158, 782, 783, 784, 49154, 785, 786, 787, 49155, 788, 49157, 36, 37, 789, 49153, 146, 49157, 37, 790, 791, 790, 792, 793,
-		794, 49161, 37, 790, 791, 790, 792, 793, 146, 49156, 721, 49159, 795, 49154, 146, 49162, 796, 797, 798, 49154, 799, 49153,
-		800, 49155, 801, 49154, 802, 803, 804, 49154, 805, 806, 807, 49167, 146, 49164, 808, 49155, 809, 808, 49153, 810, 811, 49153,
-		812, 49155, 142, 813, 49155, 814, 726, 49166, 146, 49153, 815, 816, 49155, 815, 816, 49153, 815, 817, 49154, 816, 49153,
-		817, 49154, 816, 817, 815, 816, 49153, 815, 818, 49156, 816, 49157, 815, 816, 815, 819, 815, 816, 820, 821, 822, 49153, 816,
-		823, 817, 49153, 816, 824, 816, 817, 49155, 825, 826, 827, 828, 829, 830, 49153, 831, 49156, 832, 831, 49153, 830, 49153,
-		833, 834, 832, 835, 836, 837, 838, 49154, 839, 49164, 37, 49167, 840, 49167, 841, 49154, 842, 80, 91, 49155, 843, 839, 49153,
-		844, 49155, 146, 49156, 845, 49156, 846, 49153, 845, 49155, 846, 845, 49153, 846, 845, 49153, 846, 845, 846, 847, 49156,
-		846, 845, 847, 49153, 846, 49155, 847, 49153, 846, 49155, 847, 49169, 846, 49153, 845, 49153, 846, 845, 846, 845, 49158,
-		846, 847, 846, 49157, 847, 49153, 846, 49156, 847, 49160, 848, 49163, 849, 49169, 35, 850, 49374, 35, 49165, 779, 31, 851,
-		49157, 31, 852, 853, 852, 853, 49171, 31, 49153, 35, 49158, 31, 773, 774, 49231, 31, 851, 779, 49181, 851, 49176, 779, 49153,
-		854, 855, 854, 49174, 855, 856, 857, 49162, 858, 49157, 859, 860, 49156, 861, 862, 49162, 863, 49158, 864, 49155, 865, 866,
-		49188, 31, 49153, 851, 49176, 867, 49162, 31, 49172, 867, 49211, 37, 49177, 815, 49177, 868, 49177, 869, 37, 49171, 870,
-		871, 49301, 31, 49161, 855, 49153, 872, 49163, 31, 49160, 872, 35, 49155, 31, 49156, 872, 35, 49155, 31, 49153, 872, 49153,
-		31, 49153, 872, 49154, 31, 49156, 872, 49165, 31, 872, 31, 872, 49153, 31, 49157, 872, 49154, 31, 49159, 851, 49159, 779,
-		49156, 31, 49153, 872, 49164, 31, 49153, 856, 49153, 855, 858, 851, 49189, 31, 872, 31, 872, 49180, 31, 49155, 872, 49160,
-		31, 49153, 872, 35, 49153, 851, 49163, 855, 49153, 858, 49161, 855, 49159, 856, 49162, 858, 873, 49153, 862, 49153, 856,
-		49167, 858, 861, 49161, 873, 49154, 862, 49155, 873, 49161, 862, 863, 49170, 862, 863, 862, 49155, 863, 49175, 862, 874,
-		49155, 875, 876, 49155, 875, 49153, 876, 49179, 875, 876, 49186, 875, 876, 875, 876, 49155, 875, 49154, 876, 875, 877, 49158,
-		875, 49153, 876, 49158, 875, 65535, 7, 878, 879, 49181, 880, 875, 49154, 876, 49175, 875, 876, 49165, 875, 876, 49156, 881,
-		882, 883, 49155, 859, 884, 885, 884, 49153, 886, 49173, 779, 65535, 3, 887, 888, 889, 890, 889, 890, 49167, 779, 49279, 891,
-		49282, 779, 65535, 11, 887, 888, 49214, 779, 887, 888, 887, 888, 49183, 779, 887, 888, 49153, 779, 49165, 856, 49157, 858,
-		49158, 861, 49156, 873, 49155, 861, 49163, 873, 49172, 885, 49153, 873, 49157, 885, 49154, 864, 49156, 873, 49156, 862, 49177,
-		864, 49153, 867, 49183, 864, 49153, 867, 49185, 864, 49154, 867, 49163, 864, 867, 49159, 864, 866, 49176, 867, 49155, 892,
-		49167, 867, 49198, 893, 894, 49198, 895, 894, 95, 91, 896, 897, 898, 899, 900, 65535, 3, 95, 91, 901, 902, 903, 904, 732,
-		734, 735, 905, 95, 91, 905, 49155, 732, 906, 907, 49153, 908, 65535, 50, 909, 910, 911, 49157, 912, 913, 914, 913, 914, 49154,
-		915, 916, 917, 49156, 918, 49155, 919, 920, 49153, 919, 49189, 921, 530, 922, 49156, 530, 922, 49153, 530, 49205, 923, 49153,
-		924, 49158, 925, 926, 927, 49165, 925, 928, 49174, 545, 49160, 546, 49158, 545, 546, 49158, 545, 546, 49158, 545, 546, 49158,
-		545, 546, 49158, 545, 546, 49158, 545, 546, 49158, 545, 546, 49158, 545, 546, 49183, 929, 49153, 782, 930, 931, 930, 931,
-		49154, 782, 930, 931, 782, 930, 931, 49160, 782, 932, 49153, 933, 934, 933, 930, 931, 49153, 933, 935, 936, 65535, 4, 937,
-		938, 49155, 933, 939, 940, 933, 941, 49159, 942, 49153, 943, 944, 49154, 945, 946, 947, 948, 49153, 949, 49156, 950, 49205,
-		867, 49177, 951, 146, 49240, 951, 49163, 146, 49365, 951, 49177, 146, 49153, 952, 49153, 827, 49159, 952, 49155, 146, 755,
-		953, 770, 29, 815, 954, 955, 956, 773, 774, 773, 774, 764, 957, 764, 957, 773, 774, 49153, 31, 65535, 4, 773, 774, 760, 764,
-		49153, 957, 31, 49160, 956, 49155, 136, 49153, 958, 760, 49156, 959, 49153, 815, 49154, 960, 961, 962, 963, 827, 815, 964,
-		49235, 965, 49153, 966, 49153, 964, 49153, 967, 49153, 968, 49153, 969, 966, 970, 49241, 971, 972, 973, 49153, 974, 975,
-		49156, 976, 49191, 977, 978, 979, 976, 146, 49202, 538, 540, 49193, 538, 146, 49153, 980, 49155, 981, 49161, 980, 49175,
-		982, 49154, 983, 49156, 976, 49167, 835, 49171, 838, 49163, 146, 49167, 975, 49180, 984, 49153, 985, 146, 49161, 37, 49177,
-		815, 49155, 986, 49159, 839, 828, 49166, 870, 49179, 984, 49153, 985, 987, 815, 49161, 37, 49190, 815, 49166, 870, 49163,
-		815, 49155, 828, 49198, 988, 146, 49239, 988, 49182, 815, 49155, 828, 49250, 815, 49153, 828, 49182, 815, 828, 49333, 989,
-		49161, 146, 49215, 828, 49317, 990, 49173, 991, 49159, 992, 49159, 993, 994, 49160, 995, 49172, 996, 49172, 146, 49172, 997,
-		998, 49398, 997, 49154, 146, 49169, 999, 49153, 1000, 49167, 999, 1000, 49163, 999, 1000, 49154, 999, 1000, 999, 49160, 146,
-		49191, 1001, 49157, 1002, 1003, 1004, 49291, 1005, 1006, 1007, 49153, 1008, 49167, 1005, 49161, 1009, 49153, 1005, 49171,
-		1010, 65535, 16, 214, 215, 218, 219, 65535, 6, 214, 215, 1011, 202, 49154, 1012, 1013, 49159, 1014, 49153, 202, 1013, 1015,
-		65535, 12, 214, 215, 220, 221, 220, 221, 49153, 1016, 1017, 1014, 49221, 1018, 49161, 1019, 49153, 1020, 1021, 1022, 49154,
-		1023, 1022, 49159, 1024, 49174, 1025, 49155, 1026, 49156, 1027, 49153, 1028, 65535, 7, 734, 735, 49153, 732, 65535, 31, 734,
-		735, 907, 49159, 732, 734, 735, 734, 735, 1029, 65535, 5, 734, 735, 1027, 49153, 1030, 734, 735, 1031, 1032, 1033, 1034,
-		1035, 1036, 1037, 49153, 1038, 65535, 5, 1039, 1040, 65535, 5, 1034, 1035, 1041, 1042, 1043, 1044, 1045, 146, 1046, 1047,
-		1048, 1049, 1050, 1051, 1050, 1051, 49214, 146, 1052, 49153, 1053, 1032, 49156, 1054, 49153, 1055, 1056, 49154, 1055, 1056,
-		49155, 1055, 1056, 49174, 1055, 49153, 1057, 49153, 1058, 1057, 49155, 1059, 49155, 146, 49157, 839, 49153, 986, 802, 986,
-		49157, 146, 49203, 1060, 49153, 1061, 49153, 1062, 49159, 1063, 49153, 1064, 49201, 1065, 49167, 1064, 1066, 1067, 49159,
-		1068, 49153, 1069, 49161, 1070, 49157, 1068, 49169, 1071, 49157, 348, 49154, 1072, 348, 1073, 1074, 49153, 1075, 49161, 1076,
-		49179, 1077, 49156, 1078, 49154, 1079, 1080, 1081, 49174, 1082, 49162, 1083, 1084, 1085, 49162, 1086, 1087, 49180, 539, 49154,
-		146, 49154, 1088, 1089, 49198, 1090, 1091, 49153, 1089, 49155, 1088, 49153, 1089, 1088, 49154, 1089, 1092, 49157, 1093, 1094,
-		49153, 1095, 49155, 1093, 1096, 1097, 49161, 1098, 49155, 1096, 49153, 1093, 49156, 1099, 1100, 1101, 49160, 1099, 49161,
-		1102, 49156, 1099, 1103, 49192, 1104, 49157, 1105, 49153, 1106, 49153, 1105, 49153, 1106, 49153, 1105, 49160, 1107, 49154,
-		1104, 1105, 49159, 1104, 1105, 1106, 49153, 1107, 49161, 1108, 49153, 1107, 1109, 49154, 1110, 49167, 1111, 1112, 49157,
-		1111, 49154, 1113, 1111, 525, 1100, 1114, 49153, 1099, 49199, 1115, 1116, 1115, 49154, 1116, 49153, 1117, 49153, 1116, 1117,
-		1115, 49153, 1117, 1115, 1116, 1118, 1119, 1118, 1119, 49175, 146, 49153, 1115, 1120, 1121, 1122, 49162, 1123, 1124, 49153,
-		1125, 49153, 1124, 49153, 1126, 1123, 49153, 1127, 1124, 1128, 49160, 146, 546, 49157, 1129, 49153, 546, 49157, 1129, 49153,
-		546, 49157, 1129, 49160, 546, 49158, 1129, 546, 49158, 1129, 546, 49186, 1038, 1130, 49158, 1038, 1131, 49155, 1132, 49155,
-		1133, 1038, 1134, 49161, 146, 49231, 1135, 49186, 1136, 49153, 1137, 1138, 49153, 1137, 1138, 49153, 1137, 1139, 1140, 1141,
-		49153, 146, 49161, 1142, 49157, 146, 49315, 1143, 49163, 146, 49174, 539, 49155, 146, 49200, 539, 49155, 146, 49279, 1144,
-		49279, 1145, 49293, 1146, 49153, 990, 1146, 990, 1146, 49153, 990, 49161, 1146, 990, 1146, 990, 1146, 49153, 990, 49153,
-		1146, 49154, 990, 49155, 1146, 49153, 1147, 49210, 1148, 49154, 1149, 49153, 146, 49257, 1150, 49189, 146, 49158, 51, 49163,
-		146, 49156, 1151, 49156, 146, 1152, 1153, 49161, 1154, 1155, 49164, 1154, 146, 49156, 1154, 146, 1154, 146, 49153, 1154,
-		146, 49153, 1154, 146, 49161, 1154, 49249, 261, 49167, 1156, 49168, 257, 49290, 261, 49157, 1157, 49369, 261, 1158, 1159,
-		49167, 257, 49215, 261, 49153, 257, 49205, 261, 49159, 257, 49183, 1160, 49161, 261, 49153, 1157, 1161, 253, 49153, 257,
-		49167, 1162, 49154, 1163, 1164, 49154, 1163, 1165, 1166, 1163, 49157, 146, 49155, 136, 49154, 725, 49158, 650, 49153, 1167,
-		1168, 49153, 1169, 49153, 771, 65535, 6, 1170, 1171, 1172, 1173, 1172, 1173, 49153, 778, 1174, 1175, 49155, 1168, 49154,
-		771, 49153, 149, 1176, 146, 149, 1177, 49153, 1178, 1169, 65535, 3, 1170, 1171, 49153, 1168, 1179, 790, 1180, 49154, 790,
-		146, 1179, 796, 49153, 1168, 49155, 146, 1157, 261, 1157, 272, 1157, 257, 65535, 4, 1157, 261, 1157, 49277, 261, 49153, 257,
-		1181, 146, 1178, 1182, 1168, 796, 49153, 1168, 1183, 1170, 1171, 1168, 790, 149, 1169, 1176, 1168, 49161, 1184, 1177, 149,
-		49154, 790, 1178, 1168, 49157, 1185, 49171, 41, 1170, 1179, 1171, 1186, 771, 32, 49157, 1187, 49171, 43, 1170, 790, 1171,
-		790, 1188, 1189, 1178, 1172, 1173, 149, 1168, 49161, 1190, 131, 49196, 1190, 49153, 1191, 540, 49181, 538, 49154, 146, 49157,
-		538, 49153, 146, 49157, 538, 49153, 146, 49157, 538, 49153, 146, 49154, 538, 49154, 146, 49153, 796, 790, 32, 815, 49153,
-		796, 146, 815, 49155, 790, 49153, 815, 146, 49160, 1192, 49154, 1193, 1194, 1195, 49153, 1196, 49163, 1197, 146, 49177, 1197,
-		146, 49170, 1197, 146, 49153, 1197, 146, 49166, 1197, 49153, 146, 49165, 1197, 49185, 146, 49274, 1197, 49156, 146, 49154,
-		1198, 49155, 146, 49196, 871, 49154, 146, 49160, 828, 49204, 1199, 49155, 1200, 49168, 1201, 1200, 1202, 1203, 49153, 1204,
-		146, 49163, 838, 49155, 146, 1203, 49198, 146, 49196, 838, 726, 49281, 146, 49180, 1205, 49154, 1206, 49200, 1207, 49166,
-		1208, 1209, 49178, 1210, 49155, 918, 49182, 1211, 1212, 49155, 1213, 49160, 146, 49154, 1214, 49168, 1215, 1216, 49159, 1215,
-		1216, 49156, 1217, 49189, 1218, 49156, 1219, 49156, 146, 49181, 1220, 1221, 1222, 49187, 1223, 49155, 146, 49159, 1223, 1224,
-		49156, 1225, 49193, 146, 49189, 1226, 49153, 1227, 49189, 1228, 49153, 1229, 49199, 1230, 49181, 1231, 49153, 1232, 49161,
-		1233, 49157, 1232, 49187, 1234, 49155, 1235, 49187, 1236, 49155, 1235, 49191, 1237, 49159, 1238, 49203, 1239, 49162, 146,
-		1240, 49167, 146, 49334, 1241, 49160, 146, 49173, 1241, 49161, 146, 49159, 1241, 49175, 146, 49157, 1242, 49153, 146, 1242,
-		146, 49195, 1242, 146, 49153, 1242, 49154, 146, 1242, 49153, 146, 1242, 49173, 1243, 146, 1244, 49159, 1245, 49174, 1246,
-		49153, 1247, 49158, 1248, 49182, 1249, 49159, 1250, 49160, 1251, 49199, 146, 49170, 1252, 1253, 49153, 1252, 49156, 1253,
-		49156, 1254, 49173, 1255, 49155, 1256, 49153, 1257, 49154, 1258, 1259, 49177, 1260, 49156, 1261, 1262, 49215, 146, 49183,
-		1263, 49175, 1264, 49155, 146, 49153, 1265, 49153, 1264, 49167, 1265, 49153, 146, 49197, 1265, 1266, 49154, 1267, 1268, 49153,
-		1267, 49156, 1268, 49155, 1267, 49155, 1266, 1268, 49154, 1266, 1268, 49178, 1266, 49155, 1268, 49154, 1269, 49155, 1268,
-		1269, 49159, 1270, 49159, 1268, 49157, 1271, 49153, 1272, 1271, 49158, 1268, 49180, 1273, 49153, 1274, 1275, 49180, 1276,
-		49154, 1277, 49183, 146, 49159, 1278, 1279, 49179, 1278, 49153, 1280, 49155, 1281, 49156, 1282, 49157, 1283, 1284, 49160,
-		1281, 49205, 1285, 49154, 1286, 1287, 49157, 1288, 49173, 1289, 49153, 146, 49159, 1290, 49170, 1291, 49156, 146, 49159,
-		1292, 49169, 1293, 49158, 146, 49155, 1294, 49163, 146, 49158, 1295, 49231, 146, 49224, 1296, 49206, 146, 49202, 1297, 49164,
-		146, 49202, 1298, 49158, 146, 49157, 1299, 49247, 146, 49182, 1300, 146, 1301, 1302, 1301, 49204, 1303, 49165, 1302, 1304,
-		49153, 1305, 49156, 1306, 49155, 1307, 49171, 1308, 49161, 1309, 49166, 1307, 1310, 49153, 1311, 1312, 49196, 1313, 49154,
-		1312, 49155, 1314, 49153, 1312, 49153, 1315, 49153, 1316, 1317, 49155, 1318, 49165, 1319, 49176, 1320, 49158, 146, 49161,
-		1321, 49157, 146, 49154, 1322, 49187, 1323, 49156, 1322, 1324, 49157, 1322, 49153, 1325, 1326, 49161, 1327, 1328, 49154,
-		1329, 49163, 1326, 49186, 1330, 1331, 49153, 1332, 1330, 49160, 1333, 49153, 1334, 1335, 49199, 1336, 49154, 1335, 49160,
-		1334, 1335, 1337, 49155, 1336, 49153, 1338, 49153, 1339, 1340, 49154, 1341, 1342, 49153, 1343, 49161, 1344, 1345, 1340, 1346,
-		1340, 49153, 1347, 458, 49171, 1348, 49162, 458, 49169, 1349, 1350, 49176, 1349, 49154, 1351, 49154, 1352, 49153, 1351, 1352,
-		1353, 1354, 1352, 49153, 1355, 1356, 49153, 1355, 1357, 1358, 49168, 1350, 49199, 146, 49158, 1359, 1360, 1359, 1360, 49155,
-		1359, 1360, 49166, 1359, 1360, 49161, 1359, 1361, 49157, 1360, 49198, 1362, 1363, 49154, 1364, 49157, 1363, 49153, 1365,
-		49156, 1366, 49161, 1367, 49157, 1366, 1368, 1369, 49153, 1370, 1371, 49159, 1372, 49153, 1371, 49153, 1372, 49153, 1371,
-		49173, 1372, 1371, 49158, 1372, 1371, 49153, 1372, 1371, 49156, 1372, 49153, 1371, 1373, 1372, 1374, 1370, 1369, 49155, 1370,
-		49153, 1371, 49153, 1370, 49153, 1371, 49153, 1370, 1375, 49153, 1371, 1376, 49157, 1371, 1374, 49156, 1371, 1377, 49155,
-		1372, 49153, 1370, 49153, 1371, 49158, 1373, 49154, 1371, 49156, 1373, 49162, 1371, 49204, 1378, 49154, 1379, 49159, 1380,
-		49153, 1379, 1381, 49153, 1380, 1379, 1381, 49155, 1378, 49153, 1382, 1383, 49153, 1384, 49161, 1385, 1386, 1383, 1386, 1384,
-		49185, 1386, 49199, 1387, 1388, 49153, 1389, 49157, 1390, 1389, 1390, 49153, 1389, 1388, 1389, 49153, 1390, 1389, 49153,
-		1391, 49153, 1387, 1392, 1387, 49159, 1393, 49161, 1394, 49157, 1393, 49183, 146, 49198, 1395, 1396, 49153, 1397, 49155,
-		1398, 49153, 1399, 49155, 1397, 49153, 1398, 1397, 49153, 1400, 1401, 49153, 1402, 49153, 1403, 49154, 1404, 1402, 49165,
-		1405, 49155, 1406, 49153, 1407, 49185, 1399, 49199, 1408, 49154, 1409, 49159, 1410, 49153, 1409, 1410, 1409, 1411, 1410,
-		49153, 1412, 1413, 1408, 49162, 1414, 49161, 1415, 49157, 1414, 49164, 1416, 49170, 612, 49194, 1417, 1418, 1419, 1418, 49153,
-		1419, 49157, 1418, 1420, 1421, 49159, 1422, 49161, 1423, 49157, 1422, 49199, 146, 49177, 1424, 49154, 1425, 49154, 1426,
-		49153, 1427, 49155, 1426, 1427, 49155, 1426, 1428, 49155, 1425, 49161, 1429, 49153, 1430, 49154, 1431, 1432, 49247, 146,
-		49183, 1433, 49183, 1434, 49161, 1435, 49160, 1436, 49163, 146, 1437, 1438, 49157, 1439, 49153, 1440, 49153, 1439, 49191,
-		1438, 1441, 1442, 49155, 1439, 1440, 1438, 49155, 1439, 49154, 1443, 49153, 1444, 49154, 1443, 1442, 49159, 146, 1445, 49157,
-		1446, 49153, 1447, 49154, 1446, 49191, 1445, 49153, 1448, 49155, 1445, 49164, 1446, 1447, 1449, 1450, 1451, 49153, 1452,
-		1448, 49154, 1451, 49153, 1453, 49164, 1448, 49167, 146, 49208, 1454, 49158, 146, 49160, 1455, 1456, 49188, 1455, 1457, 49158,
-		1458, 1456, 49157, 1458, 1457, 1459, 1455, 49153, 1460, 1461, 49153, 1462, 49161, 1456, 49161, 1463, 49170, 1464, 49154,
-		1456, 1465, 1466, 49181, 1467, 49153, 1468, 49173, 1469, 1468, 1470, 49158, 1469, 1470, 49153, 1469, 1470, 49153, 1469, 49160,
-		1468, 49215, 146, 49158, 1471, 146, 49153, 1471, 146, 49189, 1471, 49157, 1472, 49154, 146, 1472, 146, 49153, 1472, 146,
-		49154, 1472, 1473, 1472, 49153, 1473, 1471, 1472, 49159, 146, 49161, 1474, 49189, 146, 49390, 1475, 49193, 1476, 1477, 49253,
-		1478, 49250, 1479, 49163, 1480, 1478, 49155, 1481, 1482, 49162, 1478, 49347, 1483, 49211, 146, 49326, 1484, 49232, 146, 49350,
-		1485, 49208, 146, 49336, 1486, 49158, 1024, 49182, 1487, 1488, 49161, 1489, 49155, 1488, 49153, 1490, 49247, 146, 49181,
-		1491, 49153, 146, 49156, 1492, 1493, 49161, 146, 49199, 1494, 49158, 1495, 49153, 1496, 1497, 49153, 1498, 49155, 1499, 49153,
-		1500, 49153, 1501, 1496, 1499, 49161, 146, 49161, 1502, 146, 49158, 1503, 146, 49172, 1494, 49156, 146, 49170, 1494, 49263,
-		146, 49220, 1504, 49162, 1505, 1504, 49197, 1506, 49167, 1505, 49155, 1507, 49164, 1508, 49215, 146, 1509, 1510, 49181, 146,
-		49388, 1511, 49170, 1512, 49266, 1511, 49164, 1512, 1513, 1514, 49436, 1515, 49232, 146, 49419, 1516, 49155, 1517, 49258,
-		1518, 49156, 1519, 49164, 1518, 49154, 1519, 49160, 1518, 49158, 1519, 49161, 1518, 49153, 1519, 1520, 1521, 1522, 1523,
-		49155, 1524, 49243, 146, 49397, 1525, 49161, 146, 49190, 1525, 49153, 146, 838, 49210, 1525, 1526, 1527, 49154, 1528, 49154,
-		1525, 1529, 49156, 1530, 49159, 1531, 49159, 1528, 49153, 1525, 49158, 1528, 49181, 1525, 49155, 1528, 49199, 1525, 49162,
-		844, 49174, 146, 49217, 1201, 49154, 1532, 1201, 49209, 146, 49238, 828, 49160, 146, 49169, 1533, 49165, 146, 49177, 1534,
-		49159, 1535, 49153, 1536, 49167, 1535, 49177, 1534, 49158, 1535, 146, 49153, 1536, 49167, 1535, 49177, 1534, 49159, 1535,
-		49153, 1536, 49167, 1535, 1534, 146, 49153, 1534, 49153, 146, 1534, 49153, 146, 49153, 1534, 49153, 146, 49155, 1534, 146,
-		49159, 1534, 49155, 1535, 146, 1535, 146, 1535, 49153, 1536, 1535, 1537, 49153, 1535, 146, 49162, 1535, 49177, 1534, 49159,
-		1535, 49153, 1536, 49167, 1535, 49153, 1534, 146, 49155, 1534, 49153, 146, 49159, 1534, 146, 49158, 1534, 146, 49159, 1535,
-		49153, 1536, 49167, 1535, 49153, 1534, 146, 49155, 1534, 146, 49156, 1534, 146, 1534, 49154, 146, 49158, 1534, 146, 49159,
-		1535, 49153, 1536, 49167, 1535, 49177, 1534, 49159, 1535, 49153, 1536, 49167, 1535, 49177, 1534, 49159, 1535, 49153, 1536,
-		49167, 1535, 49177, 1534, 49159, 1535, 49153, 1536, 49167, 1535, 49177, 1534, 49159, 1535, 49153, 1536, 49167, 1535, 49177,
-		1534, 49159, 1535, 49153, 1536, 49167, 1535, 49177, 1534, 49159, 1535, 49153, 1536, 49167, 1535, 49153, 829, 49153, 146,
-		49176, 1534, 1538, 49176, 1535, 1538, 49157, 1535, 49176, 1534, 1538, 49176, 1535, 1538, 49157, 1535, 49176, 1534, 1538,
-		49176, 1535, 1538, 49157, 1535, 49176, 1534, 1538, 49176, 1535, 1538, 49157, 1535, 49176, 1534, 1538, 49176, 1535, 1538,
-		49157, 1535, 1539, 1540, 49153, 146, 49201, 1541, 49279, 1542, 49206, 1543, 49155, 1542, 49201, 1543, 49159, 1542, 1543,
-		49165, 1542, 1543, 49153, 1542, 1544, 1545, 49153, 1544, 1546, 49166, 146, 49156, 1543, 146, 49166, 1543, 49231, 146, 49158,
-		1547, 894, 49168, 1547, 49153, 894, 49158, 1547, 894, 49153, 1547, 894, 49156, 1547, 49156, 894, 49231, 146, 49348, 1548,
-		49153, 146, 49160, 1549, 49158, 1550, 49192, 146, 49185, 1551, 49185, 1552, 49154, 1553, 1554, 49154, 1555, 49156, 1556,
-		49161, 1557, 49155, 1556, 49153, 1558, 49183, 146, 49155, 1559, 257, 49178, 1559, 257, 49153, 1559, 257, 1559, 49153, 257,
-		1559, 257, 49161, 1559, 257, 49155, 1559, 257, 1559, 257, 1559, 49157, 257, 1559, 49155, 257, 65535, 3, 1559, 257, 49154,
-		1559, 257, 49153, 1559, 257, 1559, 49153, 257, 65535, 5, 1559, 257, 49153, 1559, 257, 1559, 49153, 257, 49155, 1559, 257,
-		49158, 1559, 257, 49155, 1559, 257, 49155, 1559, 257, 1559, 257, 49161, 1559, 257, 49168, 1559, 49156, 257, 49154, 1559,
-		257, 49156, 1559, 257, 49168, 1559, 49203, 257, 49153, 1560, 49165, 257, 49195, 838, 49155, 146, 49251, 838, 49163, 146,
-		49166, 1561, 49153, 146, 49165, 1561, 1562, 146, 49166, 1561, 146, 49166, 1561, 49173, 1562, 49161, 146, 49162, 839, 49153,
-		1563, 49154, 146, 49182, 986, 146, 1564, 1565, 49162, 1564, 1565, 1564, 1565, 49153, 1564, 1565, 49154, 1564, 1565, 49154,
-		1564, 49156, 986, 1561, 49158, 1564, 1565, 49158, 1564, 1565, 49161, 1564, 49153, 1566, 49155, 146, 49160, 1564, 1565, 1564,
-		49153, 1565, 49153, 1564, 1565, 49161, 1564, 49155, 986, 49153, 1561, 986, 49161, 1561, 49169, 1567, 49208, 146, 49177, 1568,
-		1569, 49153, 1561, 49164, 146, 49185, 986, 49160, 1561, 1567, 49155, 146, 49160, 986, 49158, 146, 49153, 1561, 49165, 146,
-		49157, 1570, 49177, 146, 49184, 1561, 49163, 1562, 49154, 844, 49157, 1561, 1562, 49221, 1561, 1562, 49153, 844, 49171, 1561,
-		49163, 1562, 49188, 1561, 1562, 49156, 1561, 49155, 1562, 49156, 844, 49163, 1562, 49168, 1561, 49158, 1562, 49154, 844,
-		49156, 1571, 49214, 1561, 1562, 1561, 1562, 49333, 1561, 1562, 49155, 1561, 49153, 1562, 844, 49213, 1561, 49153, 1562, 49155,
-		1566, 49158, 1562, 49156, 844, 49175, 1561, 49169, 1562, 1567, 49192, 1562, 1567, 49237, 1562, 49156, 1561, 1572, 49167,
-		1573, 1572, 49154, 1573, 65535, 3, 1572, 1573, 1572, 49154, 1573, 1572, 49157, 1573, 49153, 1572, 49155, 1573, 1572, 1573,
-		49153, 1572, 49155, 1573, 1572, 49163, 1573, 49153, 1574, 49153, 1575, 49162, 1573, 49199, 1562, 49221, 1561, 49161, 1562,
-		844, 49153, 1567, 49153, 1570, 49162, 146, 49164, 1562, 49154, 146, 49155, 1562, 49154, 1567, 49153, 1570, 49158, 146, 49267,
-		1561, 49163, 146, 49236, 1562, 49194, 146, 49163, 1562, 49155, 146, 49207, 1562, 49159, 146, 49161, 1562, 49157, 146, 49191,
-		1562, 49159, 146, 49181, 1562, 49233, 146, 49163, 1570, 49155, 146, 49160, 844, 49157, 1567, 1570, 49159, 1567, 49159, 1570,
-		1567, 49153, 1570, 49163, 1567, 146, 49163, 1567, 1570, 49154, 146, 49166, 1567, 49164, 1570, 49171, 146, 49156, 844, 49164,
-		1567, 49157, 1570, 49191, 146, 844, 49166, 146, 49174, 1570, 49302, 146, 49153, 1576, 49366, 1577, 49192, 146, 49332, 993,
-		49162, 146, 49373, 1578, 49153, 146, 49409, 995, 49165, 146, 49456, 996, 49182, 146, 49309, 1579, 49249, 146, 1580, 1581,
-		49181, 1580, 49247, 1582, 49279, 787, 49391, 1583, 49167, 787, 49405, 1584, 49153, 1576
-	};
-
-	static constexpr std::array<std::uint_least8_t, 1426> rlepflagindices =
-	{
-		193, 0, 1, 2, 3, 4, 5, 193, 6, 7, 193, 6, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 194, 25, 26,
-		27, 28, 29, 30, 31, 32, 33, 28, 34, 32, 193, 35, 34, 35, 36, 34, 35, 37, 32, 34, 32, 35, 198, 34, 35, 193, 34, 35, 34, 35,
-		195, 34, 38, 35, 39, 40, 193, 35, 194, 34, 35, 34, 193, 37, 193, 34, 35, 193, 34, 193, 35, 195, 34, 36, 204, 35, 36, 204,
-		35, 36, 35, 37, 41, 42, 43, 41, 44, 193, 26, 43, 26, 45, 46, 45, 47, 45, 193, 48, 34, 35, 26, 49, 50, 35, 51, 193, 34, 52,
-		194, 34, 35, 34, 194, 35, 32, 193, 35, 34, 193, 53, 54, 55, 53, 32, 255, 3, 35, 34, 35, 193, 53, 35, 36, 56, 53, 57, 34,
-		35, 34, 37, 195, 34, 194, 35, 36, 34, 35, 31, 194, 45, 58, 255, 9, 34, 35, 49, 34, 43, 31, 35, 32, 59, 60, 193, 31, 49, 45,
-		48, 193, 61, 60, 31, 51, 61, 62, 31, 38, 63, 194, 64, 57, 193, 31, 51, 193, 31, 193, 62, 65, 49, 31, 59, 194, 38, 66, 61,
-		62, 61, 45, 193, 62, 67, 31, 38, 62, 38, 59, 62, 64, 31, 45, 43, 38, 31, 59, 51, 31, 49, 64, 38, 62, 38, 61, 45, 193, 38,
-		61, 38, 49, 67, 38, 45, 43, 193, 31, 51, 59, 66, 49, 38, 62, 45, 68, 48, 49, 51, 38, 48, 49, 51, 196, 38, 62, 48, 64, 193,
-		61, 45, 194, 62, 69, 193, 38, 62, 69, 45, 69, 45, 59, 67, 31, 43, 198, 38, 62, 69, 49, 38, 45, 38, 70, 38, 67, 195, 31, 38,
-		31, 49, 193, 62, 69, 38, 45, 69, 62, 67, 49, 62, 69, 193, 38, 45, 62, 67, 193, 31, 38, 62, 45, 49, 62, 69, 193, 38, 45, 70,
-		62, 67, 193, 31, 49, 62, 193, 38, 70, 69, 45, 38, 193, 67, 194, 31, 62, 69, 49, 194, 38, 62, 45, 38, 62, 67, 193, 31, 38,
-		62, 69, 49, 38, 45, 38, 62, 70, 45, 62, 67, 38, 193, 62, 69, 49, 193, 38, 45, 38, 70, 193, 62, 45, 31, 38, 31, 38, 67, 193,
-		31, 49, 69, 38, 45, 70, 62, 67, 31, 49, 38, 62, 71, 31, 72, 66, 45, 31, 67, 51, 49, 38, 62, 71, 72, 66, 45, 67, 193, 38,
-		193, 31, 51, 45, 67, 194, 31, 73, 49, 193, 38, 62, 69, 38, 193, 62, 31, 45, 196, 31, 193, 38, 193, 69, 193, 62, 193, 45,
-		67, 59, 31, 67, 73, 67, 73, 69, 62, 31, 34, 49, 34, 194, 38, 31, 68, 194, 38, 193, 74, 195, 38, 49, 48, 62, 31, 51, 59, 75,
-		193, 31, 194, 76, 49, 32, 60, 38, 51, 59, 38, 24, 38, 193, 31, 49, 38, 51, 193, 38, 49, 38, 49, 62, 48, 38, 62, 48, 59, 49,
-		38, 62, 49, 38, 49, 62, 38, 47, 69, 62, 45, 51, 68, 193, 31, 45, 49, 67, 193, 31, 51, 59, 51, 60, 59, 77, 78, 30, 49, 67,
-		38, 66, 79, 62, 194, 38, 49, 62, 69, 45, 31, 59, 67, 194, 38, 72, 67, 75, 193, 31, 38, 62, 69, 49, 31, 38, 69, 62, 48, 45,
-		67, 31, 66, 59, 45, 58, 62, 69, 38, 45, 73, 49, 67, 59, 31, 51, 31, 62, 69, 38, 73, 45, 62, 67, 193, 38, 48, 69, 62, 67,
-		49, 31, 38, 69, 62, 80, 45, 49, 59, 51, 193, 67, 38, 43, 44, 59, 199, 32, 49, 31, 49, 45, 81, 73, 38, 193, 69, 45, 38, 73,
-		193, 37, 193, 41, 42, 82, 193, 35, 83, 82, 84, 82, 193, 45, 48, 62, 45, 193, 48, 32, 37, 193, 34, 193, 35, 34, 197, 35, 32,
-		40, 34, 40, 35, 197, 34, 24, 30, 85, 86, 87, 88, 89, 193, 90, 28, 91, 193, 23, 65, 24, 92, 67, 93, 193, 25, 193, 92, 193,
-		25, 29, 88, 67, 25, 24, 30, 193, 94, 95, 65, 84, 57, 96, 193, 97, 193, 82, 203, 31, 98, 194, 58, 194, 98, 31, 54, 99, 100,
-		34, 97, 193, 34, 101, 34, 102, 37, 193, 31, 193, 99, 54, 57, 103, 194, 31, 35, 193, 31, 104, 105, 193, 38, 31, 29, 89, 193,
-		25, 29, 106, 25, 194, 89, 193, 25, 89, 25, 29, 89, 197, 25, 107, 108, 109, 193, 31, 89, 198, 25, 31, 29, 193, 89, 194, 29,
-		195, 89, 193, 25, 34, 49, 35, 194, 34, 193, 35, 195, 34, 37, 84, 82, 193, 34, 35, 37, 31, 34, 35, 45, 34, 35, 49, 193, 31,
-		193, 35, 193, 38, 49, 68, 31, 48, 62, 193, 25, 88, 25, 88, 195, 25, 92, 110, 193, 25, 88, 92, 25, 88, 111, 28, 193, 25, 112,
-		113, 111, 66, 193, 114, 28, 115, 66, 114, 68, 38, 31, 49, 193, 38, 45, 116, 66, 60, 38, 31, 44, 66, 38, 49, 194, 38, 193,
-		31, 193, 38, 196, 31, 199, 117, 38, 66, 193, 31, 38, 68, 51, 59, 38, 66, 51, 59, 67, 49, 38, 58, 31, 62, 43, 41, 62, 193,
-		38, 45, 31, 59, 51, 49, 63, 193, 43, 26, 34, 63, 34, 37, 38, 34, 35, 34, 35, 37, 34, 35, 201, 34, 35, 38, 41, 193, 38, 48,
-		69, 62, 31, 38, 31, 59, 49, 69, 38, 45, 62, 49, 59, 67, 45, 193, 31, 38, 49, 67, 38, 62, 45, 81, 59, 38, 62, 69, 73, 49,
-		31, 62, 69, 38, 45, 73, 31, 51, 59, 49, 66, 67, 38, 45, 66, 67, 49, 38, 62, 69, 49, 67, 31, 59, 38, 66, 31, 73, 38, 62, 72,
-		45, 118, 66, 31, 51, 38, 69, 62, 59, 66, 45, 38, 35, 26, 41, 193, 37, 32, 38, 69, 62, 59, 73, 45, 67, 38, 193, 22, 196, 114,
-		32, 38, 61, 38, 57, 63, 119, 193, 25, 120, 31, 78, 31, 63, 193, 31, 45, 31, 60, 193, 31, 193, 121, 193, 31, 122, 123, 59,
-		97, 124, 30, 121, 125, 126, 127, 128, 129, 193, 31, 38, 130, 95, 131, 193, 31, 120, 38, 31, 38, 196, 31, 38, 49, 38, 49,
-		45, 31, 193, 38, 31, 194, 38, 49, 38, 62, 38, 49, 51, 38, 51, 38, 193, 34, 193, 35, 193, 38, 49, 67, 34, 49, 35, 38, 49,
-		38, 31, 194, 38, 51, 31, 38, 193, 31, 38, 49, 31, 38, 49, 31, 38, 193, 31, 49, 51, 38, 49, 31, 193, 38, 31, 38, 62, 49, 48,
-		193, 31, 59, 38, 193, 31, 38, 31, 38, 31, 45, 49, 31, 51, 31, 38, 49, 31, 51, 38, 31, 38, 31, 38, 51, 31, 38, 34, 35, 193,
-		31, 69, 62, 38, 48, 59, 51, 49, 31, 67, 193, 48, 69, 38, 62, 45, 31, 64, 59, 49, 38, 67, 62, 38, 69, 45, 49, 67, 31, 59,
-		38, 45, 31, 49, 62, 69, 38, 73, 59, 193, 31, 45, 59, 49, 67, 193, 38, 59, 31, 38, 49, 69, 62, 73, 45, 59, 51, 31, 62, 38,
-		49, 59, 38, 62, 69, 45, 49, 67, 193, 62, 69, 49, 38, 45, 70, 73, 38, 132, 38, 69, 62, 45, 59, 51, 31, 67, 49, 38, 70, 69,
-		62, 45, 31, 49, 67, 38, 70, 69, 62, 49, 45, 31, 59, 51, 77, 59, 38, 62, 38, 69, 62, 45, 59, 31, 49, 67, 31, 38, 62, 69, 73,
-		45, 49, 67, 38, 49, 62, 69, 45, 67, 31, 59, 31, 34, 35, 67, 31, 193, 38, 62, 69, 48, 45, 31, 59, 38, 62, 69, 49, 133, 45,
-		31, 59, 51, 193, 38, 49, 69, 62, 45, 59, 51, 31, 67, 193, 31, 51, 38, 49, 62, 69, 38, 62, 45, 67, 194, 38, 49, 193, 38, 193,
-		51, 196, 38, 49, 67, 59, 38, 45, 59, 38, 62, 59, 51, 193, 31, 68, 66, 67, 31, 38, 49, 69, 45, 43, 193, 66, 114, 49, 194,
-		38, 114, 49, 38, 49, 31, 48, 62, 59, 30, 31, 134, 67, 45, 73, 115, 30, 48, 31, 54, 99, 103, 99, 57, 54, 99, 93, 31, 48, 51,
-		59, 31, 62, 38, 31, 45, 34, 35, 80, 62, 45, 49, 67, 31, 102, 57, 194, 31, 193, 135, 193, 31, 136, 193, 31, 63, 195, 31, 120,
-		193, 117, 114, 95, 30, 137, 78, 22, 49
-	};
-
-	static constexpr std::array<std::uint_least8_t, 1194> rlecflagindices =
-	{
-		193, 0, 1, 2, 3, 194, 4, 5, 194, 4, 5, 194, 4, 6, 4, 7, 8, 5, 9, 5, 10, 193, 11, 0, 2, 3, 4, 194, 5, 11, 4, 194, 5, 11, 193,
-		4, 8, 194, 11, 8, 193, 11, 8, 194, 11, 8, 193, 11, 198, 8, 11, 193, 8, 11, 8, 11, 195, 8, 12, 11, 8, 12, 193, 11, 194, 8,
-		11, 8, 193, 11, 193, 8, 11, 193, 8, 193, 11, 195, 8, 224, 11, 12, 11, 12, 193, 5, 12, 5, 13, 11, 196, 13, 8, 11, 5, 14, 193,
-		11, 4, 193, 8, 4, 194, 8, 11, 8, 197, 11, 8, 193, 11, 193, 8, 194, 11, 8, 11, 8, 11, 8, 196, 11, 8, 11, 5, 8, 11, 8, 11,
-		195, 8, 195, 11, 8, 11, 5, 195, 13, 255, 9, 8, 11, 14, 8, 12, 4, 193, 11, 193, 4, 193, 5, 14, 193, 13, 193, 12, 194, 4, 193,
-		12, 4, 12, 4, 195, 5, 4, 5, 193, 4, 5, 193, 12, 5, 14, 193, 4, 198, 12, 13, 193, 12, 6, 4, 194, 12, 4, 12, 193, 5, 13, 193,
-		12, 5, 194, 4, 14, 5, 195, 12, 13, 195, 12, 14, 6, 12, 13, 12, 5, 194, 4, 12, 14, 193, 12, 13, 12, 13, 14, 4, 12, 13, 14,
-		4, 197, 12, 13, 5, 193, 12, 13, 199, 12, 13, 12, 13, 4, 6, 4, 201, 12, 14, 12, 13, 194, 12, 6, 195, 5, 12, 4, 14, 195, 12,
-		13, 193, 12, 6, 14, 195, 12, 13, 12, 6, 4, 5, 193, 12, 13, 14, 195, 12, 13, 193, 12, 6, 193, 5, 14, 196, 12, 13, 12, 193,
-		6, 194, 5, 193, 12, 14, 195, 12, 13, 193, 12, 6, 193, 5, 194, 12, 14, 12, 13, 194, 12, 13, 12, 6, 195, 12, 14, 193, 12, 13,
-		195, 12, 13, 5, 12, 5, 12, 6, 193, 5, 14, 193, 12, 13, 193, 12, 6, 4, 14, 194, 12, 5, 193, 12, 13, 4, 6, 4, 14, 196, 12,
-		13, 6, 193, 12, 5, 193, 4, 13, 6, 5, 193, 4, 13, 14, 198, 12, 5, 13, 5, 193, 4, 5, 4, 197, 12, 193, 13, 6, 193, 4, 193, 13,
-		6, 13, 193, 12, 5, 8, 14, 8, 194, 12, 4, 201, 12, 14, 13, 12, 194, 4, 194, 5, 194, 8, 14, 11, 4, 12, 193, 4, 12, 3, 12, 193,
-		4, 14, 12, 4, 193, 12, 14, 12, 14, 12, 13, 193, 12, 13, 4, 14, 193, 12, 14, 12, 14, 193, 12, 13, 193, 12, 13, 4, 12, 4, 5,
-		13, 14, 6, 5, 198, 4, 13, 5, 14, 6, 198, 12, 14, 193, 12, 13, 5, 4, 6, 195, 12, 6, 194, 5, 194, 12, 14, 4, 194, 12, 193,
-		13, 6, 4, 12, 4, 193, 13, 194, 12, 193, 13, 14, 6, 194, 4, 5, 194, 12, 193, 13, 12, 6, 193, 12, 13, 193, 12, 13, 14, 4, 194,
-		12, 193, 13, 14, 193, 4, 193, 6, 194, 12, 4, 199, 11, 14, 4, 14, 13, 4, 13, 194, 12, 13, 12, 13, 203, 11, 194, 13, 12, 194,
-		13, 193, 11, 193, 8, 193, 11, 8, 198, 11, 12, 8, 12, 11, 197, 8, 3, 5, 193, 13, 5, 197, 4, 193, 15, 5, 3, 4, 193, 9, 197,
-		4, 5, 4, 9, 4, 3, 194, 5, 14, 5, 11, 193, 5, 193, 4, 193, 11, 203, 5, 198, 13, 5, 8, 11, 5, 8, 5, 193, 8, 5, 8, 12, 11, 193,
-		5, 193, 11, 8, 5, 11, 194, 5, 11, 193, 5, 8, 11, 193, 12, 199, 5, 193, 4, 204, 5, 14, 8, 11, 199, 5, 193, 4, 193, 5, 193,
-		4, 194, 5, 195, 4, 193, 5, 8, 14, 11, 194, 8, 193, 11, 195, 8, 194, 11, 193, 8, 193, 11, 5, 8, 11, 13, 8, 11, 14, 4, 5, 193,
-		11, 193, 12, 14, 12, 4, 13, 12, 201, 4, 12, 201, 4, 193, 5, 4, 194, 12, 4, 13, 195, 12, 4, 14, 193, 12, 13, 5, 12, 4, 12,
-		4, 194, 12, 14, 194, 12, 193, 5, 193, 12, 196, 5, 201, 12, 193, 5, 193, 12, 193, 4, 193, 12, 193, 4, 6, 14, 12, 13, 4, 193,
-		12, 11, 194, 12, 13, 194, 4, 14, 5, 193, 12, 5, 8, 5, 8, 11, 12, 8, 11, 8, 193, 11, 8, 11, 201, 8, 11, 12, 11, 193, 12, 13,
-		193, 12, 5, 12, 193, 4, 14, 193, 12, 13, 12, 14, 4, 6, 13, 193, 4, 12, 14, 6, 193, 12, 13, 193, 4, 194, 12, 13, 14, 4, 194,
-		12, 193, 13, 194, 4, 14, 12, 6, 12, 13, 12, 6, 14, 194, 12, 14, 6, 193, 4, 193, 12, 5, 13, 194, 12, 13, 193, 12, 193, 4,
-		194, 12, 4, 12, 13, 12, 11, 5, 195, 11, 194, 12, 4, 193, 13, 6, 12, 14, 5, 196, 12, 11, 194, 12, 193, 5, 12, 193, 4, 14,
-		5, 13, 195, 4, 13, 204, 4, 5, 193, 4, 6, 7, 5, 10, 193, 4, 193, 12, 14, 194, 5, 14, 12, 4, 12, 196, 5, 12, 14, 12, 14, 13,
-		5, 193, 12, 5, 194, 12, 14, 194, 12, 14, 4, 12, 4, 12, 193, 8, 193, 11, 193, 12, 14, 6, 8, 14, 11, 12, 14, 12, 4, 194, 12,
-		4, 5, 12, 193, 5, 12, 14, 5, 12, 14, 5, 12, 193, 5, 14, 4, 12, 14, 4, 193, 12, 5, 193, 12, 14, 13, 5, 193, 4, 12, 5, 4, 12,
-		5, 12, 5, 13, 14, 5, 193, 4, 12, 14, 193, 4, 12, 5, 12, 5, 12, 4, 5, 12, 8, 11, 193, 5, 194, 12, 13, 193, 4, 14, 5, 6, 193,
-		13, 194, 12, 13, 4, 5, 4, 14, 12, 6, 194, 12, 13, 14, 6, 193, 4, 12, 13, 4, 14, 194, 12, 13, 194, 4, 13, 4, 14, 6, 193, 12,
-		4, 5, 12, 14, 193, 12, 193, 13, 194, 4, 193, 12, 14, 4, 194, 12, 13, 14, 6, 194, 12, 14, 12, 13, 12, 13, 196, 12, 13, 194,
-		4, 6, 14, 195, 12, 13, 4, 14, 6, 195, 12, 14, 13, 196, 4, 196, 12, 13, 193, 4, 14, 6, 4, 194, 12, 193, 13, 14, 6, 12, 14,
-		193, 12, 13, 6, 5, 4, 5, 8, 11, 6, 5, 195, 12, 193, 13, 193, 4, 194, 12, 14, 193, 13, 194, 4, 193, 12, 14, 193, 12, 13, 194,
-		4, 6, 5, 193, 4, 12, 14, 195, 12, 13, 6, 194, 12, 14, 193, 12, 193, 4, 196, 12, 14, 6, 4, 12, 13, 4, 193, 12, 194, 4, 5,
-		193, 12, 6, 5, 12, 14, 12, 13, 195, 12, 14, 195, 12, 14, 12, 14, 5, 13, 12, 4, 193, 5, 196, 13, 5, 13, 5, 8, 194, 11, 5,
-		8, 11, 6, 5, 13, 194, 4, 193, 12, 5, 13, 8, 11, 13, 12, 13, 14, 6, 4, 12, 195, 5, 193, 8, 201, 5, 14, 194, 12, 14, 193, 5,
-		13, 5, 14
-	};
-
-	static constexpr std::array<std::uint_least16_t, 1039> rleabfields =
-	{
-		49229, 1024, 49155, 4096, 6144, 7168, 49158, 8192, 49157, 9216, 49180, 1024, 4096, 49156, 1024, 49154, 4096, 7168, 49153,
-		1024, 4096, 6144, 7168, 8192, 6144, 49153, 10240, 1024, 0, 1024, 9216, 1024, 16384, 49164, 1024, 10240, 49157, 1024, 4096,
-		49153, 6144, 1024, 4096, 49157, 1024, 49153, 5120, 6144, 49154, 7168, 49153, 8192, 4105, 49154, 1033, 4105, 49158, 1033,
-		10249, 4105, 49153, 6153, 49153, 4105, 1033, 9225, 49153, 8201, 49153, 9225, 49153, 10249, 49153, 11273, 49153, 12297, 49153,
-		16393, 11, 49157, 1035, 4107, 16395, 13323, 12, 2060, 8204, 1036, 9228, 49154, 1036, 2060, 49153, 8204, 49153, 1036, 7181,
-		13325, 16397, 49153, 10253, 8205, 1037, 49154, 7181, 10253, 15373, 13, 8205, 1037, 12301, 1037, 10253, 49153, 1037, 4109,
-		49153, 7181, 8205, 12301, 49153, 1037, 6157, 1037, 4109, 49157, 1037, 7181, 4109, 49154, 4110, 14, 49154, 4110, 7182, 49153,
-		4110, 8205, 49153, 4112, 6160, 16, 49160, 9233, 17, 49156, 11282, 18, 11282, 49153, 12307, 19, 12307, 19470, 13325, 16397,
-		17421, 49155, 18445, 17421, 49153, 13325, 16397, 11286, 49153, 1046, 7190, 1046, 49153, 12310, 1046, 11286, 49155, 1046,
-		49153, 10262, 12310, 16406, 11286, 9238, 8214, 16407, 49153, 1047, 23, 49153, 1047, 7191, 1047, 8215, 49155, 1047, 11287,
-		49153, 19479, 24, 7192, 1048, 7192, 49154, 1048, 10264, 1048, 25, 49154, 1049, 7193, 1049, 7193, 1049, 13337, 7193, 17433,
-		49153, 19481, 26, 49154, 1050, 7194, 49153, 1050, 10266, 49153, 1050, 12314, 27, 49153, 1051, 8219, 49154, 1051, 10267, 8219,
-		49153, 1051, 49153, 7195, 16412, 1052, 28, 1052, 16412, 10268, 49153, 1052, 17436, 10268, 1052, 49153, 10268, 18461, 16413,
-		1053, 29, 1053, 49153, 7197, 49154, 1053, 9245, 1053, 9245, 19486, 16414, 1054, 30, 1054, 12318, 19486, 10270, 49153, 1054,
-		10270, 1054, 49154, 18462, 17438, 1054, 49153, 10270, 31, 49156, 4127, 16415, 4127, 32, 49161, 1056, 33, 49158, 1057, 13345,
-		49161, 2082, 34, 4130, 10274, 49153, 2082, 49153, 12322, 49154, 4130, 10274, 8226, 10274, 11298, 12322, 4131, 49153, 10275,
-		49153, 4131, 10275, 4131, 10275, 49154, 4131, 49154, 10275, 49154, 11299, 10275, 1060, 36, 13348, 1060, 6180, 8228, 1060,
-		8228, 13348, 1024, 11264, 49154, 1024, 11264, 4134, 8230, 38, 12326, 49153, 8230, 49155, 4134, 8230, 49153, 4136, 17448,
-		40, 17448, 11264, 49154, 4096, 11264, 49155, 4138, 42, 49154, 4139, 16427, 43, 6188, 44, 49153, 6188, 49155, 6189, 45, 49153,
-		6190, 46, 6191, 47, 6191, 49160, 4144, 7216, 48, 4144, 7216, 49160, 4145, 49, 49156, 4145, 10289, 7219, 16435, 51, 49157,
-		7219, 7168, 8192, 11264, 49153, 8192, 11264, 8192, 7216, 49154, 8247, 55, 8247, 49160, 11264, 49153, 16384, 49156, 9274,
-		58, 49156, 9274, 49155, 10299, 49153, 13371, 10299, 13371, 49156, 12348, 60, 12348, 49156, 10301, 61, 49154, 10301, 49156,
-		10240, 49159, 18441, 9, 13371, 59, 49156, 11264, 49154, 13312, 19456, 49156, 7168, 49158, 8192, 9216, 49153, 10240, 16384,
-		19456, 18432, 12288, 2048, 49155, 10240, 49184, 1024, 4096, 49156, 1024, 6144, 49153, 4096, 49153, 6144, 49153, 7168, 8192,
-		49154, 6144, 10240, 0, 15360, 6144, 49156, 1024, 12288, 1024, 2048, 3072, 4096, 6144, 8192, 11264, 12288, 14336, 16384, 17408,
-		19456, 49153, 1024, 4096, 49153, 6144, 8192, 9216, 49162, 1024, 49153, 4096, 7168, 8192, 49156, 6144, 8192, 49153, 9216,
-		10240, 11264, 49154, 1024, 10240, 17408, 49154, 1101, 4173, 6221, 1024, 4096, 49153, 1024, 49153, 6144, 49153, 7168, 8192,
-		49154, 9216, 11264, 12288, 16384, 18432, 19456, 0, 49153, 1024, 6144, 7168, 1024, 10240, 16471, 1111, 12375, 11351, 49153,
-		6231, 1111, 49154, 8192, 13312, 10240, 12288, 49153, 6144, 49153, 10240, 4096, 17408, 8287, 95, 8287, 49156, 9216, 49154,
-		10240, 11264, 9216, 49153, 10240, 11264, 49155, 8289, 49154, 11361, 49153, 13409, 97, 49153, 8289, 8228, 13348, 8291, 13411,
-		99, 8291, 49153, 12387, 10249, 49154, 8192, 49159, 10240, 11264, 49153, 13312, 49156, 16384, 18432, 19456, 49153, 4096, 49158,
-		1024, 4096, 49154, 6144, 107, 1131, 6251, 49154, 1131, 6252, 49155, 1132, 6252, 109, 1133, 10349, 19565, 49153, 1135, 4205,
-		12397, 1024, 7168, 11264, 8192, 1024, 4096, 1024, 8192, 10240, 11264, 13312, 17408, 19456, 49154, 4096, 6144, 49155, 11386,
-		49156, 10363, 123, 49154, 10249, 13321, 10249, 16393, 17417, 49157, 11389, 125, 8192, 9216, 10240, 9216, 49153, 10240, 49153,
-		12288, 17408, 49153, 12288, 49153, 13312, 49154, 16384, 13312, 49154, 16384, 18432, 49153, 16384, 49155, 17408, 16384, 13312,
-		10240, 49156, 8192, 49154, 9346, 130, 49154, 10371, 18563, 131, 49153, 10371, 49153, 11286, 49153, 17430, 22, 49157, 10240,
-		49155, 10374, 134, 10374, 49159, 11400, 136, 49153, 11400, 49155, 16419, 35, 49154, 10378, 138, 49154, 10378, 49154, 11299,
-		16419, 49159, 11264, 49157, 13312, 12326, 49154, 16384, 17408, 16384, 17448, 49158, 11264, 49153, 2048, 49153, 1024, 13312,
-		6144, 11264, 8192, 1024, 4096, 49154, 1024, 12301, 49154, 1037, 5133, 6157, 6144, 49155, 8192, 17408, 49157, 1024, 49153,
-		7168, 49156, 1024, 1037, 49157, 1024, 49153, 6144, 49153, 1024, 162, 4258, 3234, 49153, 1186, 49153, 7168, 49154, 8192, 49153,
-		16384, 18432, 10409, 169, 10410, 170, 49153, 16481, 5120, 16384, 5120, 19456, 49153, 5293, 173, 49153, 16384, 7343, 175,
-		7343, 49154, 8192, 5297, 7345, 5297, 7345, 7346, 7347, 179, 7347, 18612, 180, 18612, 16565, 181, 49154, 16384, 7168, 49154,
-		11264, 49154, 16570, 16571, 187, 16571, 17596, 188, 17596, 49153, 9405, 11453, 189, 9405, 10430, 190, 10430, 49153, 13312,
-		17408, 49153, 8385, 193, 49155, 8385, 49154, 11264, 49153, 16384, 49154, 16580, 196, 49154, 16580, 11461, 197, 49153, 11461,
-		49155, 11264, 49154, 16384, 11264, 49154, 17408, 11264, 49157, 12492, 204, 49153, 12492, 16588, 49159, 11469, 205, 49153,
-		13312, 49155, 13519, 207, 49154, 13519, 49154, 16592, 208, 49157, 13521, 49153, 17617, 16593, 209, 13521, 16593, 49153, 17617,
-		16415, 16595, 211, 49158, 16595, 18643, 17620, 212, 17620, 49155, 16597, 213, 16597, 17622, 49153, 16598, 214, 49155, 16598,
-		17622, 16598, 49159, 18647, 215, 49157, 16600, 216, 16600, 49155, 16601, 217, 49156, 16601, 49154, 17625, 49157, 16602, 218,
-		16602, 18481, 49156, 13532, 220, 13532, 17629, 221, 49158, 17629, 49156, 16384, 49158, 19456, 49154, 19680, 224, 49156, 19680,
-		16384, 18658, 226, 49159, 18658, 49154, 18659, 227, 49153, 18659, 49155, 19456, 9445, 16613, 17637, 229, 9445, 16613, 9445,
-		16613, 17408, 11264, 17408, 12413, 16619, 235, 49153, 16619, 49164, 16384, 13550, 238, 49154, 13550, 18432, 19456, 18672,
-		240, 49153, 12288, 19456, 19700, 244, 16629, 245, 49155, 16629, 16384, 49158, 5120, 8192, 9216, 49154, 5120, 7168, 5120,
-		49153, 9216, 5120, 49156, 17408, 18527, 49154, 16384, 49156, 18688, 256, 49153, 18688, 49153, 13325, 12288, 49153, 16384,
-		12288, 11264, 13312, 18432, 12288, 11264, 19456, 17408, 13576, 12552, 16648, 17672, 2048, 5120, 12288, 5120, 277, 49153,
-		5397, 7168, 2048, 0
-	};
-
-	static constexpr std::array<std::uint_least8_t, 1342> rlegcindices =
-	{
-		195, 25, 24, 194, 16, 18, 16, 17, 13, 20, 16, 12, 16, 8, 16, 193, 4, 19, 11, 19, 194, 0, 193, 25, 24, 16, 18, 21, 19, 2,
-		15, 20, 26, 10, 0, 16, 14, 4, 194, 0, 4, 193, 0, 4, 194, 0, 4, 193, 0, 198, 4, 0, 193, 4, 0, 4, 0, 195, 4, 2, 0, 4, 3, 193,
-		0, 194, 4, 0, 4, 193, 0, 193, 4, 0, 193, 4, 193, 0, 195, 4, 222, 0, 196, 1, 193, 19, 1, 19, 198, 7, 4, 0, 19, 27, 1, 0, 16,
-		193, 4, 16, 194, 4, 0, 4, 197, 0, 4, 193, 0, 193, 4, 194, 0, 4, 0, 4, 0, 4, 196, 0, 4, 0, 20, 4, 0, 4, 0, 195, 4, 195, 0,
-		4, 0, 21, 194, 7, 6, 255, 9, 4, 0, 27, 4, 1, 16, 193, 0, 16, 12, 21, 18, 27, 195, 7, 12, 193, 16, 193, 7, 16, 2, 16, 194,
-		26, 20, 16, 18, 193, 16, 21, 193, 7, 26, 27, 193, 16, 194, 2, 1, 197, 7, 8, 16, 2, 7, 2, 16, 7, 26, 21, 7, 1, 2, 21, 194,
-		16, 27, 26, 2, 7, 2, 193, 7, 193, 2, 7, 2, 27, 8, 2, 7, 1, 21, 194, 16, 1, 27, 2, 193, 7, 1, 7, 27, 16, 2, 7, 27, 16, 196,
-		2, 193, 7, 26, 197, 7, 5, 193, 2, 7, 5, 7, 5, 7, 16, 8, 16, 1, 198, 2, 7, 5, 27, 2, 7, 2, 5, 2, 8, 18, 10, 21, 18, 2, 16,
-		27, 193, 7, 5, 2, 7, 5, 7, 8, 27, 7, 5, 193, 2, 193, 7, 8, 16, 18, 2, 193, 7, 27, 7, 5, 193, 2, 7, 5, 7, 8, 21, 10, 27, 7,
-		193, 2, 193, 5, 7, 2, 193, 8, 10, 21, 18, 7, 5, 27, 194, 2, 193, 7, 2, 7, 8, 10, 21, 2, 7, 5, 27, 2, 7, 2, 7, 5, 193, 7,
-		8, 2, 193, 7, 5, 27, 193, 2, 7, 2, 5, 194, 7, 21, 2, 10, 2, 8, 10, 21, 27, 5, 2, 7, 5, 7, 8, 16, 27, 2, 7, 2, 18, 2, 1, 7,
-		16, 8, 16, 27, 2, 7, 193, 2, 1, 7, 8, 193, 2, 21, 193, 16, 7, 8, 10, 17, 13, 5, 27, 193, 2, 7, 5, 2, 193, 7, 21, 7, 21, 193,
-		16, 21, 16, 193, 2, 193, 5, 195, 7, 8, 193, 16, 193, 5, 8, 193, 5, 7, 21, 4, 27, 4, 194, 2, 16, 1, 200, 2, 27, 193, 7, 194,
-		16, 193, 10, 21, 194, 4, 27, 0, 12, 2, 193, 16, 2, 24, 2, 17, 13, 27, 2, 16, 9, 2, 27, 2, 27, 193, 7, 2, 193, 7, 16, 27,
-		2, 7, 27, 2, 27, 7, 2, 7, 5, 193, 7, 16, 1, 16, 18, 7, 27, 8, 10, 195, 16, 12, 193, 16, 7, 26, 27, 8, 2, 1, 193, 7, 194,
-		2, 27, 7, 5, 7, 21, 16, 8, 195, 2, 8, 10, 193, 21, 2, 7, 5, 27, 16, 2, 5, 194, 7, 8, 16, 1, 16, 7, 6, 7, 5, 2, 7, 5, 27,
-		8, 194, 16, 21, 7, 5, 2, 5, 193, 7, 8, 193, 2, 7, 5, 7, 5, 27, 16, 2, 5, 194, 7, 27, 193, 16, 193, 8, 2, 193, 1, 16, 199,
-		0, 27, 16, 27, 7, 16, 5, 2, 193, 5, 7, 2, 5, 193, 0, 195, 1, 194, 0, 194, 1, 198, 7, 193, 0, 193, 4, 193, 0, 4, 198, 0, 3,
-		4, 3, 0, 197, 4, 24, 195, 26, 12, 16, 15, 14, 17, 16, 22, 23, 26, 24, 16, 193, 11, 17, 13, 195, 16, 20, 16, 11, 16, 24, 194,
-		26, 27, 26, 1, 193, 20, 17, 13, 193, 1, 203, 18, 7, 194, 6, 194, 7, 21, 4, 0, 20, 4, 21, 193, 4, 21, 4, 2, 0, 193, 21, 193,
-		0, 4, 20, 0, 194, 21, 0, 21, 10, 195, 9, 21, 20, 194, 21, 193, 20, 21, 17, 13, 196, 21, 20, 198, 21, 27, 193, 21, 193, 10,
-		197, 21, 17, 13, 10, 20, 17, 13, 194, 20, 17, 13, 17, 13, 193, 21, 4, 27, 0, 194, 4, 193, 0, 195, 4, 0, 193, 1, 193, 4, 193,
-		0, 21, 4, 0, 7, 4, 0, 27, 16, 10, 193, 0, 193, 2, 27, 1, 16, 193, 7, 15, 14, 12, 16, 12, 15, 14, 17, 13, 16, 1, 193, 16,
-		12, 193, 16, 12, 16, 17, 193, 16, 193, 21, 16, 1, 2, 9, 13, 5, 1, 9, 1, 2, 16, 27, 193, 2, 7, 19, 1, 12, 2, 16, 193, 1, 2,
-		27, 194, 2, 21, 10, 193, 2, 196, 21, 200, 2, 1, 193, 21, 2, 1, 193, 16, 2, 1, 193, 16, 8, 27, 2, 6, 16, 7, 193, 1, 7, 2,
-		9, 7, 194, 16, 27, 19, 193, 1, 19, 4, 19, 4, 0, 2, 4, 0, 4, 193, 0, 4, 0, 201, 4, 0, 2, 1, 193, 2, 7, 5, 7, 21, 2, 193, 16,
-		27, 5, 2, 193, 7, 27, 16, 8, 7, 193, 16, 2, 27, 8, 2, 193, 7, 193, 16, 2, 7, 193, 5, 27, 16, 7, 5, 2, 7, 5, 194, 16, 27,
-		1, 8, 2, 7, 1, 8, 27, 2, 7, 5, 27, 8, 193, 16, 2, 1, 21, 5, 2, 7, 2, 7, 2, 1, 193, 16, 2, 5, 7, 16, 1, 7, 2, 0, 19, 1, 194,
-		0, 2, 5, 7, 16, 5, 7, 8, 2, 29, 28, 196, 2, 0, 2, 7, 2, 20, 19, 2, 13, 17, 27, 18, 7, 193, 16, 17, 13, 7, 16, 12, 255, 3,
-		17, 13, 195, 16, 12, 26, 193, 16, 8, 4, 19, 0, 17, 13, 2, 1, 27, 26, 193, 21, 27, 2, 16, 9, 10, 21, 10, 193, 21, 2, 27, 2,
-		27, 7, 10, 193, 2, 10, 193, 2, 9, 27, 2, 7, 2, 27, 16, 2, 16, 9, 193, 4, 193, 0, 193, 2, 27, 8, 4, 27, 0, 2, 27, 2, 16, 194,
-		2, 16, 10, 2, 21, 10, 2, 27, 10, 2, 27, 10, 2, 193, 10, 27, 16, 2, 27, 16, 193, 2, 10, 2, 7, 27, 7, 10, 193, 16, 2, 10, 16,
-		2, 10, 2, 21, 7, 27, 10, 193, 16, 2, 27, 193, 16, 2, 10, 2, 10, 2, 16, 10, 2, 4, 0, 193, 10, 5, 7, 2, 7, 193, 16, 27, 10,
-		8, 193, 7, 5, 2, 193, 7, 16, 26, 16, 27, 2, 8, 7, 2, 5, 7, 27, 8, 193, 16, 2, 7, 16, 27, 7, 5, 2, 5, 194, 16, 7, 16, 27,
-		8, 193, 2, 16, 10, 2, 27, 5, 7, 5, 7, 194, 16, 7, 2, 27, 16, 2, 7, 5, 7, 27, 8, 193, 7, 5, 27, 2, 7, 193, 5, 194, 2, 5, 193,
-		7, 194, 16, 8, 27, 2, 193, 5, 193, 7, 16, 27, 8, 2, 193, 5, 7, 27, 7, 196, 16, 2, 7, 2, 5, 193, 7, 193, 16, 27, 8, 16, 2,
-		7, 193, 5, 7, 27, 8, 2, 27, 7, 5, 7, 8, 10, 16, 21, 4, 0, 8, 10, 193, 2, 7, 5, 193, 7, 193, 16, 2, 7, 5, 27, 193, 7, 194,
-		16, 193, 2, 27, 5, 193, 7, 194, 16, 8, 10, 193, 16, 2, 27, 7, 5, 2, 193, 7, 8, 194, 2, 27, 193, 9, 193, 16, 196, 2, 27, 8,
-		16, 2, 7, 16, 2, 7, 194, 16, 21, 193, 1, 8, 10, 2, 27, 5, 7, 194, 1, 2, 27, 195, 2, 27, 2, 27, 21, 193, 7, 16, 26, 21, 193,
-		5, 7, 193, 5, 26, 7, 10, 4, 194, 0, 20, 4, 0, 8, 21, 7, 194, 16, 7, 2, 10, 7, 4, 0, 194, 7, 27, 8, 16, 2, 20, 193, 21, 10,
-		198, 21, 19, 195, 21, 27, 194, 2, 27, 193, 26, 7, 28, 27
-	};
-
-	static constexpr std::array<std::uint_least8_t, 710> rlescindices =
-	{
-		209, 1, 193, 34, 194, 1, 194, 34, 198, 1, 34, 198, 1, 254, 34, 195, 1, 6, 193, 1, 198, 2, 194, 21, 0, 193, 21, 1, 193, 21,
-		1, 214, 21, 193, 12, 203, 21, 202, 14, 2, 211, 14, 0, 196, 4, 1, 194, 4, 0, 203, 27, 193, 3, 1, 194, 3, 1, 196, 3, 0, 3,
-		1, 194, 3, 1, 193, 2, 198, 3, 2, 194, 3, 1, 196, 3, 194, 50, 0, 197, 50, 3, 194, 56, 0, 200, 64, 0, 196, 90, 0, 90, 193,
-		95, 0, 95, 50, 197, 3, 1, 195, 3, 200, 16, 2, 1, 200, 16, 194, 5, 0, 203, 5, 0, 199, 23, 0, 203, 22, 0, 201, 44, 0, 203,
-		54, 193, 55, 0, 201, 55, 194, 29, 0, 200, 29, 194, 37, 0, 206, 37, 0, 198, 48, 0, 194, 57, 1, 197, 57, 0, 199, 33, 201, 58,
-		0, 203, 58, 1, 58, 209, 39, 18, 0, 195, 18, 1, 193, 18, 197, 25, 193, 17, 0, 199, 17, 194, 11, 0, 11, 196, 10, 195, 41, 0,
-		46, 1, 193, 46, 0, 51, 0, 193, 51, 194, 26, 1, 0, 193, 9, 0, 52, 0, 52, 201, 32, 0, 193, 32, 38, 193, 1, 197, 38, 0, 197,
-		38, 193, 35, 0, 197, 35, 53, 197, 40, 32, 194, 8, 0, 8, 200, 91, 193, 2, 196, 62, 0, 196, 62, 199, 76, 196, 93, 0, 93, 196,
-		70, 0, 194, 70, 196, 73, 199, 14, 0, 76, 0, 2, 196, 1, 2, 193, 1, 21, 14, 34, 21, 34, 14, 196, 34, 21, 198, 2, 196, 34, 210,
-		21, 193, 1, 193, 2, 219, 1, 0, 1, 34, 195, 1, 193, 34, 203, 1, 198, 2, 195, 1, 21, 1, 193, 34, 1, 34, 203, 1, 34, 193, 1,
-		195, 34, 214, 1, 0, 214, 1, 7, 1, 19, 0, 19, 204, 34, 200, 12, 0, 193, 12, 193, 18, 193, 59, 0, 194, 59, 14, 212, 1, 24,
-		193, 1, 24, 1, 24, 1, 25, 1, 193, 24, 193, 1, 0, 193, 28, 2, 1, 28, 1, 30, 193, 1, 193, 30, 0, 194, 6, 193, 1, 193, 6, 193,
-		25, 1, 25, 30, 199, 24, 195, 61, 195, 86, 196, 77, 0, 198, 14, 197, 79, 0, 195, 1, 34, 1, 215, 34, 196, 49, 194, 65, 0, 195,
-		75, 0, 193, 75, 195, 16, 0, 195, 69, 1, 69, 195, 74, 0, 74, 199, 84, 0, 1, 84, 195, 39, 0, 194, 68, 0, 194, 68, 195, 39,
-		199, 92, 197, 87, 17, 34, 1, 193, 34, 21, 11, 198, 87, 25, 193, 0, 196, 24, 4, 195, 27, 193, 3, 193, 1, 0, 3, 2, 195, 1,
-		14, 208, 1, 34, 1, 34, 193, 1, 30, 1, 0, 194, 1, 0, 36, 1, 197, 21, 71, 0, 67, 0, 2, 1, 195, 42, 193, 20, 0, 193, 118, 60,
-		0, 60, 194, 43, 195, 15, 47, 45, 0, 45, 136, 0, 136, 106, 0, 193, 104, 110, 13, 194, 81, 194, 120, 116, 0, 116, 128, 0, 128,
-		194, 66, 0, 66, 72, 0, 72, 98, 193, 97, 193, 31, 0, 195, 31, 194, 88, 193, 117, 194, 112, 0, 194, 112, 78, 0, 193, 78, 193,
-		83, 193, 82, 194, 121, 89, 194, 130, 3, 197, 94, 0, 194, 94, 199, 85, 0, 193, 101, 195, 96, 0, 194, 96, 194, 111, 0, 200,
-		100, 0, 195, 100, 48, 108, 0, 199, 108, 129, 0, 129, 195, 109, 0, 109, 194, 107, 0, 197, 107, 199, 135, 0, 197, 124, 0, 124,
-		195, 123, 0, 199, 123, 197, 114, 0, 114, 38, 196, 102, 0, 102, 126, 0, 198, 126, 196, 125, 198, 141, 194, 140, 0, 196, 140,
-		122, 133, 0, 199, 133, 194, 134, 0, 193, 134, 195, 138, 194, 63, 0, 196, 63, 80, 127, 79, 115, 0, 193, 115, 194, 103, 201,
-		119, 99, 0, 194, 99, 137, 139, 137, 0, 30, 193, 28, 139, 0, 105, 0, 195, 105, 195, 1, 2, 194, 1, 21, 200, 1, 196, 131, 19,
-		194, 113, 196, 132, 0, 193, 132, 193, 3, 199, 1, 28, 197, 1, 0, 194, 24, 0, 193, 1, 2, 193, 0
-	};
-
-	static constexpr std::array<std::uint_least8_t, 510> rlewfields =
-	{
-		16, 194, 0, 213, 32, 194, 0, 254, 32, 198, 16, 248, 32, 195, 16, 220, 32, 195, 16, 194, 32, 193, 16, 203, 32, 193, 16, 199,
-		32, 197, 16, 194, 32, 16, 193, 32, 16, 193, 32, 16, 200, 32, 16, 32, 193, 16, 193, 32, 16, 195, 32, 16, 199, 32, 193, 16,
-		32, 16, 194, 32, 16, 198, 32, 193, 16, 32, 197, 16, 194, 32, 16, 32, 16, 32, 16, 202, 32, 16, 194, 32, 16, 202, 32, 193,
-		16, 193, 32, 16, 32, 16, 193, 32, 16, 194, 32, 193, 16, 195, 32, 193, 16, 32, 16, 194, 32, 16, 32, 16, 195, 32, 16, 195,
-		32, 16, 197, 32, 16, 196, 32, 193, 16, 32, 16, 195, 32, 16, 194, 32, 16, 32, 16, 32, 193, 16, 193, 32, 193, 16, 195, 32,
-		16, 193, 32, 194, 16, 201, 32, 16, 32, 16, 195, 32, 16, 195, 32, 16, 196, 32, 16, 194, 32, 16, 197, 32, 16, 199, 32, 16,
-		193, 32, 193, 16, 32, 16, 200, 32, 195, 16, 199, 32, 16, 204, 32, 194, 16, 194, 32, 193, 16, 219, 32, 193, 16, 32, 193, 16,
-		194, 32, 16, 194, 32, 16, 32, 16, 32, 193, 16, 195, 32, 16, 201, 32, 16, 196, 32, 193, 16, 195, 32, 16, 32, 16, 203, 32,
-		16, 196, 32, 194, 16, 195, 32, 194, 16, 193, 32, 16, 198, 32, 16, 194, 32, 193, 16, 194, 32, 16, 32, 16, 196, 32, 194, 16,
-		211, 32, 16, 196, 32, 16, 205, 32, 198, 16, 216, 32, 195, 16, 197, 32, 194, 16, 206, 32, 193, 16, 213, 32, 198, 16, 254,
-		32, 16, 203, 32, 193, 16, 228, 32, 16, 235, 32, 16, 32, 16, 193, 32, 16, 193, 32, 16, 226, 32, 16, 32, 16, 198, 32, 193,
-		16, 194, 32, 16, 197, 32, 193, 16, 194, 32, 16, 195, 32, 16, 193, 32, 16, 199, 32, 16, 195, 32, 16, 201, 32, 16, 32, 16,
-		197, 32, 16, 193, 32, 16, 200, 32, 16, 193, 32, 16, 202, 32, 16, 199, 32, 16, 195, 32, 16, 232, 32, 16, 200, 32, 16, 238,
-		32, 16, 32, 16, 201, 32, 16, 212, 32, 16, 32, 16, 196, 32, 193, 16, 193, 32, 193, 16, 197, 32, 16, 193, 32, 16, 196, 32,
-		16, 193, 32, 16, 197, 32, 16, 201, 32, 16, 32, 16, 194, 32, 16, 195, 32, 16, 32, 16, 193, 32, 193, 16, 194, 32, 16, 197,
-		32, 193, 16, 199, 32, 193, 16, 197, 32, 16, 32, 16, 197, 32, 16, 193, 32, 193, 16, 197, 32, 16, 193, 32, 16, 195, 32, 16,
-		32, 16, 201, 32, 16, 32, 193, 16, 194, 32, 16, 193, 32, 193, 16, 198, 32, 193, 16, 200, 32, 16, 193, 32, 193, 16, 209, 32,
-		16, 193, 32, 16, 202, 32, 16, 204, 32, 193, 16, 196, 32, 16, 194, 32, 16, 201, 32, 16, 194, 32, 16, 193, 32, 16, 193, 32,
-		194, 16, 218, 32, 16, 32, 0
-	};
-
-	static constexpr std::array<std::uint_least8_t, 257> rlecfindices =
-	{
-		209, 0, 193, 1, 209, 0, 3, 193, 0, 1, 194, 0, 7, 197, 0, 9, 10, 0, 13, 14, 15, 16, 17, 18, 19, 0, 21, 22, 0, 24, 0, 26, 27,
-		28, 29, 193, 0, 31, 7, 193, 0, 34, 35, 7, 0, 36, 193, 0, 37, 7, 0, 38, 39, 193, 0, 41, 42, 43, 7, 232, 0, 73, 196, 0, 7, 197,
-		0, 73, 75, 0, 76, 77, 78, 0, 1, 194, 0, 7, 193, 0, 84, 85, 87, 193, 0, 89, 91, 255, 3, 0, 7, 0, 92, 95, 193, 0, 99, 82, 0,
-		7, 0, 101, 0, 36, 193, 102, 1, 195, 0, 7, 197, 0, 7, 0, 7, 0, 103, 255, 6, 0, 7, 193, 0, 104, 240, 0, 255, 4, 254, 0, 105,
-		0, 105, 218, 0, 93, 254, 0, 254, 0, 107, 109, 111, 113, 115, 117, 119, 121, 222, 0, 125, 0, 127, 7, 193, 0, 93, 198, 0, 93,
-		134, 135, 136, 94, 138, 139, 101, 140, 141, 254, 0, 142, 0, 143, 144, 0, 145, 206, 0, 147, 218, 0, 149, 215, 0, 104, 193, 0,
-		151, 152, 153, 193, 0, 156, 157, 158, 159, 194, 0, 160, 7, 194, 0, 7, 193, 0, 7, 254, 0, 162, 0, 163, 193, 0, 7, 0, 7, 193,
-		0, 7, 0, 164, 165, 166, 167, 164, 168, 169, 170, 171, 7, 254, 0, 173, 240, 0, 1, 231, 0, 193, 174, 197, 0, 174, 253, 0, 77,
-		254, 0, 254, 0, 1, 254, 0, 176, 225, 0
-	};
+	static constexpr std::array<raw_record, 256> latin1records =
+	{ {
+		{ UINT64_C(7), 512, 1024, 25, 1, 16, 0, 0, 0 }, { UINT64_C(7), 512, 1024, 25, 1, 0, 0, 0, 0 }, { UINT64_C(7), 512, 1024, 25, 1, 0, 0, 0, 0 },
+		{ UINT64_C(7), 512, 1024, 25, 1, 0, 0, 0, 0 }, { UINT64_C(7), 512, 1024, 25, 1, 0, 0, 0, 0 }, { UINT64_C(7), 512, 1024, 25, 1, 0, 0, 0, 0 },
+		{ UINT64_C(7), 512, 1024, 25, 1, 0, 0, 0, 0 }, { UINT64_C(7), 512, 1024, 25, 1, 0, 0, 0, 0 }, { UINT64_C(7), 512, 1024, 25, 1, 0, 0, 0, 0 },
+		{ UINT64_C(4294967319), 896, 1024, 25, 1, 0, 0, 0, 0 }, { UINT64_C(4294967327), 640, 1024, 25, 1, 0, 0, 0, 0 }, { UINT64_C(4294967327), 640, 1024, 25, 1, 0, 0, 0, 0 },
+		{ UINT64_C(4294967327), 640, 1024, 25, 1, 0, 0, 0, 0 }, { UINT64_C(4294967327), 640, 1024, 25, 1, 0, 0, 0, 0 }, { UINT64_C(7), 512, 1024, 25, 1, 0, 0, 0, 0 },
+		{ UINT64_C(7), 512, 1024, 25, 1, 0, 0, 0, 0 }, { UINT64_C(7), 512, 1024, 25, 1, 0, 0, 0, 0 }, { UINT64_C(7), 512, 1024, 25, 1, 0, 0, 0, 0 },
+		{ UINT64_C(7), 512, 1024, 25, 1, 0, 0, 0, 0 }, { UINT64_C(7), 512, 1024, 25, 1, 0, 0, 0, 0 }, { UINT64_C(7), 512, 1024, 25, 1, 0, 0, 0, 0 },
+		{ UINT64_C(7), 512, 1024, 25, 1, 0, 0, 0, 0 }, { UINT64_C(7), 512, 1024, 25, 1, 0, 0, 0, 0 }, { UINT64_C(7), 512, 1024, 25, 1, 0, 0, 0, 0 },
+		{ UINT64_C(7), 512, 1024, 25, 1, 0, 0, 0, 0 }, { UINT64_C(7), 512, 1024, 25, 1, 0, 0, 0, 0 }, { UINT64_C(7), 512, 1024, 25, 1, 0, 0, 0, 0 },
+		{ UINT64_C(7), 512, 1024, 25, 1, 0, 0, 0, 0 }, { UINT64_C(7), 512, 1024, 25, 1, 0, 0, 0, 0 }, { UINT64_C(7), 512, 1024, 25, 1, 0, 0, 0, 0 },
+		{ UINT64_C(7), 512, 1024, 25, 1, 0, 0, 0, 0 }, { UINT64_C(7), 512, 1024, 25, 1, 0, 0, 0, 0 }, { UINT64_C(140741783322647), 2432, 1024, 24, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140747152032263), 3080, 1024, 16, 1, 32, 0, 0, 0 }, { UINT64_C(140746078290183), 3080, 1024, 16, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140746078289927), 3080, 1024, 16, 1, 32, 0, 0, 0 }, { UINT64_C(140746078289927), 3072, 1024, 18, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140746078289927), 3080, 1024, 16, 1, 32, 0, 0, 0 }, { UINT64_C(140746078289927), 3080, 1024, 16, 1, 32, 0, 0, 0 },
+		{ UINT64_C(141295834104071), 3080, 1024, 16, 1, 32, 0, 0, 0 }, { UINT64_C(140746078289927), 3080, 1024, 17, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140746078289927), 3080, 1024, 13, 1, 32, 0, 0, 0 }, { UINT64_C(140746078289927), 3080, 1024, 16, 1, 32, 0, 0, 0 },
+		{ UINT64_C(703696031711239), 3072, 1024, 20, 1, 32, 0, 0, 0 }, { UINT64_C(140746078290439), 3080, 1024, 16, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140746078290055), 3080, 1024, 12, 1, 32, 0, 0, 0 }, { UINT64_C(141296907846151), 3080, 1024, 16, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140746078289927), 3080, 1024, 16, 1, 32, 0, 0, 0 }, { UINT64_C(11399736556787719), 7280, 1024, 8, 1, 32, 0, 0, 0 },
+		{ UINT64_C(11399736556787719), 7280, 1024, 8, 1, 32, 0, 0, 0 }, { UINT64_C(11399736556787719), 7280, 1024, 8, 1, 32, 0, 0, 0 },
+		{ UINT64_C(11399736556787719), 7280, 1024, 8, 1, 32, 0, 0, 0 }, { UINT64_C(11399736556787719), 7280, 1024, 8, 1, 32, 0, 0, 0 },
+		{ UINT64_C(11399736556787719), 7280, 1024, 8, 1, 32, 0, 0, 0 }, { UINT64_C(11399736556787719), 7280, 1024, 8, 1, 32, 0, 0, 0 },
+		{ UINT64_C(11399736556787719), 7280, 1024, 8, 1, 32, 0, 0, 0 }, { UINT64_C(11399736556787719), 7280, 1024, 8, 1, 32, 0, 0, 0 },
+		{ UINT64_C(11399736556787719), 7280, 1024, 8, 1, 32, 0, 0, 0 }, { UINT64_C(141295834104327), 3080, 1024, 16, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140746078290439), 3080, 1024, 16, 1, 32, 0, 0, 0 }, { UINT64_C(703696031711239), 3072, 1024, 20, 1, 32, 0, 0, 0 },
+		{ UINT64_C(703696031711239), 3072, 1024, 20, 1, 32, 0, 0, 0 }, { UINT64_C(703696031711239), 3072, 1024, 20, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140747152032263), 3080, 1024, 16, 1, 32, 0, 0, 0 }, { UINT64_C(140746078289927), 3080, 1024, 16, 1, 32, 0, 0, 0 },
+		{ UINT64_C(17092320570644487), 7269, 1024, 4, 34, 32, 1, 1, 0 }, { UINT64_C(17092320570644487), 7269, 1024, 4, 34, 32, 1, 1, 0 },
+		{ UINT64_C(17092320570644487), 7269, 1024, 4, 34, 32, 1, 1, 0 }, { UINT64_C(17092320570644487), 7269, 1024, 4, 34, 32, 1, 1, 0 },
+		{ UINT64_C(17092320570644487), 7269, 1024, 4, 34, 32, 1, 1, 0 }, { UINT64_C(17092320570644487), 7269, 1024, 4, 34, 32, 1, 1, 0 },
+		{ UINT64_C(17092320570638343), 7237, 1024, 4, 34, 32, 1, 1, 0 }, { UINT64_C(17092320570638343), 7237, 1024, 4, 34, 32, 1, 1, 0 },
+		{ UINT64_C(17092320570638343), 7237, 1024, 4, 34, 32, 1, 1, 0 }, { UINT64_C(17092320570638343), 7237, 1024, 4, 34, 32, 1, 1, 0 },
+		{ UINT64_C(17092320570638343), 7237, 1024, 4, 34, 32, 1, 1, 0 }, { UINT64_C(17092320570638343), 7237, 1024, 4, 34, 32, 1, 1, 0 },
+		{ UINT64_C(17092320570638343), 7237, 1024, 4, 34, 32, 1, 1, 0 }, { UINT64_C(17092320570638343), 7237, 1024, 4, 34, 32, 1, 1, 0 },
+		{ UINT64_C(17092320570638343), 7237, 1024, 4, 34, 32, 1, 1, 0 }, { UINT64_C(17092320570638343), 7237, 1024, 4, 34, 32, 1, 1, 0 },
+		{ UINT64_C(17092320570638343), 7237, 1024, 4, 34, 32, 1, 1, 0 }, { UINT64_C(17092320570638343), 7237, 1024, 4, 34, 32, 1, 1, 0 },
+		{ UINT64_C(17092320570638343), 7237, 1024, 4, 34, 32, 1, 1, 0 }, { UINT64_C(17092320570638343), 7237, 1024, 4, 34, 32, 1, 1, 0 },
+		{ UINT64_C(17092320570638343), 7237, 1024, 4, 34, 32, 1, 1, 0 }, { UINT64_C(17092320570638343), 7237, 1024, 4, 34, 32, 1, 1, 0 },
+		{ UINT64_C(17092320570638343), 7237, 1024, 4, 34, 32, 1, 1, 0 }, { UINT64_C(17092320570638343), 7237, 1024, 4, 34, 32, 1, 1, 0 },
+		{ UINT64_C(17092320570638343), 7237, 1024, 4, 34, 32, 1, 1, 0 }, { UINT64_C(17092320570638343), 7237, 1024, 4, 34, 32, 1, 1, 0 },
+		{ UINT64_C(140746078289927), 3080, 1024, 17, 1, 32, 0, 0, 0 }, { UINT64_C(140746078289927), 3080, 1024, 16, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140746078289927), 3080, 1024, 13, 1, 32, 0, 0, 0 }, { UINT64_C(704245787558919), 3072, 1024, 19, 1, 32, 0, 0, 0 },
+		{ UINT64_C(11399736556781575), 7176, 1024, 11, 1, 32, 0, 0, 0 }, { UINT64_C(141295834136583), 3072, 1024, 19, 1, 32, 0, 0, 0 },
+		{ UINT64_C(17088953316284423), 7267, 1024, 0, 34, 32, 0, 0, 2 }, { UINT64_C(17088953316284423), 7267, 1024, 0, 34, 32, 0, 0, 2 },
+		{ UINT64_C(17088953316284423), 7267, 1024, 0, 34, 32, 0, 0, 2 }, { UINT64_C(17088953316284423), 7267, 1024, 0, 34, 32, 0, 0, 2 },
+		{ UINT64_C(17088953316284423), 7267, 1024, 0, 34, 32, 0, 0, 2 }, { UINT64_C(17088953316284423), 7267, 1024, 0, 34, 32, 0, 0, 2 },
+		{ UINT64_C(17088953316278279), 7235, 1024, 0, 34, 32, 0, 0, 2 }, { UINT64_C(17088953316278279), 7235, 1024, 0, 34, 32, 0, 0, 2 },
+		{ UINT64_C(17088953383387143), 7235, 1024, 0, 34, 32, 0, 0, 2 }, { UINT64_C(17088953383387143), 7235, 1024, 0, 34, 32, 0, 0, 2 },
+		{ UINT64_C(17088953316278279), 7235, 1024, 0, 34, 32, 0, 0, 2 }, { UINT64_C(17088953316278279), 7235, 1024, 0, 34, 32, 0, 0, 2 },
+		{ UINT64_C(17088953316278279), 7235, 1024, 0, 34, 32, 0, 0, 2 }, { UINT64_C(17088953316278279), 7235, 1024, 0, 34, 32, 0, 0, 2 },
+		{ UINT64_C(17088953316278279), 7235, 1024, 0, 34, 32, 0, 0, 2 }, { UINT64_C(17088953316278279), 7235, 1024, 0, 34, 32, 0, 0, 2 },
+		{ UINT64_C(17088953316278279), 7235, 1024, 0, 34, 32, 0, 0, 2 }, { UINT64_C(17088953316278279), 7235, 1024, 0, 34, 32, 0, 0, 2 },
+		{ UINT64_C(17088953316278279), 7235, 1024, 0, 34, 32, 0, 0, 2 }, { UINT64_C(17088953316278279), 7235, 1024, 0, 34, 32, 0, 0, 2 },
+		{ UINT64_C(17088953316278279), 7235, 1024, 0, 34, 32, 0, 0, 2 }, { UINT64_C(17088953316278279), 7235, 1024, 0, 34, 32, 0, 0, 2 },
+		{ UINT64_C(17088953316278279), 7235, 1024, 0, 34, 32, 0, 0, 2 }, { UINT64_C(17088953316278279), 7235, 1024, 0, 34, 32, 0, 0, 2 },
+		{ UINT64_C(17088953316278279), 7235, 1024, 0, 34, 32, 0, 0, 2 }, { UINT64_C(17088953316278279), 7235, 1024, 0, 34, 32, 0, 0, 2 },
+		{ UINT64_C(140746078289927), 3080, 1024, 17, 1, 32, 0, 0, 0 }, { UINT64_C(703696031711239), 3072, 1024, 20, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140746078289927), 3080, 1024, 13, 1, 32, 0, 0, 0 }, { UINT64_C(703696031711239), 3072, 1024, 20, 1, 32, 0, 0, 0 },
+		{ UINT64_C(7), 512, 1024, 25, 1, 0, 0, 0, 0 }, { UINT64_C(5), 512, 1024, 25, 1, 0, 0, 0, 0 }, { UINT64_C(5), 512, 1024, 25, 1, 0, 0, 0, 0 },
+		{ UINT64_C(5), 512, 1024, 25, 1, 0, 0, 0, 0 }, { UINT64_C(5), 512, 1024, 25, 1, 0, 0, 0, 0 }, { UINT64_C(5), 512, 1024, 25, 1, 0, 0, 0, 0 },
+		{ UINT64_C(4294967325), 640, 1024, 25, 1, 0, 0, 0, 0 }, { UINT64_C(5), 512, 1024, 25, 1, 0, 0, 0, 0 }, { UINT64_C(5), 512, 1024, 25, 1, 0, 0, 0, 0 },
+		{ UINT64_C(5), 512, 1024, 25, 1, 0, 0, 0, 0 }, { UINT64_C(5), 512, 1024, 25, 1, 0, 0, 0, 0 }, { UINT64_C(5), 512, 1024, 25, 1, 0, 0, 0, 0 },
+		{ UINT64_C(5), 512, 1024, 25, 1, 0, 0, 0, 0 }, { UINT64_C(5), 512, 1024, 25, 1, 0, 0, 0, 0 }, { UINT64_C(5), 512, 1024, 25, 1, 0, 0, 0, 0 },
+		{ UINT64_C(5), 512, 1024, 25, 1, 0, 0, 0, 0 }, { UINT64_C(5), 512, 1024, 25, 1, 0, 0, 0, 0 }, { UINT64_C(5), 512, 1024, 25, 1, 0, 0, 0, 0 },
+		{ UINT64_C(5), 512, 1024, 25, 1, 0, 0, 0, 0 }, { UINT64_C(5), 512, 1024, 25, 1, 0, 0, 0, 0 }, { UINT64_C(5), 512, 1024, 25, 1, 0, 0, 0, 0 },
+		{ UINT64_C(5), 512, 1024, 25, 1, 0, 0, 0, 0 }, { UINT64_C(5), 512, 1024, 25, 1, 0, 0, 0, 0 }, { UINT64_C(5), 512, 1024, 25, 1, 0, 0, 0, 0 },
+		{ UINT64_C(5), 512, 1024, 25, 1, 0, 0, 0, 0 }, { UINT64_C(5), 512, 1024, 25, 1, 0, 0, 0, 0 }, { UINT64_C(5), 512, 1024, 25, 1, 0, 0, 0, 0 },
+		{ UINT64_C(5), 512, 1024, 25, 1, 0, 0, 0, 0 }, { UINT64_C(5), 512, 1024, 25, 1, 0, 0, 0, 0 }, { UINT64_C(5), 512, 1024, 25, 1, 0, 0, 0, 0 },
+		{ UINT64_C(5), 512, 1024, 25, 1, 0, 0, 0, 0 }, { UINT64_C(5), 512, 1024, 25, 1, 0, 0, 0, 0 }, { UINT64_C(5), 512, 1024, 25, 1, 0, 0, 0, 0 },
+		{ UINT64_C(140737488355349), 2432, 1024, 24, 1, 0, 0, 0, 0 }, { UINT64_C(140746078289925), 3080, 1024, 16, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140746078289925), 3072, 1024, 18, 1, 32, 0, 0, 0 }, { UINT64_C(140746078289925), 3072, 1024, 18, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140746078289925), 3072, 1024, 18, 1, 32, 0, 0, 0 }, { UINT64_C(140746078289925), 3072, 1024, 18, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140746078289925), 3072, 1024, 21, 1, 32, 0, 0, 0 }, { UINT64_C(140746078289925), 3080, 1024, 16, 1, 32, 0, 0, 0 },
+		{ UINT64_C(141287244201989), 3072, 1024, 19, 1, 32, 0, 0, 0 }, { UINT64_C(140746078289925), 3072, 1024, 21, 1, 32, 0, 0, 0 },
+		{ UINT64_C(17064764060598277), 7235, 1024, 2, 34, 32, 0, 0, 0 }, { UINT64_C(140746078290181), 3080, 1024, 15, 1, 32, 0, 0, 0 },
+		{ UINT64_C(703696031711237), 3072, 1024, 20, 1, 32, 0, 0, 0 }, { UINT64_C(70918499991557), 3072, 1024, 26, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140746078289925), 3072, 1024, 21, 1, 32, 0, 0, 0 }, { UINT64_C(141287244201989), 3072, 1024, 19, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140746078289925), 3072, 1024, 21, 1, 32, 0, 0, 0 }, { UINT64_C(703696031711237), 3072, 1024, 20, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 1024, 10, 1, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 1024, 10, 1, 32, 0, 0, 0 },
+		{ UINT64_C(141287244201989), 3072, 1024, 19, 1, 32, 0, 0, 0 }, { UINT64_C(17097749409300485), 7235, 1024, 0, 1, 32, 3, 0, 4 },
+		{ UINT64_C(140746078289925), 3080, 1024, 16, 1, 32, 0, 0, 0 }, { UINT64_C(11400286849564677), 3080, 1024, 16, 1, 32, 0, 0, 0 },
+		{ UINT64_C(141287244201989), 3072, 1024, 19, 1, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 1024, 10, 1, 32, 0, 0, 0 },
+		{ UINT64_C(17064764060598277), 7235, 1024, 2, 34, 32, 0, 0, 0 }, { UINT64_C(140746078290181), 3080, 1024, 14, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 1024, 10, 1, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 1024, 10, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 1024, 10, 1, 32, 0, 0, 0 }, { UINT64_C(140746078289925), 3080, 1024, 16, 1, 32, 0, 0, 0 },
+		{ UINT64_C(17092320570638341), 7237, 1024, 4, 34, 32, 1, 1, 0 }, { UINT64_C(17092320570638341), 7237, 1024, 4, 34, 32, 1, 1, 0 },
+		{ UINT64_C(17092320570638341), 7237, 1024, 4, 34, 32, 1, 1, 0 }, { UINT64_C(17092320570638341), 7237, 1024, 4, 34, 32, 1, 1, 0 },
+		{ UINT64_C(17092320570638341), 7237, 1024, 4, 34, 32, 1, 1, 0 }, { UINT64_C(17092320570638341), 7237, 1024, 4, 34, 32, 1, 1, 0 },
+		{ UINT64_C(17092320570638341), 7237, 1024, 4, 34, 32, 1, 1, 0 }, { UINT64_C(17092320570638341), 7237, 1024, 4, 34, 32, 1, 1, 0 },
+		{ UINT64_C(17092320570638341), 7237, 1024, 4, 34, 32, 1, 1, 0 }, { UINT64_C(17092320570638341), 7237, 1024, 4, 34, 32, 1, 1, 0 },
+		{ UINT64_C(17092320570638341), 7237, 1024, 4, 34, 32, 1, 1, 0 }, { UINT64_C(17092320570638341), 7237, 1024, 4, 34, 32, 1, 1, 0 },
+		{ UINT64_C(17092320570638341), 7237, 1024, 4, 34, 32, 1, 1, 0 }, { UINT64_C(17092320570638341), 7237, 1024, 4, 34, 32, 1, 1, 0 },
+		{ UINT64_C(17092320570638341), 7237, 1024, 4, 34, 32, 1, 1, 0 }, { UINT64_C(17092320570638341), 7237, 1024, 4, 34, 32, 1, 1, 0 },
+		{ UINT64_C(17092320570638341), 7237, 1024, 4, 34, 32, 1, 1, 0 }, { UINT64_C(17092320570638341), 7237, 1024, 4, 34, 32, 1, 1, 0 },
+		{ UINT64_C(17092320570638341), 7237, 1024, 4, 34, 32, 1, 1, 0 }, { UINT64_C(17092320570638341), 7237, 1024, 4, 34, 32, 1, 1, 0 },
+		{ UINT64_C(17092320570638341), 7237, 1024, 4, 34, 32, 1, 1, 0 }, { UINT64_C(17092320570638341), 7237, 1024, 4, 34, 32, 1, 1, 0 },
+		{ UINT64_C(17092320570638341), 7237, 1024, 4, 34, 32, 1, 1, 0 }, { UINT64_C(703696031711237), 3072, 1024, 20, 1, 32, 0, 0, 0 },
+		{ UINT64_C(17092320570638341), 7237, 1024, 4, 34, 32, 1, 1, 0 }, { UINT64_C(17092320570638341), 7237, 1024, 4, 34, 32, 1, 1, 0 },
+		{ UINT64_C(17092320570638341), 7237, 1024, 4, 34, 32, 1, 1, 0 }, { UINT64_C(17092320570638341), 7237, 1024, 4, 34, 32, 1, 1, 0 },
+		{ UINT64_C(17092320570638341), 7237, 1024, 4, 34, 32, 1, 1, 0 }, { UINT64_C(17092320570638341), 7237, 1024, 4, 34, 32, 1, 1, 0 },
+		{ UINT64_C(17092320570638341), 7237, 1024, 4, 34, 32, 1, 1, 0 }, { UINT64_C(17097749409300485), 7235, 1024, 0, 34, 32, 0, 0, 5 },
+		{ UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 2 }, { UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 2 },
+		{ UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 2 }, { UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 2 },
+		{ UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 2 }, { UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 2 },
+		{ UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 2 }, { UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 2 },
+		{ UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 2 }, { UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 2 },
+		{ UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 2 }, { UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 2 },
+		{ UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 2 }, { UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 2 },
+		{ UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 2 }, { UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 2 },
+		{ UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 2 }, { UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 2 },
+		{ UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 2 }, { UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 2 },
+		{ UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 2 }, { UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 2 },
+		{ UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 2 }, { UINT64_C(703696031711237), 3072, 1024, 20, 1, 32, 0, 0, 0 },
+		{ UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 2 }, { UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 2 },
+		{ UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 2 }, { UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 2 },
+		{ UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 2 }, { UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 2 },
+		{ UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 2 }, { UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 6 }
+	} };
 
-	static constexpr std::array<std::uint_least8_t, 231> rleclindices =
-	{
-		209, 0, 193, 1, 212, 0, 1, 194, 0, 7, 197, 0, 9, 193, 0, 13, 14, 15, 16, 17, 18, 19, 0, 21, 22, 0, 24, 0, 26, 27, 28, 29, 193,
-		0, 31, 7, 193, 0, 34, 35, 7, 0, 36, 193, 0, 37, 7, 0, 38, 39, 193, 0, 41, 42, 43, 7, 238, 0, 7, 197, 0, 73, 75, 0, 76, 77,
-		78, 0, 1, 197, 0, 84, 198, 0, 7, 0, 7, 0, 7, 196, 0, 99, 193, 0, 7, 0, 101, 0, 36, 193, 102, 1, 195, 0, 7, 197, 0, 7, 0, 7,
-		0, 103, 255, 6, 0, 7, 193, 0, 104, 240, 0, 255, 4, 254, 0, 105, 0, 105, 214, 0, 106, 193, 84, 254, 0, 254, 0, 127, 7, 193,
-		0, 93, 198, 0, 93, 134, 135, 0, 94, 138, 139, 101, 140, 141, 254, 0, 142, 0, 143, 144, 0, 145, 206, 0, 147, 218, 0, 149, 215,
-		0, 104, 193, 0, 151, 152, 153, 193, 0, 156, 157, 158, 159, 194, 0, 160, 7, 194, 0, 7, 193, 0, 7, 254, 0, 162, 0, 163, 193,
-		0, 7, 0, 7, 193, 0, 7, 0, 164, 165, 166, 167, 164, 168, 169, 170, 171, 7, 254, 0, 254, 0, 1, 231, 0, 193, 174, 197, 0, 174,
-		253, 0, 77, 254, 0, 254, 0, 1, 254, 0, 176, 225, 0
-	};
+	return &latin1records[r];
+}
 
-	static constexpr std::array<std::uint_least8_t, 248> rlecuindices =
+inline record::raw_record const* record::table_record(char32_t r) noexcept
+{
+	static constexpr std::array<std::uint_least16_t, 8704> stage1 =
 	{
-		214, 0, 194, 2, 203, 0, 4, 194, 0, 5, 2, 6, 0, 193, 8, 196, 0, 11, 12, 198, 0, 20, 193, 0, 23, 0, 25, 196, 0, 30, 0, 8, 32,
-		33, 194, 0, 8, 196, 0, 8, 193, 0, 40, 8, 195, 0, 8, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61,
-		62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 202, 0, 74, 197, 0, 8, 194, 0, 25, 200, 0, 79, 80, 2, 81, 82, 83, 0, 86, 88, 193,
-		0, 90, 92, 93, 255, 3, 0, 8, 94, 96, 97, 98, 0, 100, 193, 0, 8, 197, 0, 2, 194, 96, 0, 8, 197, 0, 8, 0, 8, 0, 89, 255, 6, 0,
-		8, 195, 0, 95, 254, 0, 204, 0, 255, 4, 254, 0, 93, 254, 0, 254, 0, 108, 110, 112, 114, 116, 118, 120, 122, 209, 0, 123, 124,
-		202, 0, 126, 194, 0, 8, 84, 0, 128, 129, 130, 131, 132, 133, 0, 93, 0, 135, 137, 254, 0, 146, 194, 0, 148, 218, 0, 150, 216,
-		0, 95, 194, 0, 154, 155, 200, 0, 8, 194, 0, 8, 193, 0, 8, 194, 0, 193, 161, 254, 0, 8, 0, 8, 193, 0, 8, 201, 0, 8, 254, 0,
-		172, 195, 0, 173, 242, 0, 2, 231, 0, 193, 175, 197, 0, 175, 252, 0, 82, 254, 0, 254, 0, 2, 254, 0, 177, 224, 0
+		0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
+		33, 34, 35, 36, 37, 38, 39, 40, 41, 41, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61,
+		62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 78, 79, 80, 79, 79, 81, 82, 83, 84, 85, 86, 87, 88, 89,
+		90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+		99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 100,
+		101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+		101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+		101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+		101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+		101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+		101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+		101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 102, 103, 104, 104, 104, 104, 104, 104, 104, 104, 105, 106,
+		106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+		119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+		119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+		119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+		120, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+		122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 123, 123, 124, 125, 126, 127, 128, 129,
+		130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 140, 147, 147, 148, 140, 149, 150, 151,
+		152, 153, 154, 155, 156, 157, 158, 140, 140, 159, 140, 140, 140, 160, 161, 162, 163, 164, 165, 166, 140, 167, 168, 140, 169,
+		170, 171, 172, 140, 140, 173, 140, 140, 174, 175, 140, 140, 176, 177, 178, 140, 140, 140, 140, 140, 179, 179, 179, 179, 179,
+		179, 180, 181, 182, 183, 184, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 185, 185, 185, 185, 185, 185, 185, 185, 186, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 187, 187, 187, 187, 188, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 189, 189, 189, 189, 190, 191, 192, 193, 140, 140, 140,
+		140, 140, 140, 194, 195, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		196, 196, 197, 196, 196, 196, 196, 196, 198, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 199, 200, 201, 202, 202, 203, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 204, 205, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 206, 207, 208,
+		209, 210, 140, 211, 140, 212, 213, 214, 215, 216, 217, 218, 219, 220, 220, 220, 220, 221, 222, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 223, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 224, 225, 226, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 227, 228, 140, 140, 229, 230, 231, 232, 233, 140, 234, 235, 236, 237, 238, 239, 240, 241,
+		242, 243, 244, 245, 246, 247, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 248, 249, 249, 249, 249, 249, 249, 249,
+		249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249,
+		249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249,
+		249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249,
+		249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249,
+		249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249,
+		249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249,
+		249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249,
+		249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249,
+		249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249,
+		249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249,
+		249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249,
+		249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249,
+		249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249,
+		249, 250, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251,
+		251, 251, 251, 251, 251, 251, 251, 251, 251, 252, 253, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 256, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257,
+		257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257,
+		257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 258, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 259, 259, 259, 259, 260, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 248, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 248, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 248, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 248, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 248, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 248, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 248, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 248, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		248, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 248, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 248,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 248, 261, 262, 263, 264, 262, 262, 262, 262, 262, 262, 262, 262, 262,
+		262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+		140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 248, 265,
+		265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265,
+		265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265,
+		265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265,
+		265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265,
+		265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265,
+		265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265,
+		265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265,
+		265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265,
+		265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265,
+		265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265,
+		265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265,
+		265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265,
+		265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265,
+		265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265,
+		265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265,
+		265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265,
+		265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265,
+		265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265,
+		265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265,
+		265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265,
+		265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 266, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265,
+		265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265,
+		265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265,
+		265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265,
+		265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265,
+		265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265,
+		265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265,
+		265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265,
+		265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265,
+		265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265,
+		265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265,
+		265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265,
+		265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265,
+		265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265,
+		265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265,
+		265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265,
+		265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265,
+		265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265,
+		265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265,
+		265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265,
+		265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 266
 	};
 
-	static constexpr std::array<std::uint_least64_t, 138> pflags =
+	static constexpr std::array<std::uint_least16_t, 34176> stage2 =
 	{
-		UINT64_C(7), UINT64_C(4294967319), UINT64_C(4294967327), UINT64_C(140741783322647), UINT64_C(140747152032263), UINT64_C(140746078290183),
-		UINT64_C(140746078289927), UINT64_C(141295834104071), UINT64_C(703696031711239), UINT64_C(140746078290439), UINT64_C(140746078290055),
-		UINT64_C(141296907846151), UINT64_C(11399736556787719), UINT64_C(141295834104327), UINT64_C(17092320570644487), UINT64_C(17092320570638343),
-		UINT64_C(704245787558919), UINT64_C(11399736556781575), UINT64_C(141295834136583), UINT64_C(17088953316284423), UINT64_C(17088953316278279),
-		UINT64_C(17088953383387143), UINT64_C(5), UINT64_C(4294967325), UINT64_C(140737488355349), UINT64_C(140746078289925), UINT64_C(141287244201989),
-		UINT64_C(17064764060598277), UINT64_C(140746078290181), UINT64_C(703696031711237), UINT64_C(70918499991557), UINT64_C(140737488355333),
-		UINT64_C(17097749409300485), UINT64_C(11400286849564677), UINT64_C(17092320570638341), UINT64_C(17088953316278277), UINT64_C(17088953383387141),
-		UINT64_C(17064764060467205), UINT64_C(17064420463083525), UINT64_C(17096718617149445), UINT64_C(17094382154940421), UINT64_C(17065313816444933),
-		UINT64_C(17065313883553797), UINT64_C(17064970218930181), UINT64_C(17064970218995717), UINT64_C(11541023800983557), UINT64_C(11609537119428613),
-		UINT64_C(11611392578682885), UINT64_C(11541023800950789), UINT64_C(1), UINT64_C(3554514934333445), UINT64_C(140737488355845),
-		UINT64_C(11400286849466885), UINT64_C(17660699362722821), UINT64_C(17627782733366277), UINT64_C(17064832779943941), UINT64_C(17655270524060677),
-		UINT64_C(703687441776645), UINT64_C(282024732524549), UINT64_C(140738562097669), UINT64_C(140737488355461), UINT64_C(11576208173080581),
-		UINT64_C(11576208173047813), UINT64_C(141287244169221), UINT64_C(566935683077), UINT64_C(70918499991589), UINT64_C(17064970218962949),
-		UINT64_C(11399736556781573), UINT64_C(17064970218897413), UINT64_C(11434920928878597), UINT64_C(11575658418282501), UINT64_C(12560820835713029),
-		UINT64_C(17064420597301253), UINT64_C(11399736556814341), UINT64_C(17134789240815621), UINT64_C(11399737093652485), UINT64_C(17083524477616133),
-		UINT64_C(140737488420869), UINT64_C(11611394692612101), UINT64_C(17205707975696389), UINT64_C(11541023801049093), UINT64_C(140737488388101),
-		UINT64_C(17065313816412165), UINT64_C(17064764127576069), UINT64_C(17065313883521029), UINT64_C(352393477750853), UINT64_C(70918499991621),
-		UINT64_C(70922794958885), UINT64_C(140746078290053), UINT64_C(703696031712261), UINT64_C(141295834104069), UINT64_C(141295834103813),
-		UINT64_C(140747152032261), UINT64_C(11962686510203909), UINT64_C(633868453413893), UINT64_C(70368777732097), UINT64_C(703687441776773),
-		UINT64_C(703687441777669), UINT64_C(12103973754373125), UINT64_C(17627714013889541), UINT64_C(17592186312851461), UINT64_C(17029236359430149),
-		UINT64_C(17627370416505861), UINT64_C(17627714080998405), UINT64_C(17092320570900485), UINT64_C(17088953316409349), UINT64_C(703696031711365),
-		UINT64_C(8589934593), UINT64_C(203821968269317), UINT64_C(200454713778181), UINT64_C(176480206225413), UINT64_C(140746078290437),
-		UINT64_C(140737496743941), UINT64_C(140737490452485), UINT64_C(17064420463099909), UINT64_C(11540474046218245), UINT64_C(3518987233165317),
-		UINT64_C(17064420479877125), UINT64_C(17064420463116293), UINT64_C(3553621580972037), UINT64_C(524289), UINT64_C(140737488355589),
-		UINT64_C(141288317911557), UINT64_C(141287244169733), UINT64_C(703687441777797), UINT64_C(141287244169477), UINT64_C(11399736556783621),
-		UINT64_C(17092320570640389), UINT64_C(704237197624325), UINT64_C(17088953316280325), UINT64_C(12702108080963589), UINT64_C(549755813893),
-		UINT64_C(17064420463149061), UINT64_C(11541023801016325), UINT64_C(11540474046185477), UINT64_C(176334177574917), UINT64_C(140771848093701),
-		UINT64_C(352393477750789)
+		0, 1, 1, 1, 1, 1, 1, 1, 1, 2, 3, 3, 3, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 4, 5, 6, 7, 8, 7, 7, 9, 10,
+		11, 7, 12, 13, 14, 15, 7, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 13, 12, 12, 12, 5, 7, 18, 18, 18, 18, 18, 18, 19, 19,
+		19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 10, 7, 11, 20, 21, 22, 23, 23, 23, 23, 23, 23, 24,
+		24, 25, 25, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 10, 12, 11, 12, 1, 26, 26, 26, 26, 26, 27, 26,
+		26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 28, 29, 30, 30, 30, 30,
+		31, 29, 32, 31, 33, 34, 35, 36, 31, 32, 31, 35, 37, 37, 32, 38, 29, 39, 32, 37, 33, 40, 37, 37, 37, 29, 41, 41, 41, 41, 41,
+		41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 35, 41, 41, 41, 41, 41, 41, 41, 42, 43, 43, 43, 43,
+		43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 35, 43, 43, 43, 43, 43, 43, 43, 44, 45, 46, 45,
+		46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46,
+		45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 47, 48, 49, 45, 46, 45, 46, 45, 46, 50, 45, 46, 45, 46, 45, 46, 45, 46,
+		45, 46, 45, 46, 45, 46, 45, 46, 51, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46,
+		45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 52, 45, 46, 45, 46, 45, 46,
+		53, 54, 55, 45, 46, 45, 46, 56, 45, 46, 57, 57, 45, 46, 50, 58, 59, 60, 45, 46, 57, 61, 62, 63, 64, 45, 46, 65, 50, 63, 66,
+		67, 68, 45, 46, 45, 46, 45, 46, 69, 45, 46, 69, 50, 50, 45, 46, 69, 45, 46, 70, 70, 45, 46, 45, 46, 71, 45, 46, 50, 72, 45,
+		46, 50, 73, 72, 72, 72, 72, 74, 75, 76, 74, 75, 76, 74, 75, 76, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45,
+		46, 77, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 49, 74, 75, 76, 45, 46, 78, 79, 80, 81, 45,
+		46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 80, 81,
+		80, 81, 80, 81, 80, 81, 82, 83, 80, 81, 80, 81, 80, 81, 80, 81, 80, 81, 80, 81, 80, 81, 80, 81, 80, 81, 83, 83, 83, 84, 84,
+		84, 85, 86, 87, 88, 89, 90, 90, 86, 91, 92, 93, 94, 95, 91, 95, 96, 95, 91, 95, 91, 95, 91, 97, 98, 99, 100, 101, 50, 102,
+		102, 50, 103, 50, 104, 105, 50, 50, 50, 102, 106, 50, 107, 50, 108, 109, 50, 110, 111, 109, 112, 113, 50, 50, 111, 50, 114,
+		115, 50, 50, 116, 50, 50, 50, 50, 50, 50, 50, 117, 50, 50, 118, 50, 50, 118, 50, 50, 50, 119, 118, 120, 121, 121, 122, 50,
+		50, 50, 50, 50, 123, 50, 72, 50, 50, 50, 50, 50, 50, 50, 50, 124, 125, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 126, 126,
+		126, 126, 126, 83, 83, 127, 127, 128, 127, 127, 127, 127, 127, 127, 129, 129, 129, 129, 129, 129, 129, 130, 130, 32, 32,
+		32, 32, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 131, 131, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 132,
+		127, 127, 127, 127, 127, 32, 32, 32, 32, 32, 133, 133, 134, 132, 134, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135,
+		135, 135, 135, 135, 135, 135, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136,
+		136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136,
+		136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136,
+		137, 138, 138, 138, 138, 138, 138, 138, 138, 138, 139, 140, 140, 140, 140, 140, 140, 140, 140, 141, 141, 141, 141, 141, 140,
+		140, 140, 136, 136, 138, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 143, 144, 143, 144, 129, 145, 143,
+		144, 146, 146, 147, 148, 148, 148, 149, 150, 146, 146, 146, 146, 145, 32, 151, 152, 153, 153, 153, 146, 154, 146, 155, 155,
+		156, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 146, 157, 157, 157, 157, 157, 157,
+		157, 157, 157, 158, 159, 159, 159, 156, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160,
+		161, 160, 160, 160, 160, 160, 160, 160, 160, 160, 162, 163, 163, 164, 165, 166, 167, 168, 168, 169, 170, 171, 172, 173, 174,
+		175, 174, 175, 174, 175, 174, 175, 176, 177, 176, 177, 176, 177, 176, 177, 176, 177, 176, 177, 176, 177, 178, 179, 180, 181,
+		182, 183, 184, 185, 186, 187, 185, 186, 188, 189, 189, 189, 190, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191,
+		190, 191, 191, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192,
+		192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193,
+		193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 194, 195, 195, 195, 195, 195, 196, 195,
+		196, 195, 195, 195, 195, 194, 195, 195, 197, 198, 197, 198, 197, 198, 197, 198, 197, 198, 197, 198, 197, 198, 197, 198, 197,
+		198, 197, 198, 197, 198, 197, 198, 197, 198, 197, 198, 197, 198, 197, 198, 197, 198, 199, 200, 200, 201, 201, 202, 203, 203,
+		204, 205, 206, 207, 206, 207, 197, 198, 197, 198, 197, 198, 197, 198, 197, 198, 197, 198, 197, 198, 197, 198, 197, 198, 197,
+		198, 197, 198, 197, 198, 197, 198, 197, 198, 197, 198, 197, 198, 197, 198, 197, 198, 197, 198, 197, 198, 197, 198, 197, 198,
+		197, 198, 197, 198, 208, 197, 198, 197, 198, 204, 205, 197, 198, 204, 205, 197, 198, 204, 205, 209, 197, 198, 197, 198, 197,
+		198, 197, 198, 197, 198, 197, 198, 197, 198, 197, 198, 197, 198, 197, 198, 197, 198, 197, 198, 197, 198, 197, 198, 206, 207,
+		197, 198, 197, 198, 197, 198, 197, 198, 210, 211, 197, 198, 212, 213, 212, 213, 212, 213, 204, 205, 204, 205, 204, 205, 204,
+		205, 204, 205, 204, 205, 204, 205, 204, 205, 212, 213, 212, 213, 214, 215, 214, 215, 214, 215, 214, 215, 214, 215, 214, 215,
+		214, 215, 214, 215, 216, 217, 218, 219, 220, 221, 220, 221, 220, 221, 220, 221, 222, 223, 223, 223, 223, 223, 223, 223, 223,
+		223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223,
+		223, 223, 223, 223, 223, 222, 222, 224, 225, 225, 225, 225, 225, 225, 222, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226,
+		226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226,
+		226, 226, 226, 227, 222, 228, 229, 222, 222, 230, 230, 231, 232, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233,
+		233, 233, 233, 233, 233, 234, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 235, 235, 235, 235, 235, 235,
+		235, 235, 235, 235, 236, 235, 235, 235, 237, 235, 238, 235, 235, 239, 240, 241, 242, 241, 232, 232, 232, 232, 232, 232, 232,
+		232, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243,
+		243, 243, 243, 232, 232, 232, 232, 232, 243, 243, 243, 238, 244, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 245,
+		245, 245, 245, 246, 247, 248, 248, 248, 249, 249, 250, 251, 252, 253, 253, 254, 254, 254, 254, 254, 254, 255, 255, 255, 255,
+		255, 251, 256, 257, 258, 259, 260, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+		261, 261, 261, 261, 261, 261, 261, 261, 262, 262, 262, 262, 262, 263, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 264,
+		264, 264, 264, 264, 264, 264, 264, 265, 265, 265, 254, 266, 267, 268, 268, 268, 268, 268, 268, 269, 270, 270, 270, 270, 270,
+		270, 270, 270, 270, 270, 271, 271, 271, 271, 272, 272, 273, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+		261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+		261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+		261, 261, 261, 261, 261, 261, 261, 261, 274, 274, 261, 261, 261, 261, 261, 274, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+		261, 261, 261, 261, 261, 261, 274, 261, 261, 261, 261, 275, 261, 276, 276, 276, 276, 276, 276, 276, 277, 278, 279, 279, 276,
+		276, 276, 276, 280, 280, 276, 276, 278, 279, 279, 279, 276, 281, 281, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 274,
+		274, 274, 282, 282, 281, 283, 283, 283, 284, 284, 284, 284, 284, 284, 284, 284, 285, 284, 285, 286, 287, 288, 289, 288, 288,
+		288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+		290, 290, 290, 291, 291, 291, 291, 291, 291, 291, 291, 291, 291, 291, 291, 291, 291, 291, 291, 292, 292, 292, 292, 292, 292,
+		292, 292, 292, 292, 292, 286, 286, 290, 290, 290, 293, 293, 293, 293, 293, 293, 293, 293, 293, 293, 293, 293, 293, 293, 293,
+		293, 293, 293, 293, 293, 293, 293, 293, 293, 293, 293, 293, 293, 293, 293, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262,
+		262, 262, 262, 262, 262, 262, 262, 262, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294,
+		294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 295, 295, 295, 295,
+		295, 295, 295, 295, 295, 295, 295, 296, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 298, 298, 298,
+		298, 298, 298, 298, 298, 298, 298, 299, 299, 299, 299, 299, 299, 299, 299, 299, 299, 299, 299, 299, 299, 299, 299, 299, 299,
+		299, 299, 299, 299, 299, 299, 299, 299, 299, 299, 299, 299, 299, 299, 299, 300, 300, 300, 300, 300, 300, 300, 300, 300, 301,
+		301, 302, 303, 304, 305, 306, 307, 307, 307, 307, 307, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+		308, 308, 308, 308, 308, 308, 308, 308, 309, 309, 310, 310, 311, 309, 309, 309, 309, 309, 309, 309, 309, 309, 311, 309, 309,
+		309, 311, 309, 309, 309, 309, 312, 313, 313, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314, 313,
+		315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315, 315,
+		316, 316, 316, 317, 317, 318, 317, 319, 319, 319, 319, 319, 319, 319, 319, 319, 319, 319, 286, 286, 286, 286, 286, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 320, 321, 320, 320,
+		320, 320, 320, 320, 320, 320, 320, 320, 320, 321, 321, 321, 321, 321, 321, 322, 322, 257, 323, 323, 323, 323, 323, 323, 323,
+		323, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 324, 324,
+		324, 324, 324, 324, 324, 324, 324, 324, 324, 324, 325, 325, 326, 327, 328, 328, 328, 328, 328, 328, 329, 329, 329, 329, 329,
+		329, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 330, 331, 332, 332, 333, 334, 335, 335, 335,
+		335, 335, 335, 335, 335, 335, 335, 335, 335, 335, 335, 335, 335, 335, 335, 335, 335, 335, 335, 335, 335, 335, 335, 335, 335,
+		335, 335, 335, 335, 335, 335, 335, 335, 335, 335, 335, 335, 335, 335, 335, 335, 335, 335, 335, 335, 335, 335, 335, 335, 335,
+		336, 337, 338, 335, 333, 333, 333, 332, 332, 332, 332, 332, 332, 332, 332, 333, 333, 333, 333, 338, 339, 337, 335, 340, 340,
+		338, 338, 331, 336, 336, 335, 335, 335, 335, 335, 335, 335, 335, 335, 335, 332, 332, 341, 341, 342, 342, 342, 342, 342, 342,
+		342, 342, 342, 342, 343, 344, 345, 346, 346, 346, 346, 346, 347, 348, 348, 349, 349, 350, 349, 349, 351, 352, 353, 353, 354,
+		355, 355, 355, 355, 355, 355, 355, 355, 354, 354, 355, 355, 354, 354, 355, 355, 355, 355, 355, 355, 355, 355, 355, 355, 355,
+		355, 355, 355, 355, 355, 355, 355, 355, 355, 355, 355, 354, 355, 355, 355, 355, 355, 355, 355, 354, 355, 354, 354, 354, 355,
+		355, 355, 355, 354, 354, 356, 357, 358, 353, 353, 352, 352, 352, 352, 354, 354, 353, 353, 354, 354, 353, 353, 356, 359, 354,
+		354, 354, 354, 354, 354, 354, 354, 358, 354, 354, 354, 354, 355, 355, 354, 355, 355, 355, 352, 352, 354, 354, 360, 360, 360,
+		360, 360, 360, 360, 360, 360, 360, 355, 355, 361, 361, 362, 362, 362, 362, 362, 362, 363, 364, 365, 366, 354, 354, 367, 368,
+		369, 370, 367, 371, 371, 371, 371, 371, 371, 367, 367, 367, 367, 371, 371, 367, 367, 371, 371, 371, 371, 371, 371, 371, 371,
+		371, 371, 371, 371, 371, 371, 371, 371, 371, 371, 371, 371, 371, 371, 367, 371, 371, 371, 371, 371, 371, 371, 367, 371, 371,
+		367, 371, 371, 367, 371, 371, 367, 367, 372, 367, 373, 373, 373, 369, 369, 367, 367, 367, 367, 369, 369, 367, 367, 369, 369,
+		372, 367, 367, 367, 374, 367, 367, 367, 367, 367, 367, 367, 371, 371, 371, 371, 367, 371, 367, 367, 367, 367, 367, 367, 367,
+		375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 369, 369, 371, 371, 371, 374, 367, 367, 367, 367, 367, 367, 367, 367, 367,
+		367, 376, 377, 377, 378, 376, 379, 379, 379, 379, 379, 379, 379, 380, 379, 376, 379, 379, 379, 376, 379, 379, 379, 379, 379,
+		379, 379, 379, 379, 379, 379, 379, 379, 379, 379, 379, 379, 379, 379, 379, 379, 379, 376, 379, 379, 379, 379, 379, 379, 379,
+		376, 379, 379, 376, 379, 379, 379, 379, 379, 376, 376, 381, 379, 378, 378, 378, 377, 377, 377, 377, 377, 376, 377, 377, 378,
+		376, 378, 378, 381, 376, 376, 379, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 379, 380, 382,
+		382, 376, 376, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 384, 385, 376, 376, 376, 376, 376, 376, 376, 386, 387, 387,
+		387, 388, 388, 388, 389, 390, 391, 391, 389, 392, 392, 392, 392, 392, 392, 392, 392, 389, 389, 392, 392, 389, 389, 392, 392,
+		392, 392, 392, 392, 392, 392, 392, 392, 392, 392, 392, 392, 392, 392, 392, 392, 392, 392, 392, 392, 389, 392, 392, 392, 392,
+		392, 392, 392, 389, 392, 392, 389, 393, 392, 392, 392, 392, 389, 389, 394, 392, 395, 390, 391, 390, 390, 390, 396, 389, 389,
+		391, 391, 389, 389, 391, 391, 394, 389, 389, 389, 389, 389, 389, 389, 389, 390, 395, 389, 389, 389, 389, 392, 392, 389, 392,
+		392, 392, 396, 396, 389, 389, 397, 397, 397, 397, 397, 397, 397, 397, 397, 397, 398, 393, 399, 399, 399, 399, 399, 399, 389,
+		389, 389, 389, 389, 389, 389, 389, 400, 400, 401, 402, 400, 402, 402, 402, 402, 402, 402, 400, 400, 400, 402, 402, 402, 400,
+		402, 402, 402, 402, 400, 400, 400, 402, 402, 400, 402, 400, 402, 402, 400, 400, 400, 402, 402, 400, 400, 400, 402, 402, 402,
+		400, 400, 400, 402, 402, 402, 402, 402, 402, 402, 402, 403, 402, 402, 402, 400, 400, 400, 400, 404, 405, 401, 405, 405, 400,
+		400, 400, 405, 405, 405, 400, 405, 405, 405, 406, 400, 400, 407, 400, 400, 400, 400, 400, 400, 404, 400, 400, 400, 400, 400,
+		400, 400, 400, 400, 400, 400, 400, 400, 400, 408, 409, 409, 409, 409, 409, 409, 409, 409, 409, 410, 410, 410, 411, 411, 411,
+		411, 411, 411, 412, 411, 400, 400, 400, 400, 400, 413, 414, 414, 414, 415, 416, 416, 416, 416, 416, 416, 416, 416, 415, 416,
+		416, 416, 415, 416, 416, 416, 416, 416, 416, 416, 416, 416, 416, 416, 416, 416, 416, 416, 416, 416, 416, 416, 416, 416, 416,
+		416, 415, 416, 416, 416, 416, 416, 416, 416, 416, 416, 416, 417, 416, 416, 416, 416, 416, 415, 415, 415, 418, 419, 419, 419,
+		414, 414, 414, 414, 415, 419, 419, 419, 415, 419, 419, 419, 420, 415, 415, 415, 415, 415, 415, 415, 419, 419, 415, 418, 418,
+		421, 415, 415, 415, 415, 415, 416, 416, 422, 422, 415, 415, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 415, 415, 415,
+		415, 415, 415, 415, 415, 424, 424, 424, 424, 424, 424, 424, 425, 426, 427, 428, 428, 429, 430, 430, 430, 430, 430, 430, 430,
+		430, 429, 430, 430, 430, 429, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430,
+		430, 430, 430, 430, 429, 430, 430, 430, 430, 430, 430, 430, 430, 430, 430, 429, 430, 430, 430, 430, 430, 429, 429, 431, 432,
+		428, 433, 428, 428, 434, 428, 428, 429, 433, 428, 428, 429, 428, 428, 433, 435, 429, 429, 429, 429, 429, 429, 429, 434, 434,
+		429, 429, 429, 429, 429, 429, 429, 430, 429, 430, 430, 436, 436, 429, 429, 437, 437, 437, 437, 437, 437, 437, 437, 437, 437,
+		429, 438, 438, 429, 429, 429, 429, 429, 429, 429, 429, 429, 429, 429, 429, 429, 439, 440, 441, 441, 442, 443, 443, 443, 443,
+		443, 443, 443, 443, 442, 443, 443, 443, 442, 443, 443, 443, 443, 443, 443, 443, 443, 443, 443, 443, 443, 443, 443, 443, 443,
+		443, 443, 443, 443, 443, 443, 443, 444, 443, 443, 443, 443, 443, 443, 443, 443, 443, 443, 443, 443, 443, 443, 443, 443, 444,
+		445, 445, 446, 447, 441, 441, 448, 448, 448, 449, 442, 441, 441, 441, 442, 441, 441, 441, 450, 444, 451, 442, 442, 442, 442,
+		452, 452, 452, 447, 453, 453, 453, 453, 453, 453, 453, 454, 443, 443, 449, 449, 442, 442, 455, 455, 455, 455, 455, 455, 455,
+		455, 455, 455, 456, 456, 456, 456, 456, 456, 453, 453, 453, 457, 446, 446, 446, 446, 446, 446, 458, 458, 459, 459, 458, 460,
+		460, 460, 460, 460, 460, 460, 460, 460, 460, 460, 460, 460, 460, 460, 460, 460, 460, 458, 458, 458, 460, 460, 460, 460, 460,
+		460, 460, 460, 460, 460, 460, 460, 460, 460, 460, 460, 460, 460, 460, 460, 460, 460, 460, 460, 458, 460, 460, 460, 460, 460,
+		460, 460, 460, 460, 458, 460, 458, 458, 460, 460, 460, 460, 460, 460, 460, 458, 458, 458, 461, 458, 458, 458, 458, 462, 459,
+		459, 463, 463, 463, 458, 463, 458, 459, 459, 459, 459, 459, 459, 459, 462, 458, 458, 458, 458, 458, 458, 464, 464, 464, 464,
+		464, 464, 464, 464, 464, 464, 458, 458, 459, 459, 465, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 466, 467, 467,
+		467, 467, 467, 467, 467, 467, 467, 467, 467, 467, 467, 467, 467, 467, 467, 467, 467, 467, 467, 467, 467, 467, 467, 467, 467,
+		467, 467, 467, 467, 467, 467, 467, 467, 467, 467, 467, 467, 467, 467, 467, 467, 467, 467, 467, 467, 467, 468, 467, 469, 468,
+		468, 468, 468, 468, 468, 468, 466, 466, 466, 466, 470, 471, 471, 471, 471, 471, 467, 472, 473, 473, 473, 473, 473, 473, 468,
+		473, 474, 475, 475, 475, 475, 475, 475, 475, 475, 475, 475, 476, 476, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466,
+		466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466,
+		477, 478, 478, 477, 478, 477, 477, 478, 478, 477, 478, 477, 477, 478, 477, 477, 477, 477, 477, 477, 478, 478, 478, 478, 477,
+		478, 478, 478, 478, 478, 478, 478, 477, 478, 478, 478, 477, 478, 477, 478, 477, 477, 478, 478, 477, 478, 478, 478, 478, 479,
+		478, 480, 479, 479, 479, 479, 479, 479, 477, 479, 479, 478, 477, 477, 481, 481, 481, 481, 481, 477, 482, 477, 483, 483, 483,
+		483, 483, 479, 477, 477, 484, 484, 484, 484, 484, 484, 484, 484, 484, 484, 477, 477, 478, 478, 485, 485, 477, 477, 477, 477,
+		477, 477, 477, 477, 477, 477, 477, 477, 477, 477, 477, 477, 477, 477, 477, 477, 477, 477, 477, 477, 477, 477, 477, 477, 477,
+		477, 477, 477, 486, 487, 487, 487, 488, 488, 488, 488, 489, 488, 488, 488, 488, 489, 489, 489, 489, 489, 489, 487, 488, 487,
+		487, 487, 490, 490, 487, 487, 487, 487, 487, 487, 491, 491, 491, 491, 491, 491, 491, 491, 491, 491, 492, 492, 492, 492, 492,
+		492, 492, 492, 492, 492, 487, 490, 487, 490, 487, 490, 493, 494, 493, 494, 495, 495, 486, 486, 486, 486, 486, 486, 486, 486,
+		496, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486,
+		486, 486, 486, 486, 486, 486, 486, 486, 486, 497, 498, 498, 496, 496, 496, 496, 499, 499, 499, 499, 499, 499, 499, 499, 499,
+		499, 499, 499, 499, 499, 500, 499, 499, 490, 490, 490, 488, 490, 490, 486, 486, 486, 486, 501, 502, 502, 502, 499, 499, 499,
+		499, 499, 499, 503, 499, 496, 499, 499, 499, 499, 499, 499, 499, 499, 499, 499, 499, 499, 499, 499, 499, 499, 499, 499, 499,
+		499, 499, 503, 503, 503, 499, 499, 499, 499, 499, 499, 499, 503, 499, 503, 503, 503, 496, 504, 504, 504, 504, 504, 504, 504,
+		504, 505, 504, 504, 504, 504, 504, 504, 496, 506, 504, 507, 507, 508, 508, 508, 509, 509, 509, 509, 510, 510, 496, 496, 496,
+		496, 496, 496, 496, 496, 496, 496, 496, 496, 496, 496, 496, 496, 496, 496, 496, 496, 496, 496, 496, 496, 496, 496, 496, 496,
+		496, 496, 496, 496, 496, 496, 496, 496, 496, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511,
+		511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 511, 512, 511, 511, 511, 511, 511, 512,
+		511, 511, 513, 514, 515, 515, 515, 515, 514, 515, 516, 516, 516, 515, 517, 514, 517, 518, 513, 513, 516, 516, 512, 519, 519,
+		519, 519, 519, 519, 519, 519, 519, 519, 520, 520, 521, 521, 521, 521, 511, 511, 511, 511, 511, 511, 514, 514, 515, 515, 512,
+		512, 512, 512, 516, 516, 516, 512, 513, 522, 522, 512, 512, 513, 513, 522, 522, 522, 522, 522, 512, 512, 512, 516, 516, 516,
+		516, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 516, 513, 513, 516, 516, 523, 523, 523, 523, 523, 523,
+		518, 512, 523, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 525, 525, 526, 527, 528, 528, 529, 529, 529, 529, 529, 529,
+		529, 529, 529, 529, 529, 529, 529, 529, 529, 529, 529, 529, 529, 529, 529, 529, 529, 529, 529, 529, 529, 529, 529, 529, 529,
+		529, 529, 529, 529, 529, 529, 529, 530, 531, 530, 530, 530, 530, 530, 531, 530, 530, 532, 532, 532, 532, 532, 532, 532, 532,
+		532, 532, 532, 532, 532, 532, 532, 532, 532, 532, 532, 532, 532, 532, 532, 532, 532, 532, 532, 532, 532, 532, 532, 532, 532,
+		532, 532, 532, 532, 532, 532, 533, 533, 534, 534, 535, 536, 537, 537, 537, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538,
+		538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538,
+		538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538,
+		538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538,
+		538, 538, 538, 538, 538, 539, 539, 539, 539, 539, 540, 541, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542,
+		542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542,
+		542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542,
+		542, 542, 542, 543, 543, 543, 543, 543, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542,
+		542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542,
+		542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542,
+		542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 543, 543, 543, 543, 543, 543, 544, 544, 544, 544,
+		544, 544, 544, 545, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544,
+		544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544,
+		544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 545, 544, 546, 544, 544, 544, 544, 546,
+		546, 544, 544, 544, 544, 544, 544, 544, 546, 544, 546, 544, 544, 544, 544, 546, 546, 544, 544, 544, 544, 544, 544, 544, 544,
+		544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544,
+		544, 544, 544, 544, 544, 544, 545, 544, 546, 544, 544, 544, 544, 546, 546, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544,
+		544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 545, 544, 546, 544,
+		544, 544, 544, 546, 546, 544, 544, 544, 544, 544, 544, 544, 546, 544, 546, 544, 544, 544, 544, 546, 546, 544, 544, 544, 544,
+		544, 544, 544, 545, 544, 544, 544, 544, 544, 544, 544, 546, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544,
+		544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 545, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544,
+		544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 545, 544, 546, 544, 544, 544, 544, 546,
+		546, 544, 544, 544, 544, 544, 544, 544, 545, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544,
+		544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 545, 544,
+		544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 544, 546, 546, 547, 547, 548, 549, 550,
+		551, 550, 550, 550, 550, 551, 551, 552, 552, 552, 552, 552, 552, 552, 552, 552, 553, 553, 553, 553, 553, 553, 553, 553, 553,
+		553, 553, 546, 546, 546, 545, 545, 545, 545, 545, 545, 545, 545, 545, 545, 545, 545, 545, 545, 545, 545, 554, 554, 554, 554,
+		554, 554, 554, 554, 554, 554, 546, 546, 546, 546, 546, 546, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555,
+		555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555,
+		555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555,
+		555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 556, 556, 556, 556, 556, 557, 558, 558,
+		559, 559, 559, 559, 559, 559, 558, 558, 560, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561,
+		561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561,
+		561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561,
+		561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561,
+		561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561,
+		561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561,
+		561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561,
+		561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561,
+		561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561,
+		561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561,
+		561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561,
+		561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561,
+		561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561,
+		561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561,
+		561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 562, 563,
+		561, 561, 561, 561, 561, 561, 561, 561, 564, 564, 564, 564, 564, 564, 564, 564, 564, 565, 566, 566, 566, 566, 566, 566, 566,
+		566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 567, 568, 569, 569, 569, 570,
+		570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570,
+		570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570,
+		570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 571,
+		571, 571, 572, 572, 572, 573, 573, 573, 573, 573, 573, 573, 573, 574, 574, 574, 574, 574, 574, 574, 575, 575, 575, 575, 575,
+		575, 575, 575, 575, 575, 575, 575, 575, 576, 575, 575, 575, 575, 577, 577, 578, 576, 576, 576, 576, 576, 576, 576, 576, 576,
+		576, 576, 579, 579, 579, 579, 579, 579, 579, 579, 579, 579, 579, 579, 579, 579, 579, 579, 579, 579, 580, 580, 581, 582, 582,
+		583, 583, 583, 583, 583, 583, 583, 583, 583, 584, 584, 584, 584, 584, 584, 584, 584, 584, 584, 584, 584, 584, 584, 584, 584,
+		584, 584, 585, 585, 586, 586, 586, 586, 586, 586, 586, 586, 586, 586, 586, 586, 587, 587, 587, 587, 587, 587, 587, 587, 587,
+		587, 587, 587, 587, 588, 587, 587, 587, 588, 589, 589, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 588, 590, 590,
+		590, 590, 590, 590, 590, 590, 590, 590, 590, 590, 590, 590, 590, 590, 590, 590, 590, 590, 590, 590, 590, 590, 590, 590, 590,
+		590, 590, 590, 590, 590, 590, 590, 590, 590, 590, 590, 590, 590, 590, 590, 590, 590, 590, 590, 590, 590, 590, 590, 590, 590,
+		591, 591, 592, 593, 593, 593, 593, 593, 593, 593, 592, 592, 592, 592, 592, 592, 592, 592, 593, 592, 592, 594, 594, 594, 594,
+		594, 594, 594, 594, 594, 594, 594, 595, 595, 595, 596, 597, 597, 595, 598, 590, 599, 600, 600, 601, 601, 601, 601, 601, 601,
+		601, 601, 601, 601, 600, 600, 600, 600, 600, 600, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 600, 600, 600, 600, 600,
+		600, 603, 603, 604, 605, 606, 604, 607, 603, 606, 608, 609, 610, 610, 610, 611, 612, 613, 613, 613, 613, 613, 613, 613, 613,
+		613, 613, 612, 612, 612, 612, 612, 612, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614,
+		614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 615, 614, 614, 614, 614, 614, 614,
+		614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614,
+		614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 612, 612, 612, 612,
+		612, 612, 612, 612, 614, 614, 614, 614, 614, 616, 616, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614,
+		614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 614, 617, 618, 612, 612, 612,
+		612, 612, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564,
+		564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564,
+		564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 619, 619, 619, 619, 619, 619, 619, 619, 619, 619, 619, 619, 619, 619, 619, 619, 619, 619,
+		619, 619, 619, 619, 619, 619, 619, 619, 619, 619, 619, 620, 620, 621, 622, 622, 622, 623, 623, 623, 623, 622, 622, 623, 623,
+		623, 621, 621, 621, 621, 623, 623, 622, 623, 623, 623, 623, 623, 623, 624, 624, 624, 621, 621, 621, 621, 625, 621, 621, 621,
+		626, 626, 627, 627, 627, 627, 627, 627, 627, 627, 627, 627, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628,
+		628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 146, 146, 628, 628, 628, 628, 628, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629,
+		629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629,
+		629, 629, 630, 630, 146, 146, 146, 146, 629, 629, 629, 629, 629, 631, 631, 631, 629, 629, 631, 629, 629, 629, 629, 629, 629,
+		629, 629, 629, 629, 629, 629, 629, 629, 629, 146, 146, 146, 146, 146, 146, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632,
+		633, 146, 146, 146, 634, 634, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635,
+		635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 636, 636, 636, 636, 636, 636, 636, 636, 636, 636, 636, 636,
+		636, 636, 636, 636, 636, 636, 636, 636, 636, 636, 636, 637, 637, 638, 638, 637, 639, 639, 640, 640, 641, 641, 641, 641, 641,
+		641, 641, 641, 641, 641, 641, 641, 641, 641, 641, 641, 641, 641, 641, 641, 641, 641, 641, 641, 641, 641, 641, 641, 641, 641,
+		641, 641, 641, 641, 641, 641, 641, 641, 641, 641, 641, 641, 641, 641, 641, 641, 641, 641, 641, 641, 641, 641, 641, 642, 643,
+		642, 643, 643, 643, 643, 643, 643, 643, 146, 644, 642, 643, 642, 642, 643, 643, 643, 643, 643, 643, 643, 643, 642, 642, 642,
+		642, 642, 642, 643, 643, 645, 645, 645, 645, 645, 645, 645, 645, 146, 146, 645, 646, 646, 646, 646, 646, 646, 646, 646, 646,
+		646, 146, 146, 146, 146, 146, 146, 646, 646, 646, 646, 646, 646, 646, 646, 646, 646, 146, 146, 146, 146, 146, 146, 647, 647,
+		647, 647, 647, 647, 647, 648, 649, 649, 649, 649, 647, 647, 146, 146, 650, 650, 650, 650, 650, 650, 650, 650, 650, 650, 650,
+		650, 650, 650, 651, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 652, 652, 652, 652, 653, 654,
+		654, 654, 654, 654, 654, 654, 654, 654, 654, 654, 654, 654, 654, 654, 654, 654, 654, 654, 654, 654, 654, 654, 654, 654, 654,
+		654, 654, 654, 654, 654, 654, 654, 654, 654, 654, 654, 654, 654, 654, 654, 654, 654, 654, 654, 654, 654, 655, 653, 652, 652,
+		652, 652, 652, 653, 652, 653, 653, 653, 653, 653, 652, 653, 656, 654, 654, 654, 654, 654, 654, 654, 657, 657, 657, 657, 658,
+		658, 658, 658, 658, 658, 658, 658, 658, 658, 659, 659, 660, 661, 659, 659, 660, 662, 662, 662, 662, 662, 662, 662, 662, 662,
+		662, 655, 655, 655, 655, 655, 655, 655, 655, 655, 662, 662, 662, 662, 662, 662, 662, 662, 662, 657, 657, 657, 663, 663, 664,
+		665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665, 665,
+		665, 665, 665, 665, 665, 664, 663, 663, 663, 663, 664, 664, 663, 663, 666, 667, 668, 668, 665, 665, 669, 669, 669, 669, 669,
+		669, 669, 669, 669, 669, 670, 670, 670, 670, 670, 670, 671, 671, 671, 671, 671, 671, 671, 671, 671, 671, 671, 671, 671, 671,
+		671, 671, 671, 671, 671, 671, 671, 671, 671, 671, 671, 671, 671, 671, 671, 671, 671, 671, 671, 671, 671, 671, 671, 671, 672,
+		673, 674, 674, 673, 673, 673, 674, 673, 674, 674, 674, 675, 675, 676, 676, 676, 676, 676, 676, 676, 676, 677, 677, 677, 677,
+		678, 678, 678, 678, 678, 678, 678, 678, 678, 678, 678, 678, 678, 678, 678, 678, 678, 678, 678, 678, 678, 678, 678, 678, 678,
+		678, 678, 678, 678, 678, 678, 678, 678, 678, 678, 678, 679, 679, 679, 679, 679, 679, 679, 679, 680, 680, 680, 680, 680, 680,
+		680, 680, 679, 679, 681, 682, 683, 683, 683, 684, 684, 685, 685, 685, 686, 686, 686, 686, 686, 686, 686, 686, 686, 686, 683,
+		683, 683, 678, 678, 678, 687, 687, 687, 687, 687, 687, 687, 687, 687, 687, 688, 688, 688, 688, 688, 688, 688, 688, 688, 688,
+		688, 688, 688, 688, 688, 688, 688, 688, 688, 688, 688, 688, 688, 688, 688, 688, 688, 688, 688, 688, 689, 689, 689, 690, 689,
+		689, 691, 691, 692, 693, 694, 695, 695, 696, 697, 698, 699, 700, 700, 700, 700, 700, 700, 700, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 701, 701, 701, 701, 701, 701, 701, 701,
+		702, 702, 702, 702, 702, 702, 702, 702, 703, 703, 703, 704, 703, 703, 703, 703, 703, 703, 703, 703, 703, 703, 703, 703, 703,
+		705, 703, 703, 703, 703, 703, 703, 703, 706, 706, 706, 706, 703, 706, 706, 706, 706, 707, 708, 709, 710, 710, 711, 650, 650,
+		146, 146, 146, 146, 146, 146, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83,
+		83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 712, 712, 712, 712, 712, 713, 714, 714, 714, 714, 714, 714, 714,
+		714, 714, 714, 714, 714, 714, 714, 714, 714, 714, 714, 714, 714, 714, 714, 714, 714, 714, 714, 714, 714, 714, 714, 714, 714,
+		714, 714, 714, 714, 714, 714, 714, 714, 714, 714, 714, 714, 714, 714, 714, 714, 714, 715, 715, 715, 715, 715, 716, 714, 714,
+		714, 715, 715, 715, 715, 715, 83, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 717, 718, 84, 84, 84, 719, 84, 84, 84,
+		84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 720, 84, 84, 84, 84, 721, 721, 721, 721,
+		721, 721, 721, 721, 721, 722, 721, 721, 721, 722, 721, 721, 721, 721, 721, 721, 721, 721, 721, 721, 721, 721, 721, 721, 721,
+		721, 721, 721, 721, 721, 721, 721, 723, 141, 141, 141, 141, 724, 724, 724, 724, 724, 724, 724, 725, 725, 725, 725, 725, 726,
+		726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 727, 727, 727,
+		727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 650, 728, 728, 728, 728, 146, 729, 730, 703, 724, 724, 45, 46, 45,
+		46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46,
+		45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 47, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45,
+		46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46,
+		45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45,
+		46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 49, 49, 49, 49, 51, 731, 732,
+		732, 733, 732, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45,
+		46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 47, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46,
+		45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45, 46, 45,
+		46, 734, 735, 734, 735, 734, 735, 736, 736, 736, 736, 736, 736, 736, 736, 737, 737, 737, 737, 737, 737, 737, 737, 736, 736,
+		736, 736, 736, 736, 146, 146, 737, 737, 737, 737, 737, 737, 146, 146, 736, 736, 736, 736, 736, 736, 736, 736, 737, 737, 737,
+		737, 737, 737, 737, 737, 736, 736, 736, 736, 736, 736, 736, 736, 737, 737, 737, 737, 737, 737, 737, 737, 736, 736, 736, 736,
+		736, 736, 146, 146, 737, 737, 737, 737, 737, 737, 146, 146, 156, 736, 156, 736, 156, 736, 156, 736, 146, 737, 146, 737, 146,
+		737, 146, 737, 736, 736, 736, 736, 736, 736, 736, 736, 737, 737, 737, 737, 737, 737, 737, 737, 738, 738, 739, 739, 739, 739,
+		740, 740, 741, 741, 742, 742, 743, 743, 146, 146, 744, 744, 744, 744, 744, 744, 744, 744, 745, 745, 745, 745, 745, 745, 745,
+		745, 744, 744, 744, 744, 744, 744, 744, 744, 745, 745, 745, 745, 745, 745, 745, 745, 744, 744, 744, 744, 744, 744, 744, 744,
+		745, 745, 745, 745, 745, 745, 745, 745, 736, 736, 744, 744, 744, 146, 156, 744, 737, 737, 746, 746, 747, 145, 748, 145, 145,
+		145, 744, 744, 744, 146, 156, 744, 749, 749, 749, 749, 747, 145, 145, 145, 736, 736, 156, 156, 146, 146, 156, 156, 737, 737,
+		750, 750, 146, 145, 145, 145, 736, 736, 156, 156, 156, 180, 156, 156, 737, 737, 751, 751, 752, 145, 145, 145, 146, 146, 744,
+		744, 744, 146, 156, 744, 753, 753, 754, 754, 747, 145, 145, 146, 755, 755, 755, 755, 755, 755, 755, 755, 755, 755, 755, 756,
+		757, 758, 759, 759, 760, 760, 760, 760, 760, 760, 761, 29, 762, 763, 764, 34, 34, 40, 764, 34, 29, 29, 29, 29, 765, 29, 29,
+		765, 766, 767, 768, 768, 768, 768, 768, 769, 29, 29, 761, 761, 761, 29, 29, 29, 29, 34, 40, 29, 770, 770, 29, 771, 772, 29,
+		29, 29, 35, 773, 774, 775, 776, 776, 777, 777, 777, 777, 778, 778, 778, 778, 779, 780, 781, 782, 782, 778, 782, 782, 782,
+		782, 782, 782, 782, 783, 784, 785, 785, 785, 786, 787, 788, 788, 788, 788, 36, 36, 36, 36, 36, 36, 37, 789, 146, 146, 37,
+		37, 37, 37, 37, 37, 790, 791, 790, 792, 793, 794, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 790, 791, 790, 792, 793, 146, 721,
+		721, 721, 721, 721, 795, 795, 795, 795, 795, 795, 795, 795, 146, 146, 146, 796, 796, 796, 796, 796, 796, 796, 796, 796, 796,
+		796, 797, 798, 799, 799, 799, 800, 800, 801, 801, 801, 801, 802, 802, 802, 803, 804, 805, 805, 805, 806, 807, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 808, 808, 808, 808, 808, 808, 808, 808, 808, 808, 808, 808,
+		808, 809, 809, 809, 809, 808, 810, 810, 811, 812, 812, 142, 142, 142, 142, 813, 814, 814, 814, 814, 726, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 815, 815, 816, 815, 815, 815, 815, 816, 815, 815, 817, 816, 816, 816,
+		817, 817, 816, 816, 816, 817, 815, 816, 815, 815, 818, 816, 816, 816, 816, 816, 815, 815, 815, 815, 815, 815, 816, 815, 819,
+		815, 816, 820, 821, 822, 816, 816, 823, 817, 816, 816, 824, 816, 817, 825, 825, 825, 825, 826, 827, 828, 829, 830, 831, 831,
+		832, 832, 832, 832, 832, 831, 830, 830, 833, 833, 834, 832, 835, 836, 837, 838, 839, 839, 839, 37, 37, 37, 37, 37, 37, 37,
+		37, 37, 37, 37, 37, 37, 840, 840, 840, 840, 840, 840, 840, 840, 840, 840, 840, 840, 840, 840, 840, 840, 841, 841, 841, 841,
+		841, 841, 841, 841, 841, 841, 841, 841, 841, 841, 841, 841, 842, 842, 842, 80, 91, 843, 843, 843, 843, 839, 844, 844, 146,
+		146, 146, 146, 845, 845, 845, 845, 845, 846, 846, 846, 846, 846, 845, 845, 846, 846, 846, 846, 845, 846, 846, 845, 846, 846,
+		845, 846, 847, 846, 846, 846, 846, 846, 845, 847, 846, 846, 847, 847, 847, 847, 846, 846, 847, 847, 847, 847, 846, 846, 846,
+		846, 846, 846, 846, 846, 846, 846, 846, 846, 846, 846, 846, 846, 846, 846, 845, 845, 846, 846, 845, 846, 845, 846, 846, 846,
+		846, 846, 846, 846, 847, 846, 847, 847, 847, 847, 847, 847, 846, 846, 847, 847, 847, 847, 847, 848, 848, 848, 848, 848, 848,
+		848, 848, 848, 849, 849, 849, 849, 849, 849, 849, 849, 849, 849, 849, 849, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+		35, 35, 35, 35, 35, 35, 850, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+		35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+		35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+		35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+		35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+		35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+		35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+		35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779,
+		779, 31, 851, 31, 31, 31, 31, 31, 31, 852, 853, 852, 853, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+		31, 31, 31, 31, 35, 35, 31, 31, 31, 31, 31, 31, 31, 773, 774, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+		31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+		31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+		31, 31, 31, 851, 779, 851, 851, 851, 851, 851, 851, 851, 851, 851, 851, 851, 851, 851, 851, 851, 851, 851, 851, 851, 851,
+		851, 851, 851, 851, 851, 851, 851, 851, 851, 851, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779,
+		779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 854, 854, 855, 854, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855,
+		855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 856, 857, 858, 858, 858, 858, 858, 858, 858, 858, 858, 858, 858,
+		859, 859, 859, 859, 859, 859, 860, 861, 861, 861, 861, 861, 862, 863, 863, 863, 863, 863, 863, 863, 863, 863, 863, 863, 864,
+		864, 864, 864, 864, 864, 864, 865, 865, 865, 865, 866, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+		31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 851, 851, 867, 867, 867, 867, 867, 867, 867,
+		867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 31, 31, 31, 31, 31, 31, 31, 31,
+		31, 31, 31, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 37,
+		37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+		37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 815, 815,
+		815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 868,
+		868, 868, 868, 868, 868, 868, 868, 868, 868, 868, 868, 868, 868, 868, 868, 868, 868, 868, 868, 868, 868, 868, 868, 868, 868,
+		869, 869, 869, 869, 869, 869, 869, 869, 869, 869, 869, 869, 869, 869, 869, 869, 869, 869, 869, 869, 869, 869, 869, 869, 869,
+		869, 37, 870, 870, 870, 870, 870, 870, 870, 870, 870, 870, 870, 870, 870, 870, 870, 870, 870, 870, 870, 870, 871, 31, 31,
+		31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+		31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+		31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+		31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+		31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 855, 855, 855, 855, 855,
+		855, 855, 855, 855, 855, 872, 872, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 872, 872, 872, 872, 872, 872, 872, 872,
+		872, 35, 31, 31, 31, 31, 872, 872, 872, 872, 872, 35, 31, 31, 31, 31, 872, 872, 31, 31, 872, 872, 31, 31, 31, 872, 872, 872,
+		872, 872, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 872, 31, 872, 31, 31, 872, 872, 872, 872, 872, 872, 31,
+		31, 31, 851, 851, 851, 851, 851, 851, 851, 851, 779, 779, 779, 779, 779, 779, 779, 779, 31, 31, 31, 31, 31, 872, 872, 31,
+		31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 856, 856, 855, 855, 858, 851, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+		31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 872, 31, 872,
+		31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 872,
+		872, 872, 872, 31, 31, 31, 31, 31, 31, 31, 31, 31, 872, 872, 35, 851, 851, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855,
+		855, 855, 858, 858, 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 856, 856, 856, 856, 856, 856, 856, 856, 858, 858, 858,
+		858, 858, 858, 858, 858, 858, 858, 858, 873, 862, 862, 856, 856, 858, 858, 858, 858, 858, 858, 858, 858, 858, 858, 858, 858,
+		858, 858, 858, 858, 861, 873, 873, 873, 873, 873, 873, 873, 873, 873, 873, 862, 862, 862, 873, 873, 873, 873, 862, 862, 862,
+		862, 862, 862, 862, 862, 862, 862, 863, 862, 862, 862, 862, 862, 862, 862, 862, 862, 862, 862, 862, 862, 862, 862, 862, 862,
+		862, 862, 863, 862, 863, 863, 863, 863, 862, 862, 862, 862, 862, 862, 862, 862, 862, 862, 862, 862, 862, 862, 862, 862, 862,
+		862, 862, 862, 862, 862, 862, 862, 874, 875, 875, 875, 875, 876, 875, 875, 875, 875, 876, 876, 875, 875, 875, 875, 875, 875,
+		875, 875, 875, 875, 875, 875, 875, 875, 875, 875, 875, 875, 875, 875, 875, 875, 875, 875, 875, 875, 875, 875, 876, 875, 875,
+		875, 875, 875, 875, 875, 875, 875, 875, 875, 875, 875, 875, 875, 875, 875, 875, 875, 875, 875, 875, 875, 875, 875, 875, 875,
+		875, 875, 875, 875, 875, 875, 875, 875, 876, 875, 876, 875, 875, 875, 875, 876, 876, 876, 875, 877, 875, 875, 875, 875, 875,
+		875, 875, 876, 876, 875, 875, 875, 875, 875, 875, 875, 878, 879, 878, 879, 878, 879, 878, 879, 878, 879, 878, 879, 878, 879,
+		880, 880, 880, 880, 880, 880, 880, 880, 880, 880, 880, 880, 880, 880, 880, 880, 880, 880, 880, 880, 880, 880, 880, 880, 880,
+		880, 880, 880, 880, 880, 875, 876, 876, 876, 875, 875, 875, 875, 875, 875, 875, 875, 875, 875, 875, 875, 875, 875, 875, 875,
+		875, 875, 875, 875, 875, 875, 875, 875, 876, 875, 875, 875, 875, 875, 875, 875, 875, 875, 875, 875, 875, 875, 875, 876, 881,
+		881, 881, 881, 881, 882, 883, 859, 859, 859, 859, 884, 885, 884, 886, 886, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779,
+		779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 887, 888, 887, 888, 887, 888, 889, 890, 889, 890, 779, 779, 779,
+		779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891,
+		891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891,
+		891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891,
+		891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891,
+		891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891,
+		891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 891, 779, 779, 779, 779, 779, 779, 779, 779, 779,
+		779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779,
+		779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779,
+		779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779,
+		779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779,
+		779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 887, 888, 887,
+		888, 887, 888, 887, 888, 887, 888, 887, 888, 887, 888, 887, 888, 887, 888, 887, 888, 887, 888, 779, 779, 779, 779, 779, 779,
+		779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779,
+		779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779,
+		779, 779, 779, 779, 779, 779, 779, 887, 888, 887, 888, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779,
+		779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 779, 887, 888, 779, 779, 856, 856, 856,
+		856, 856, 856, 856, 856, 856, 856, 856, 856, 856, 856, 858, 858, 858, 858, 858, 858, 861, 861, 861, 861, 861, 861, 861, 873,
+		873, 873, 873, 873, 861, 861, 861, 861, 873, 873, 873, 873, 873, 873, 873, 873, 873, 873, 873, 873, 885, 885, 885, 885, 885,
+		885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 873, 873, 885, 885, 885, 885, 885, 885, 864,
+		864, 864, 873, 873, 873, 873, 873, 862, 862, 862, 862, 862, 864, 864, 864, 864, 864, 864, 864, 864, 864, 864, 864, 864, 864,
+		864, 864, 864, 864, 864, 864, 864, 864, 864, 864, 864, 864, 864, 867, 867, 864, 864, 864, 864, 864, 864, 864, 864, 864, 864,
+		864, 864, 864, 864, 864, 864, 864, 864, 864, 864, 864, 864, 864, 864, 864, 864, 864, 864, 864, 864, 864, 864, 867, 867, 864,
+		864, 864, 864, 864, 864, 864, 864, 864, 864, 864, 864, 864, 864, 864, 864, 864, 864, 864, 864, 864, 864, 864, 864, 864, 864,
+		864, 864, 864, 864, 864, 864, 864, 864, 867, 867, 867, 864, 864, 864, 864, 864, 864, 864, 864, 864, 864, 864, 864, 867, 864,
+		864, 864, 864, 864, 864, 864, 864, 866, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867,
+		867, 867, 867, 867, 867, 867, 867, 867, 892, 892, 892, 892, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867,
+		867, 867, 867, 893, 893, 893, 893, 893, 893, 893, 893, 893, 893, 893, 893, 893, 893, 893, 893, 893, 893, 893, 893, 893, 893,
+		893, 893, 893, 893, 893, 893, 893, 893, 893, 893, 893, 893, 893, 893, 893, 893, 893, 893, 893, 893, 893, 893, 893, 893, 893,
+		894, 895, 895, 895, 895, 895, 895, 895, 895, 895, 895, 895, 895, 895, 895, 895, 895, 895, 895, 895, 895, 895, 895, 895, 895,
+		895, 895, 895, 895, 895, 895, 895, 895, 895, 895, 895, 895, 895, 895, 895, 895, 895, 895, 895, 895, 895, 895, 895, 894, 95,
+		91, 896, 897, 898, 899, 900, 95, 91, 95, 91, 95, 91, 901, 902, 903, 904, 732, 734, 735, 905, 95, 91, 905, 732, 732, 732,
+		732, 906, 907, 908, 908, 909, 910, 909, 910, 909, 910, 909, 910, 909, 910, 909, 910, 909, 910, 909, 910, 909, 910, 909, 910,
+		909, 910, 909, 910, 909, 910, 909, 910, 909, 910, 909, 910, 909, 910, 909, 910, 909, 910, 909, 910, 909, 910, 909, 910, 909,
+		910, 909, 910, 909, 910, 909, 910, 909, 910, 909, 910, 909, 910, 909, 910, 909, 910, 909, 910, 909, 910, 909, 910, 909, 910,
+		909, 910, 909, 910, 909, 910, 909, 910, 909, 910, 909, 910, 909, 910, 909, 910, 909, 910, 909, 910, 909, 910, 909, 910, 909,
+		910, 909, 910, 909, 910, 911, 912, 912, 912, 912, 912, 912, 913, 914, 913, 914, 915, 915, 915, 916, 917, 918, 918, 918, 918,
+		918, 919, 919, 919, 919, 920, 919, 919, 921, 921, 921, 921, 921, 921, 921, 921, 921, 921, 921, 921, 921, 921, 921, 921, 921,
+		921, 921, 921, 921, 921, 921, 921, 921, 921, 921, 921, 921, 921, 921, 921, 921, 921, 921, 921, 921, 921, 530, 922, 530, 530,
+		530, 530, 530, 922, 530, 530, 923, 923, 923, 923, 923, 923, 923, 923, 923, 923, 923, 923, 923, 923, 923, 923, 923, 923, 923,
+		923, 923, 923, 923, 923, 923, 923, 923, 923, 923, 923, 923, 923, 923, 923, 923, 923, 923, 923, 923, 923, 923, 923, 923, 923,
+		923, 923, 923, 923, 923, 923, 923, 923, 923, 923, 924, 924, 925, 925, 925, 925, 925, 925, 925, 926, 927, 925, 925, 925, 925,
+		925, 925, 925, 925, 925, 925, 925, 925, 925, 925, 928, 545, 545, 545, 545, 545, 545, 545, 545, 545, 545, 545, 545, 545, 545,
+		545, 545, 545, 545, 545, 545, 545, 545, 545, 546, 546, 546, 546, 546, 546, 546, 546, 546, 545, 545, 545, 545, 545, 545, 545,
+		546, 545, 545, 545, 545, 545, 545, 545, 546, 545, 545, 545, 545, 545, 545, 545, 546, 545, 545, 545, 545, 545, 545, 545, 546,
+		545, 545, 545, 545, 545, 545, 545, 546, 545, 545, 545, 545, 545, 545, 545, 546, 545, 545, 545, 545, 545, 545, 545, 546, 545,
+		545, 545, 545, 545, 545, 545, 546, 929, 929, 929, 929, 929, 929, 929, 929, 929, 929, 929, 929, 929, 929, 929, 929, 929, 929,
+		929, 929, 929, 929, 929, 929, 929, 929, 929, 929, 929, 929, 929, 929, 782, 782, 930, 931, 930, 931, 782, 782, 782, 930, 931,
+		782, 930, 931, 782, 782, 782, 782, 782, 782, 782, 782, 782, 932, 933, 933, 934, 933, 930, 931, 933, 933, 935, 936, 937, 938,
+		937, 938, 937, 938, 937, 938, 933, 933, 933, 933, 939, 940, 933, 941, 942, 942, 942, 942, 942, 942, 942, 942, 943, 943, 944,
+		945, 945, 945, 946, 947, 948, 949, 949, 950, 950, 950, 950, 950, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867,
+		867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867,
+		867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 867, 951, 951, 951, 951, 951, 951, 951, 951,
+		951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 146, 951, 951, 951, 951, 951, 951,
+		951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951,
+		951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951,
+		951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951,
+		951, 951, 951, 951, 951, 951, 951, 951, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 951, 951, 951, 951, 951,
+		951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951,
+		951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951,
+		951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951,
+		951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951,
+		951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951,
+		951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951,
+		951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951,
+		951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 951,
+		951, 951, 951, 951, 951, 951, 951, 951, 951, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 952, 952, 827, 827, 952, 952, 952, 952, 952, 952, 952, 952, 146, 146, 146,
+		146, 755, 953, 770, 29, 815, 954, 955, 956, 773, 774, 773, 774, 764, 957, 764, 957, 773, 774, 31, 31, 773, 774, 773, 774,
+		773, 774, 773, 774, 760, 764, 957, 957, 31, 956, 956, 956, 956, 956, 956, 956, 956, 956, 136, 136, 136, 136, 958, 958, 760,
+		959, 959, 959, 959, 959, 815, 815, 960, 960, 960, 961, 962, 963, 827, 815, 964, 965, 965, 965, 965, 965, 965, 965, 965, 965,
+		965, 965, 965, 965, 965, 965, 965, 965, 965, 965, 965, 965, 965, 965, 965, 965, 965, 965, 965, 965, 965, 965, 965, 965, 965,
+		965, 965, 965, 965, 965, 965, 965, 965, 965, 965, 965, 965, 965, 965, 965, 965, 965, 965, 965, 965, 965, 965, 965, 965, 965,
+		965, 965, 965, 965, 965, 965, 965, 965, 965, 965, 965, 965, 965, 965, 965, 965, 965, 965, 965, 965, 965, 965, 965, 965, 965,
+		966, 966, 964, 964, 967, 967, 968, 968, 969, 969, 966, 970, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971,
+		971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971,
+		971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971,
+		971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971, 971,
+		971, 971, 972, 973, 974, 974, 975, 976, 976, 976, 976, 976, 977, 977, 977, 977, 977, 977, 977, 977, 977, 977, 977, 977, 977,
+		977, 977, 977, 977, 977, 977, 977, 977, 977, 977, 977, 977, 977, 977, 977, 977, 977, 977, 977, 977, 977, 977, 977, 977, 977,
+		977, 977, 978, 979, 976, 146, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538,
+		538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538,
+		538, 538, 538, 538, 538, 538, 538, 540, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538,
+		538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538,
+		146, 980, 980, 981, 981, 981, 981, 980, 980, 980, 980, 980, 980, 980, 980, 980, 980, 982, 982, 982, 982, 982, 982, 982, 982,
+		982, 982, 982, 982, 982, 982, 982, 982, 982, 982, 982, 982, 982, 982, 982, 982, 983, 983, 983, 976, 976, 976, 976, 976, 835,
+		835, 835, 835, 835, 835, 835, 835, 835, 835, 835, 835, 835, 835, 835, 835, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838,
+		838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 975, 975, 975,
+		975, 975, 975, 975, 975, 975, 975, 975, 975, 975, 975, 975, 975, 984, 984, 984, 984, 984, 984, 984, 984, 984, 984, 984, 984,
+		984, 984, 984, 984, 984, 984, 984, 984, 984, 984, 984, 984, 984, 984, 984, 984, 984, 985, 985, 146, 37, 37, 37, 37, 37, 37,
+		37, 37, 37, 37, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815,
+		815, 815, 815, 815, 815, 986, 986, 986, 986, 839, 839, 839, 839, 839, 839, 839, 839, 828, 870, 870, 870, 870, 870, 870, 870,
+		870, 870, 870, 870, 870, 870, 870, 870, 984, 984, 984, 984, 984, 984, 984, 984, 984, 984, 984, 984, 984, 984, 984, 984, 984,
+		984, 984, 984, 984, 984, 984, 984, 984, 984, 984, 984, 985, 985, 987, 815, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 815, 815,
+		815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815,
+		815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 870, 870, 870, 870, 870, 870, 870, 870, 870, 870, 870, 870, 870,
+		870, 870, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 828, 828, 828, 828, 988, 988, 988, 988, 988, 988, 988,
+		988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988,
+		988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 146, 988, 988, 988, 988, 988, 988, 988, 988, 988,
+		988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988,
+		988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988,
+		988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988, 988,
+		988, 988, 988, 988, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815,
+		815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 828, 828, 828, 828, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815,
+		815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815,
+		815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815,
+		815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815,
+		815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 828, 828, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815,
+		815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 828, 989, 989, 989,
+		989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989,
+		989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989,
+		989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989,
+		989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989,
+		989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989,
+		989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989,
+		989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989,
+		989, 989, 989, 989, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828,
+		828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828,
+		828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828,
+		828, 828, 828, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990,
+		990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990,
+		990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990,
+		990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990,
+		990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990,
+		990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990,
+		990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 990, 991, 991, 991, 991, 991, 991,
+		991, 991, 991, 991, 991, 991, 991, 991, 991, 991, 991, 991, 991, 991, 991, 991, 992, 992, 992, 992, 992, 992, 992, 992, 993,
+		993, 993, 993, 993, 993, 993, 993, 994, 995, 995, 995, 995, 995, 995, 995, 995, 995, 996, 996, 996, 996, 996, 996, 996, 996,
+		996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997,
+		997, 997, 997, 997, 997, 998, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997,
+		997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997,
+		997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997,
+		997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997,
+		997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997,
+		997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997,
+		997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997,
+		997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997,
+		997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997,
+		997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 997,
+		997, 997, 997, 146, 146, 146, 999, 999, 999, 999, 999, 999, 999, 999, 999, 999, 999, 999, 999, 999, 999, 999, 999, 999, 1000,
+		1000, 999, 999, 999, 999, 999, 999, 999, 999, 999, 999, 999, 999, 999, 999, 999, 999, 1000, 999, 999, 999, 999, 999, 999,
+		999, 999, 999, 999, 999, 999, 1000, 999, 999, 999, 1000, 999, 146, 146, 146, 146, 146, 146, 146, 146, 146, 1001, 1001, 1001,
+		1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001,
+		1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1002, 1002, 1002, 1002, 1002,
+		1002, 1003, 1004, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005,
+		1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005,
+		1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005,
+		1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005,
+		1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005,
+		1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005,
+		1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1006, 1007, 1008, 1008,
+		1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1009, 1009, 1009, 1009, 1009,
+		1009, 1009, 1009, 1009, 1009, 1005, 1005, 1010, 1010, 1010, 1010, 1010, 1010, 1010, 1010, 1010, 1010, 1010, 1010, 1010, 1010,
+		1010, 1010, 1010, 1010, 1010, 1010, 214, 215, 214, 215, 214, 215, 214, 215, 214, 215, 214, 215, 214, 215, 214, 215, 214,
+		215, 214, 215, 214, 215, 214, 215, 214, 215, 214, 215, 214, 215, 214, 215, 218, 219, 214, 215, 214, 215, 214, 215, 214, 215,
+		214, 215, 214, 215, 1011, 202, 1012, 1012, 1012, 1013, 1014, 1014, 1014, 1014, 1014, 1014, 1014, 1014, 202, 202, 1013, 1015,
+		214, 215, 214, 215, 214, 215, 214, 215, 214, 215, 214, 215, 214, 215, 214, 215, 214, 215, 214, 215, 214, 215, 214, 215, 220,
+		221, 220, 221, 1016, 1016, 1017, 1014, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018,
+		1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018,
+		1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018,
+		1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1019, 1019, 1019, 1019, 1019, 1019, 1019,
+		1019, 1019, 1019, 1020, 1020, 1021, 1022, 1023, 1023, 1023, 1022, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1025, 1025,
+		1025, 1025, 1025, 1025, 1025, 1025, 1025, 1025, 1025, 1025, 1025, 1025, 1025, 1025, 1025, 1025, 1025, 1025, 1025, 1025, 1025,
+		1026, 1026, 1026, 1026, 1027, 1027, 1027, 1027, 1027, 1028, 1028, 734, 735, 734, 735, 734, 735, 734, 735, 734, 735, 734,
+		735, 734, 735, 732, 732, 734, 735, 734, 735, 734, 735, 734, 735, 734, 735, 734, 735, 734, 735, 734, 735, 734, 735, 734, 735,
+		734, 735, 734, 735, 734, 735, 734, 735, 734, 735, 734, 735, 734, 735, 734, 735, 734, 735, 734, 735, 734, 735, 734, 735, 734,
+		735, 734, 735, 734, 735, 734, 735, 734, 735, 734, 735, 734, 735, 734, 735, 734, 735, 907, 732, 732, 732, 732, 732, 732, 732,
+		732, 734, 735, 734, 735, 1029, 734, 735, 734, 735, 734, 735, 734, 735, 734, 735, 1027, 1030, 1030, 734, 735, 1031, 1032,
+		1033, 1034, 1035, 1036, 1037, 1038, 1038, 1039, 1040, 1039, 1040, 1039, 1040, 1039, 1040, 1039, 1040, 1034, 1035, 1034, 1035,
+		1034, 1035, 1034, 1035, 1034, 1035, 1041, 1042, 1043, 1044, 1045, 146, 1046, 1047, 1048, 1049, 1050, 1051, 1050, 1051, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 1052, 1053, 1053, 1032, 1054, 1054, 1054, 1054, 1054, 1055, 1055,
+		1056, 1055, 1055, 1055, 1056, 1055, 1055, 1055, 1055, 1056, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055,
+		1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1057, 1057, 1058, 1058, 1057, 1059, 1059, 1059, 1059,
+		146, 146, 146, 146, 839, 839, 839, 839, 839, 839, 986, 986, 802, 986, 146, 146, 146, 146, 146, 146, 1060, 1060, 1060, 1060,
+		1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060,
+		1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060,
+		1060, 1060, 1060, 1060, 1060, 1060, 1061, 1061, 1062, 1062, 1063, 1063, 1063, 1063, 1063, 1063, 1063, 1063, 1064, 1064, 1065,
+		1065, 1065, 1065, 1065, 1065, 1065, 1065, 1065, 1065, 1065, 1065, 1065, 1065, 1065, 1065, 1065, 1065, 1065, 1065, 1065, 1065,
+		1065, 1065, 1065, 1065, 1065, 1065, 1065, 1065, 1065, 1065, 1065, 1065, 1065, 1065, 1065, 1065, 1065, 1065, 1065, 1065, 1065,
+		1065, 1065, 1065, 1065, 1065, 1065, 1065, 1064, 1064, 1064, 1064, 1064, 1064, 1064, 1064, 1064, 1064, 1064, 1064, 1064, 1064,
+		1064, 1064, 1066, 1067, 1068, 1068, 1068, 1068, 1068, 1068, 1068, 1068, 1069, 1069, 1070, 1070, 1070, 1070, 1070, 1070, 1070,
+		1070, 1070, 1070, 1068, 1068, 1068, 1068, 1068, 1068, 1071, 1071, 1071, 1071, 1071, 1071, 1071, 1071, 1071, 1071, 1071, 1071,
+		1071, 1071, 1071, 1071, 1071, 1071, 348, 348, 348, 348, 348, 348, 1072, 1072, 1072, 348, 1073, 1074, 1075, 1075, 1076, 1076,
+		1076, 1076, 1076, 1076, 1076, 1076, 1076, 1076, 1077, 1077, 1077, 1077, 1077, 1077, 1077, 1077, 1077, 1077, 1077, 1077, 1077,
+		1077, 1077, 1077, 1077, 1077, 1077, 1077, 1077, 1077, 1077, 1077, 1077, 1077, 1077, 1077, 1078, 1078, 1078, 1078, 1078, 1079,
+		1079, 1079, 1080, 1081, 1082, 1082, 1082, 1082, 1082, 1082, 1082, 1082, 1082, 1082, 1082, 1082, 1082, 1082, 1082, 1082, 1082,
+		1082, 1082, 1082, 1082, 1082, 1082, 1083, 1083, 1083, 1083, 1083, 1083, 1083, 1083, 1083, 1083, 1083, 1084, 1085, 1086, 1086,
+		1086, 1086, 1086, 1086, 1086, 1086, 1086, 1086, 1086, 1087, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539,
+		539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 146, 146, 146, 1088, 1088, 1088, 1089, 1090,
+		1090, 1090, 1090, 1090, 1090, 1090, 1090, 1090, 1090, 1090, 1090, 1090, 1090, 1090, 1090, 1090, 1090, 1090, 1090, 1090, 1090,
+		1090, 1090, 1090, 1090, 1090, 1090, 1090, 1090, 1090, 1090, 1090, 1090, 1090, 1090, 1090, 1090, 1090, 1090, 1090, 1090, 1090,
+		1090, 1090, 1090, 1090, 1091, 1089, 1089, 1088, 1088, 1088, 1088, 1089, 1089, 1088, 1089, 1089, 1089, 1092, 1093, 1093, 1093,
+		1093, 1093, 1093, 1094, 1095, 1095, 1093, 1093, 1093, 1093, 1096, 1097, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098,
+		1098, 1096, 1096, 1096, 1096, 1093, 1093, 1099, 1099, 1099, 1099, 1099, 1100, 1101, 1099, 1099, 1099, 1099, 1099, 1099, 1099,
+		1099, 1099, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1099, 1099, 1099, 1099, 1099, 1103, 1104, 1104, 1104,
+		1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104,
+		1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1105, 1105, 1105, 1105,
+		1105, 1105, 1106, 1106, 1105, 1105, 1106, 1106, 1105, 1105, 1107, 1107, 1107, 1107, 1107, 1107, 1107, 1107, 1107, 1104, 1104,
+		1104, 1105, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1105, 1106, 1107, 1107, 1108, 1108, 1108, 1108, 1108, 1108, 1108,
+		1108, 1108, 1108, 1107, 1107, 1109, 1110, 1110, 1110, 1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111, 1111,
+		1111, 1111, 1111, 1111, 1112, 1111, 1111, 1111, 1111, 1111, 1111, 1113, 1113, 1113, 1111, 525, 1100, 1114, 1099, 1099, 1115,
+		1115, 1115, 1115, 1115, 1115, 1115, 1115, 1115, 1115, 1115, 1115, 1115, 1115, 1115, 1115, 1115, 1115, 1115, 1115, 1115, 1115,
+		1115, 1115, 1115, 1115, 1115, 1115, 1115, 1115, 1115, 1115, 1115, 1115, 1115, 1115, 1115, 1115, 1115, 1115, 1115, 1115, 1115,
+		1115, 1115, 1115, 1115, 1115, 1116, 1115, 1116, 1116, 1116, 1117, 1117, 1116, 1116, 1117, 1115, 1117, 1117, 1115, 1116, 1118,
+		1119, 1118, 1119, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 1115, 1115, 1120, 1121, 1122, 1123, 1123, 1123, 1123, 1123, 1123, 1123, 1123, 1123, 1123, 1123, 1124, 1125,
+		1125, 1124, 1124, 1126, 1126, 1123, 1127, 1127, 1124, 1128, 146, 146, 146, 146, 146, 146, 146, 146, 146, 546, 1129, 1129,
+		1129, 1129, 1129, 1129, 546, 546, 1129, 1129, 1129, 1129, 1129, 1129, 546, 546, 1129, 1129, 1129, 1129, 1129, 1129, 546,
+		546, 546, 546, 546, 546, 546, 546, 546, 1129, 1129, 1129, 1129, 1129, 1129, 1129, 546, 1129, 1129, 1129, 1129, 1129, 1129,
+		1129, 546, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038,
+		1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1130, 1038, 1038, 1038, 1038,
+		1038, 1038, 1038, 1131, 1132, 1132, 1132, 1132, 1133, 1133, 1133, 1133, 1038, 1134, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135,
+		1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135,
+		1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135,
+		1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1136, 1136,
+		1136, 1136, 1136, 1136, 1136, 1136, 1136, 1136, 1136, 1136, 1136, 1136, 1136, 1136, 1136, 1136, 1136, 1136, 1136, 1136, 1136,
+		1136, 1136, 1136, 1136, 1136, 1136, 1136, 1136, 1136, 1136, 1136, 1136, 1137, 1137, 1138, 1137, 1137, 1138, 1137, 1137, 1139,
+		1140, 1141, 146, 146, 1142, 1142, 1142, 1142, 1142, 1142, 1142, 1142, 1142, 1142, 146, 146, 146, 146, 146, 146, 1143, 1143,
+		1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143,
+		1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143,
+		1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143,
+		1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143,
+		1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143,
+		1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143,
+		1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143,
+		1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539,
+		539, 539, 539, 146, 146, 146, 146, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539,
+		539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539,
+		539, 539, 539, 539, 539, 539, 146, 146, 146, 146, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144,
+		1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144,
+		1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144,
+		1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144,
+		1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144,
+		1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144,
+		1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145,
+		1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145,
+		1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145,
+		1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145,
+		1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145,
+		1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145,
+		1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146,
+		1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146,
+		1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146,
+		1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146,
+		1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146,
+		1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146,
+		1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146,
+		1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 990, 990, 1146, 990, 1146, 990, 990, 1146, 1146, 1146, 1146, 1146, 1146,
+		1146, 1146, 1146, 1146, 990, 1146, 990, 1146, 990, 990, 1146, 1146, 990, 990, 990, 1146, 1146, 1146, 1146, 1147, 1147, 1148,
+		1148, 1148, 1148, 1148, 1148, 1148, 1148, 1148, 1148, 1148, 1148, 1148, 1148, 1148, 1148, 1148, 1148, 1148, 1148, 1148, 1148,
+		1148, 1148, 1148, 1148, 1148, 1148, 1148, 1148, 1148, 1148, 1148, 1148, 1148, 1148, 1148, 1148, 1148, 1148, 1148, 1148, 1148,
+		1148, 1148, 1148, 1148, 1148, 1148, 1148, 1148, 1148, 1148, 1148, 1148, 1148, 1148, 1148, 1148, 1149, 1149, 1149, 146, 146,
+		1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150,
+		1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150,
+		1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150,
+		1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150,
+		1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150,
+		1150, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 51, 51, 51, 51, 51, 51, 51, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 1151, 1151, 1151, 1151, 1151, 146, 146, 146, 146, 146, 1152, 1153, 1154, 1154, 1154,
+		1154, 1154, 1154, 1154, 1154, 1154, 1154, 1155, 1154, 1154, 1154, 1154, 1154, 1154, 1154, 1154, 1154, 1154, 1154, 1154, 1154,
+		146, 1154, 1154, 1154, 1154, 1154, 146, 1154, 146, 1154, 1154, 146, 1154, 1154, 146, 1154, 1154, 1154, 1154, 1154, 1154,
+		1154, 1154, 1154, 1154, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+		261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+		261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+		261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+		261, 261, 261, 1156, 1156, 1156, 1156, 1156, 1156, 1156, 1156, 1156, 1156, 1156, 1156, 1156, 1156, 1156, 1156, 257, 257,
+		257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+		261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+		261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+		261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+		261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+		261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+		261, 261, 261, 261, 1157, 1157, 1157, 1157, 1157, 1157, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+		261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+		261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+		261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+		261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+		261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+		261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+		261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+		261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+		261, 261, 261, 261, 261, 1158, 1159, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 261,
+		261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+		261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+		261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 257, 257, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+		261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+		261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 257, 257, 257, 257, 257, 257,
+		257, 257, 1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
+		1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+		261, 1157, 1157, 1161, 253, 257, 257, 1162, 1162, 1162, 1162, 1162, 1162, 1162, 1162, 1162, 1162, 1162, 1162, 1162, 1162,
+		1162, 1162, 1163, 1163, 1163, 1164, 1163, 1163, 1163, 1165, 1166, 1163, 146, 146, 146, 146, 146, 146, 136, 136, 136, 136,
+		725, 725, 725, 650, 650, 650, 650, 650, 650, 650, 1167, 1167, 1168, 1169, 1169, 771, 771, 1170, 1171, 1170, 1171, 1170, 1171,
+		1170, 1171, 1170, 1171, 1170, 1171, 1172, 1173, 1172, 1173, 778, 778, 1174, 1175, 1168, 1168, 1168, 1168, 771, 771, 771,
+		149, 149, 1176, 146, 149, 1177, 1178, 1178, 1169, 1170, 1171, 1170, 1171, 1170, 1171, 1168, 1168, 1179, 790, 1180, 790, 790,
+		790, 146, 1179, 796, 1168, 1168, 146, 146, 146, 146, 1157, 261, 1157, 272, 1157, 257, 1157, 261, 1157, 261, 1157, 261, 1157,
+		261, 1157, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+		261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+		261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+		261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+		261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+		261, 261, 261, 261, 257, 257, 1181, 146, 1178, 1182, 1168, 796, 1168, 1168, 1183, 1170, 1171, 1168, 790, 149, 1169, 1176,
+		1168, 1184, 1184, 1184, 1184, 1184, 1184, 1184, 1184, 1184, 1184, 1177, 149, 790, 790, 790, 1178, 1168, 1185, 1185, 1185,
+		1185, 1185, 1185, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 1170, 1179, 1171, 1186,
+		771, 32, 1187, 1187, 1187, 1187, 1187, 1187, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+		43, 1170, 790, 1171, 790, 1188, 1189, 1178, 1172, 1173, 149, 1168, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190,
+		1190, 131, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190,
+		1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190,
+		1190, 1190, 1190, 1190, 1190, 1191, 1191, 540, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538,
+		538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 538, 146, 146, 146, 538, 538, 538, 538, 538, 538, 146,
+		146, 538, 538, 538, 538, 538, 538, 146, 146, 538, 538, 538, 538, 538, 538, 146, 146, 538, 538, 538, 146, 146, 146, 796, 796,
+		790, 32, 815, 796, 796, 146, 815, 790, 790, 790, 790, 815, 815, 146, 1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192,
+		1193, 1193, 1193, 1194, 1195, 1196, 1196, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 146, 1197,
+		1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197,
+		1197, 1197, 1197, 1197, 146, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197,
+		1197, 1197, 1197, 146, 1197, 1197, 146, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197,
+		1197, 146, 146, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197,
+		1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197,
+		1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197,
+		1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197,
+		1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197,
+		1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197,
+		1197, 146, 146, 146, 146, 146, 1198, 1198, 1198, 146, 146, 146, 146, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871,
+		871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871,
+		871, 871, 871, 871, 871, 871, 871, 871, 871, 146, 146, 146, 828, 828, 828, 828, 828, 828, 828, 828, 828, 1199, 1199, 1199,
+		1199, 1199, 1199, 1199, 1199, 1199, 1199, 1199, 1199, 1199, 1199, 1199, 1199, 1199, 1199, 1199, 1199, 1199, 1199, 1199, 1199,
+		1199, 1199, 1199, 1199, 1199, 1199, 1199, 1199, 1199, 1199, 1199, 1199, 1199, 1199, 1199, 1199, 1199, 1199, 1199, 1199, 1199,
+		1199, 1199, 1199, 1199, 1199, 1199, 1199, 1199, 1200, 1200, 1200, 1200, 1201, 1201, 1201, 1201, 1201, 1201, 1201, 1201, 1201,
+		1201, 1201, 1201, 1201, 1201, 1201, 1201, 1201, 1200, 1202, 1203, 1204, 1204, 146, 838, 838, 838, 838, 838, 838, 838, 838,
+		838, 838, 838, 838, 146, 146, 146, 146, 1203, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838,
+		838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838,
+		838, 838, 726, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 1205, 1205, 1205, 1205, 1205, 1205, 1205, 1205, 1205, 1205, 1205, 1205, 1205, 1205,
+		1205, 1205, 1205, 1205, 1205, 1205, 1205, 1205, 1205, 1205, 1205, 1205, 1205, 1205, 1205, 1206, 1206, 1206, 1207, 1207, 1207,
+		1207, 1207, 1207, 1207, 1207, 1207, 1207, 1207, 1207, 1207, 1207, 1207, 1207, 1207, 1207, 1207, 1207, 1207, 1207, 1207, 1207,
+		1207, 1207, 1207, 1207, 1207, 1207, 1207, 1207, 1207, 1207, 1207, 1207, 1207, 1207, 1207, 1207, 1207, 1207, 1207, 1207, 1207,
+		1207, 1207, 1207, 1207, 1208, 1208, 1208, 1208, 1208, 1208, 1208, 1208, 1208, 1208, 1208, 1208, 1208, 1208, 1208, 1209, 1210,
+		1210, 1210, 1210, 1210, 1210, 1210, 1210, 1210, 1210, 1210, 1210, 1210, 1210, 1210, 1210, 1210, 1210, 1210, 1210, 1210, 1210,
+		1210, 1210, 1210, 1210, 1210, 918, 918, 918, 918, 1211, 1211, 1211, 1211, 1211, 1211, 1211, 1211, 1211, 1211, 1211, 1211,
+		1211, 1211, 1211, 1211, 1211, 1211, 1211, 1211, 1211, 1211, 1211, 1211, 1211, 1211, 1211, 1211, 1211, 1211, 1211, 1212, 1213,
+		1213, 1213, 1213, 146, 146, 146, 146, 146, 146, 146, 146, 146, 1214, 1214, 1214, 1215, 1215, 1215, 1215, 1215, 1215, 1215,
+		1215, 1215, 1215, 1215, 1215, 1215, 1215, 1215, 1215, 1215, 1216, 1215, 1215, 1215, 1215, 1215, 1215, 1215, 1215, 1216, 1217,
+		1217, 1217, 1217, 1217, 1218, 1218, 1218, 1218, 1218, 1218, 1218, 1218, 1218, 1218, 1218, 1218, 1218, 1218, 1218, 1218, 1218,
+		1218, 1218, 1218, 1218, 1218, 1218, 1218, 1218, 1218, 1218, 1218, 1218, 1218, 1218, 1218, 1218, 1218, 1218, 1218, 1218, 1218,
+		1219, 1219, 1219, 1219, 1219, 146, 146, 146, 146, 146, 1220, 1220, 1220, 1220, 1220, 1220, 1220, 1220, 1220, 1220, 1220,
+		1220, 1220, 1220, 1220, 1220, 1220, 1220, 1220, 1220, 1220, 1220, 1220, 1220, 1220, 1220, 1220, 1220, 1220, 1220, 1221, 1222,
+		1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223,
+		1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223, 146, 146, 146, 146, 1223, 1223,
+		1223, 1223, 1223, 1223, 1223, 1223, 1224, 1225, 1225, 1225, 1225, 1225, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 1226, 1226, 1226, 1226, 1226, 1226, 1226, 1226, 1226, 1226, 1226, 1226, 1226, 1226, 1226,
+		1226, 1226, 1226, 1226, 1226, 1226, 1226, 1226, 1226, 1226, 1226, 1226, 1226, 1226, 1226, 1226, 1226, 1226, 1226, 1226, 1226,
+		1226, 1226, 1227, 1227, 1228, 1228, 1228, 1228, 1228, 1228, 1228, 1228, 1228, 1228, 1228, 1228, 1228, 1228, 1228, 1228, 1228,
+		1228, 1228, 1228, 1228, 1228, 1228, 1228, 1228, 1228, 1228, 1228, 1228, 1228, 1228, 1228, 1228, 1228, 1228, 1228, 1228, 1228,
+		1229, 1229, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230,
+		1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230,
+		1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1231, 1231, 1231, 1231, 1231, 1231, 1231, 1231, 1231, 1231, 1231, 1231, 1231,
+		1231, 1231, 1231, 1231, 1231, 1231, 1231, 1231, 1231, 1231, 1231, 1231, 1231, 1231, 1231, 1231, 1231, 1232, 1232, 1233, 1233,
+		1233, 1233, 1233, 1233, 1233, 1233, 1233, 1233, 1232, 1232, 1232, 1232, 1232, 1232, 1234, 1234, 1234, 1234, 1234, 1234, 1234,
+		1234, 1234, 1234, 1234, 1234, 1234, 1234, 1234, 1234, 1234, 1234, 1234, 1234, 1234, 1234, 1234, 1234, 1234, 1234, 1234, 1234,
+		1234, 1234, 1234, 1234, 1234, 1234, 1234, 1234, 1235, 1235, 1235, 1235, 1236, 1236, 1236, 1236, 1236, 1236, 1236, 1236, 1236,
+		1236, 1236, 1236, 1236, 1236, 1236, 1236, 1236, 1236, 1236, 1236, 1236, 1236, 1236, 1236, 1236, 1236, 1236, 1236, 1236, 1236,
+		1236, 1236, 1236, 1236, 1236, 1236, 1235, 1235, 1235, 1235, 1237, 1237, 1237, 1237, 1237, 1237, 1237, 1237, 1237, 1237, 1237,
+		1237, 1237, 1237, 1237, 1237, 1237, 1237, 1237, 1237, 1237, 1237, 1237, 1237, 1237, 1237, 1237, 1237, 1237, 1237, 1237, 1237,
+		1237, 1237, 1237, 1237, 1237, 1237, 1237, 1237, 1238, 1238, 1238, 1238, 1238, 1238, 1238, 1238, 1239, 1239, 1239, 1239, 1239,
+		1239, 1239, 1239, 1239, 1239, 1239, 1239, 1239, 1239, 1239, 1239, 1239, 1239, 1239, 1239, 1239, 1239, 1239, 1239, 1239, 1239,
+		1239, 1239, 1239, 1239, 1239, 1239, 1239, 1239, 1239, 1239, 1239, 1239, 1239, 1239, 1239, 1239, 1239, 1239, 1239, 1239, 1239,
+		1239, 1239, 1239, 1239, 1239, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 1240, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241,
+		1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241,
+		1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241,
+		1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241,
+		1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241,
+		1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241,
+		1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241,
+		1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241,
+		1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241,
+		1241, 1241, 1241, 146, 146, 146, 146, 146, 146, 146, 146, 146, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241,
+		1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 1242, 1242, 1242, 1242, 1242, 1242, 146, 146, 1242, 146, 1242, 1242, 1242, 1242,
+		1242, 1242, 1242, 1242, 1242, 1242, 1242, 1242, 1242, 1242, 1242, 1242, 1242, 1242, 1242, 1242, 1242, 1242, 1242, 1242, 1242,
+		1242, 1242, 1242, 1242, 1242, 1242, 1242, 1242, 1242, 1242, 1242, 1242, 1242, 1242, 1242, 1242, 1242, 1242, 1242, 146, 1242,
+		1242, 146, 146, 146, 1242, 146, 146, 1242, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243,
+		1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 146, 1244, 1245, 1245, 1245, 1245, 1245, 1245, 1245, 1245, 1246, 1246,
+		1246, 1246, 1246, 1246, 1246, 1246, 1246, 1246, 1246, 1246, 1246, 1246, 1246, 1246, 1246, 1246, 1246, 1246, 1246, 1246, 1246,
+		1247, 1247, 1248, 1248, 1248, 1248, 1248, 1248, 1248, 1249, 1249, 1249, 1249, 1249, 1249, 1249, 1249, 1249, 1249, 1249, 1249,
+		1249, 1249, 1249, 1249, 1249, 1249, 1249, 1249, 1249, 1249, 1249, 1249, 1249, 1249, 1249, 1249, 1249, 1249, 1249, 1250, 1250,
+		1250, 1250, 1250, 1250, 1250, 1250, 1251, 1251, 1251, 1251, 1251, 1251, 1251, 1251, 1251, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 1252, 1252, 1252, 1252, 1252, 1252, 1252,
+		1252, 1252, 1252, 1252, 1252, 1252, 1252, 1252, 1252, 1252, 1252, 1252, 1253, 1252, 1252, 1253, 1253, 1253, 1253, 1253, 1254,
+		1254, 1254, 1254, 1254, 1255, 1255, 1255, 1255, 1255, 1255, 1255, 1255, 1255, 1255, 1255, 1255, 1255, 1255, 1255, 1255, 1255,
+		1255, 1255, 1255, 1255, 1255, 1256, 1256, 1256, 1256, 1257, 1257, 1258, 1258, 1258, 1259, 1260, 1260, 1260, 1260, 1260, 1260,
+		1260, 1260, 1260, 1260, 1260, 1260, 1260, 1260, 1260, 1260, 1260, 1260, 1260, 1260, 1260, 1260, 1260, 1260, 1260, 1260, 1261,
+		1261, 1261, 1261, 1261, 1262, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 1263, 1263, 1263, 1263,
+		1263, 1263, 1263, 1263, 1263, 1263, 1263, 1263, 1263, 1263, 1263, 1263, 1263, 1263, 1263, 1263, 1263, 1263, 1263, 1263, 1263,
+		1263, 1263, 1263, 1263, 1263, 1263, 1263, 1264, 1264, 1264, 1264, 1264, 1264, 1264, 1264, 1264, 1264, 1264, 1264, 1264, 1264,
+		1264, 1264, 1264, 1264, 1264, 1264, 1264, 1264, 1264, 1264, 146, 146, 146, 146, 1265, 1265, 1264, 1264, 1265, 1265, 1265,
+		1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 146, 146, 1265, 1265, 1265, 1265, 1265, 1265,
+		1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265,
+		1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1266, 1267,
+		1267, 1267, 1268, 1267, 1267, 1268, 1268, 1268, 1268, 1268, 1267, 1267, 1267, 1267, 1266, 1266, 1266, 1266, 1268, 1266, 1266,
+		1266, 1268, 1266, 1266, 1266, 1266, 1266, 1266, 1266, 1266, 1266, 1266, 1266, 1266, 1266, 1266, 1266, 1266, 1266, 1266, 1266,
+		1266, 1266, 1266, 1266, 1266, 1266, 1266, 1266, 1268, 1268, 1268, 1268, 1269, 1269, 1269, 1268, 1268, 1268, 1268, 1269, 1270,
+		1270, 1270, 1270, 1270, 1270, 1270, 1270, 1268, 1268, 1268, 1268, 1268, 1268, 1268, 1268, 1271, 1271, 1271, 1271, 1271, 1271,
+		1272, 1272, 1271, 1268, 1268, 1268, 1268, 1268, 1268, 1268, 1273, 1273, 1273, 1273, 1273, 1273, 1273, 1273, 1273, 1273, 1273,
+		1273, 1273, 1273, 1273, 1273, 1273, 1273, 1273, 1273, 1273, 1273, 1273, 1273, 1273, 1273, 1273, 1273, 1273, 1274, 1274, 1275,
+		1276, 1276, 1276, 1276, 1276, 1276, 1276, 1276, 1276, 1276, 1276, 1276, 1276, 1276, 1276, 1276, 1276, 1276, 1276, 1276, 1276,
+		1276, 1276, 1276, 1276, 1276, 1276, 1276, 1276, 1277, 1277, 1277, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 1278, 1278, 1278,
+		1278, 1278, 1278, 1278, 1278, 1279, 1278, 1278, 1278, 1278, 1278, 1278, 1278, 1278, 1278, 1278, 1278, 1278, 1278, 1278, 1278,
+		1278, 1278, 1278, 1278, 1278, 1278, 1278, 1278, 1278, 1278, 1278, 1278, 1278, 1280, 1280, 1281, 1281, 1281, 1281, 1282, 1282,
+		1282, 1282, 1282, 1283, 1283, 1283, 1283, 1283, 1283, 1284, 1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281, 1285, 1285,
+		1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285,
+		1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285,
+		1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1286, 1286, 1286, 1287, 1288, 1288, 1288, 1288, 1288, 1288, 1289,
+		1289, 1289, 1289, 1289, 1289, 1289, 1289, 1289, 1289, 1289, 1289, 1289, 1289, 1289, 1289, 1289, 1289, 1289, 1289, 1289, 1289,
+		146, 146, 1290, 1290, 1290, 1290, 1290, 1290, 1290, 1290, 1291, 1291, 1291, 1291, 1291, 1291, 1291, 1291, 1291, 1291, 1291,
+		1291, 1291, 1291, 1291, 1291, 1291, 1291, 1291, 146, 146, 146, 146, 146, 1292, 1292, 1292, 1292, 1292, 1292, 1292, 1292,
+		1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 146, 146, 146,
+		146, 146, 146, 146, 1294, 1294, 1294, 1294, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 1295, 1295, 1295,
+		1295, 1295, 1295, 1295, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296,
+		1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296,
+		1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296,
+		1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297,
+		1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297,
+		1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
+		1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
+		1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 146, 146, 146, 146, 146, 146, 146, 1299, 1299, 1299,
+		1299, 1299, 1299, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		1300, 1300, 1300, 1300, 1300, 1300, 1300, 1300, 1300, 1300, 1300, 1300, 1300, 1300, 1300, 1300, 1300, 1300, 1300, 1300, 1300,
+		1300, 1300, 1300, 1300, 1300, 1300, 1300, 1300, 1300, 1300, 146, 1301, 1302, 1301, 1303, 1303, 1303, 1303, 1303, 1303, 1303,
+		1303, 1303, 1303, 1303, 1303, 1303, 1303, 1303, 1303, 1303, 1303, 1303, 1303, 1303, 1303, 1303, 1303, 1303, 1303, 1303, 1303,
+		1303, 1303, 1303, 1303, 1303, 1303, 1303, 1303, 1303, 1303, 1303, 1303, 1303, 1303, 1303, 1303, 1303, 1303, 1303, 1303, 1303,
+		1303, 1303, 1303, 1303, 1302, 1302, 1302, 1302, 1302, 1302, 1302, 1302, 1302, 1302, 1302, 1302, 1302, 1302, 1304, 1305, 1305,
+		1306, 1306, 1306, 1306, 1306, 1307, 1307, 1307, 1307, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308,
+		1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1309, 1309, 1309, 1309, 1309, 1309, 1309, 1309, 1309, 1309, 1307, 1307, 1307,
+		1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307, 1310, 1311, 1311, 1312, 1313, 1313, 1313, 1313, 1313,
+		1313, 1313, 1313, 1313, 1313, 1313, 1313, 1313, 1313, 1313, 1313, 1313, 1313, 1313, 1313, 1313, 1313, 1313, 1313, 1313, 1313,
+		1313, 1313, 1313, 1313, 1313, 1313, 1313, 1313, 1313, 1313, 1313, 1313, 1313, 1313, 1313, 1313, 1313, 1313, 1313, 1312, 1312,
+		1312, 1314, 1314, 1314, 1314, 1312, 1312, 1315, 1315, 1316, 1316, 1317, 1318, 1318, 1318, 1318, 1319, 1319, 1319, 1319, 1319,
+		1319, 1319, 1319, 1319, 1319, 1319, 1319, 1319, 1319, 1320, 1320, 1320, 1320, 1320, 1320, 1320, 1320, 1320, 1320, 1320, 1320,
+		1320, 1320, 1320, 1320, 1320, 1320, 1320, 1320, 1320, 1320, 1320, 1320, 1320, 146, 146, 146, 146, 146, 146, 146, 1321, 1321,
+		1321, 1321, 1321, 1321, 1321, 1321, 1321, 1321, 146, 146, 146, 146, 146, 146, 1322, 1322, 1322, 1323, 1323, 1323, 1323, 1323,
+		1323, 1323, 1323, 1323, 1323, 1323, 1323, 1323, 1323, 1323, 1323, 1323, 1323, 1323, 1323, 1323, 1323, 1323, 1323, 1323, 1323,
+		1323, 1323, 1323, 1323, 1323, 1323, 1323, 1323, 1323, 1323, 1322, 1322, 1322, 1322, 1322, 1324, 1322, 1322, 1322, 1322, 1322,
+		1322, 1325, 1325, 1326, 1327, 1327, 1327, 1327, 1327, 1327, 1327, 1327, 1327, 1327, 1328, 1329, 1329, 1329, 1326, 1326, 1326,
+		1326, 1326, 1326, 1326, 1326, 1326, 1326, 1326, 1326, 1330, 1330, 1330, 1330, 1330, 1330, 1330, 1330, 1330, 1330, 1330, 1330,
+		1330, 1330, 1330, 1330, 1330, 1330, 1330, 1330, 1330, 1330, 1330, 1330, 1330, 1330, 1330, 1330, 1330, 1330, 1330, 1330, 1330,
+		1330, 1330, 1331, 1332, 1332, 1330, 1333, 1333, 1333, 1333, 1333, 1333, 1333, 1333, 1333, 1334, 1334, 1335, 1336, 1336, 1336,
+		1336, 1336, 1336, 1336, 1336, 1336, 1336, 1336, 1336, 1336, 1336, 1336, 1336, 1336, 1336, 1336, 1336, 1336, 1336, 1336, 1336,
+		1336, 1336, 1336, 1336, 1336, 1336, 1336, 1336, 1336, 1336, 1336, 1336, 1336, 1336, 1336, 1336, 1336, 1336, 1336, 1336, 1336,
+		1336, 1336, 1336, 1335, 1335, 1335, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1335, 1337, 1336, 1336, 1336, 1336,
+		1338, 1338, 1339, 1339, 1340, 1341, 1341, 1341, 1342, 1343, 1343, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
+		1345, 1340, 1346, 1340, 1347, 1347, 458, 1348, 1348, 1348, 1348, 1348, 1348, 1348, 1348, 1348, 1348, 1348, 1348, 1348, 1348,
+		1348, 1348, 1348, 1348, 1348, 1348, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 1349, 1349, 1349, 1349, 1349,
+		1349, 1349, 1349, 1349, 1349, 1349, 1349, 1349, 1349, 1349, 1349, 1349, 1349, 1350, 1349, 1349, 1349, 1349, 1349, 1349, 1349,
+		1349, 1349, 1349, 1349, 1349, 1349, 1349, 1349, 1349, 1349, 1349, 1349, 1349, 1349, 1349, 1349, 1349, 1349, 1351, 1351, 1351,
+		1352, 1352, 1352, 1351, 1351, 1352, 1353, 1354, 1352, 1355, 1355, 1356, 1355, 1355, 1357, 1358, 1350, 1350, 1350, 1350, 1350,
+		1350, 1350, 1350, 1350, 1350, 1350, 1350, 1350, 1350, 1350, 1350, 1350, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 1359, 1359, 1359, 1359, 1359, 1359, 1359, 1360, 1359, 1360,
+		1359, 1359, 1359, 1359, 1360, 1359, 1359, 1359, 1359, 1359, 1359, 1359, 1359, 1359, 1359, 1359, 1359, 1359, 1359, 1359, 1360,
+		1359, 1359, 1359, 1359, 1359, 1359, 1359, 1359, 1359, 1359, 1361, 1360, 1360, 1360, 1360, 1360, 1360, 1362, 1362, 1362, 1362,
+		1362, 1362, 1362, 1362, 1362, 1362, 1362, 1362, 1362, 1362, 1362, 1362, 1362, 1362, 1362, 1362, 1362, 1362, 1362, 1362, 1362,
+		1362, 1362, 1362, 1362, 1362, 1362, 1362, 1362, 1362, 1362, 1362, 1362, 1362, 1362, 1362, 1362, 1362, 1362, 1362, 1362, 1362,
+		1362, 1363, 1364, 1364, 1364, 1363, 1363, 1363, 1363, 1363, 1363, 1365, 1365, 1366, 1366, 1366, 1366, 1366, 1367, 1367, 1367,
+		1367, 1367, 1367, 1367, 1367, 1367, 1367, 1366, 1366, 1366, 1366, 1366, 1366, 1368, 1369, 1370, 1370, 1371, 1372, 1372, 1372,
+		1372, 1372, 1372, 1372, 1372, 1371, 1371, 1372, 1372, 1371, 1371, 1372, 1372, 1372, 1372, 1372, 1372, 1372, 1372, 1372, 1372,
+		1372, 1372, 1372, 1372, 1372, 1372, 1372, 1372, 1372, 1372, 1372, 1372, 1371, 1372, 1372, 1372, 1372, 1372, 1372, 1372, 1371,
+		1372, 1372, 1371, 1372, 1372, 1372, 1372, 1372, 1371, 1371, 1373, 1372, 1374, 1370, 1369, 1370, 1370, 1370, 1370, 1371, 1371,
+		1370, 1370, 1371, 1371, 1370, 1370, 1375, 1371, 1371, 1376, 1371, 1371, 1371, 1371, 1371, 1371, 1374, 1371, 1371, 1371, 1371,
+		1371, 1377, 1372, 1372, 1372, 1372, 1370, 1370, 1371, 1371, 1373, 1373, 1373, 1373, 1373, 1373, 1373, 1371, 1371, 1371, 1373,
+		1373, 1373, 1373, 1373, 1371, 1371, 1371, 1371, 1371, 1371, 1371, 1371, 1371, 1371, 1371, 1378, 1378, 1378, 1378, 1378, 1378,
+		1378, 1378, 1378, 1378, 1378, 1378, 1378, 1378, 1378, 1378, 1378, 1378, 1378, 1378, 1378, 1378, 1378, 1378, 1378, 1378, 1378,
+		1378, 1378, 1378, 1378, 1378, 1378, 1378, 1378, 1378, 1378, 1378, 1378, 1378, 1378, 1378, 1378, 1378, 1378, 1378, 1378, 1378,
+		1378, 1378, 1378, 1378, 1378, 1379, 1379, 1379, 1380, 1380, 1380, 1380, 1380, 1380, 1380, 1380, 1379, 1379, 1381, 1380, 1380,
+		1379, 1381, 1378, 1378, 1378, 1378, 1382, 1382, 1383, 1384, 1384, 1385, 1385, 1385, 1385, 1385, 1385, 1385, 1385, 1385, 1385,
+		1386, 1383, 1386, 1384, 1386, 1386, 1386, 1386, 1386, 1386, 1386, 1386, 1386, 1386, 1386, 1386, 1386, 1386, 1386, 1386, 1386,
+		1386, 1386, 1386, 1386, 1386, 1386, 1386, 1386, 1386, 1386, 1386, 1386, 1386, 1386, 1386, 1386, 1386, 1387, 1387, 1387, 1387,
+		1387, 1387, 1387, 1387, 1387, 1387, 1387, 1387, 1387, 1387, 1387, 1387, 1387, 1387, 1387, 1387, 1387, 1387, 1387, 1387, 1387,
+		1387, 1387, 1387, 1387, 1387, 1387, 1387, 1387, 1387, 1387, 1387, 1387, 1387, 1387, 1387, 1387, 1387, 1387, 1387, 1387, 1387,
+		1387, 1387, 1388, 1389, 1389, 1390, 1390, 1390, 1390, 1390, 1390, 1389, 1390, 1389, 1389, 1388, 1389, 1390, 1390, 1389, 1391,
+		1391, 1387, 1387, 1392, 1387, 1393, 1393, 1393, 1393, 1393, 1393, 1393, 1393, 1394, 1394, 1394, 1394, 1394, 1394, 1394, 1394,
+		1394, 1394, 1393, 1393, 1393, 1393, 1393, 1393, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 1395, 1395, 1395, 1395, 1395, 1395,
+		1395, 1395, 1395, 1395, 1395, 1395, 1395, 1395, 1395, 1395, 1395, 1395, 1395, 1395, 1395, 1395, 1395, 1395, 1395, 1395, 1395,
+		1395, 1395, 1395, 1395, 1395, 1395, 1395, 1395, 1395, 1395, 1395, 1395, 1395, 1395, 1395, 1395, 1395, 1395, 1395, 1395, 1396,
+		1397, 1397, 1398, 1398, 1398, 1398, 1399, 1399, 1397, 1397, 1397, 1397, 1398, 1398, 1397, 1400, 1400, 1401, 1402, 1402, 1403,
+		1403, 1404, 1404, 1404, 1402, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1406, 1406,
+		1406, 1406, 1407, 1407, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399,
+		1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1399, 1408, 1408, 1408, 1408,
+		1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408,
+		1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408,
+		1408, 1408, 1409, 1409, 1409, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1409, 1409, 1410, 1409, 1411, 1410, 1412, 1412,
+		1413, 1408, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415,
+		1415, 1415, 1414, 1414, 1414, 1414, 1414, 1414, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416,
+		612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 612, 1417, 1417, 1417, 1417, 1417,
+		1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417,
+		1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1418, 1419, 1418, 1419,
+		1419, 1418, 1418, 1418, 1418, 1418, 1418, 1420, 1421, 1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422, 1423, 1423, 1423, 1423,
+		1423, 1423, 1423, 1423, 1423, 1423, 1422, 1422, 1422, 1422, 1422, 1422, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424,
+		1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1425, 1425, 1425, 1426, 1426,
+		1426, 1427, 1427, 1426, 1426, 1426, 1426, 1427, 1426, 1426, 1426, 1426, 1428, 1425, 1425, 1425, 1425, 1429, 1429, 1429, 1429,
+		1429, 1429, 1429, 1429, 1429, 1429, 1430, 1430, 1431, 1431, 1431, 1432, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433,
+		1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433,
+		1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434,
+		1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435,
+		1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 1437, 1438,
+		1439, 1439, 1439, 1439, 1439, 1439, 1440, 1440, 1439, 1439, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438,
+		1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438,
+		1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1441, 1442, 1439, 1439, 1439, 1439, 1440, 1438, 1439, 1439, 1439, 1439, 1443,
+		1443, 1443, 1444, 1444, 1443, 1443, 1443, 1442, 146, 146, 146, 146, 146, 146, 146, 146, 1445, 1446, 1446, 1446, 1446, 1446,
+		1446, 1447, 1447, 1446, 1446, 1446, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445,
+		1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445,
+		1445, 1445, 1445, 1445, 1448, 1448, 1445, 1445, 1445, 1445, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446,
+		1446, 1446, 1447, 1449, 1450, 1451, 1452, 1452, 1448, 1451, 1451, 1451, 1453, 1453, 1448, 1448, 1448, 1448, 1448, 1448, 1448,
+		1448, 1448, 1448, 1448, 1448, 1448, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 1454,
+		1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454,
+		1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454,
+		1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 146, 146, 146, 146, 146, 146, 146, 1455,
+		1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1456, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455,
+		1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455,
+		1455, 1455, 1455, 1455, 1457, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1456, 1458, 1458, 1458, 1458, 1458, 1458, 1457, 1459,
+		1455, 1460, 1460, 1461, 1462, 1462, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1463, 1463, 1463, 1463, 1463,
+		1463, 1463, 1463, 1463, 1463, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464,
+		1464, 1464, 1464, 1456, 1456, 1456, 1465, 1466, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467,
+		1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1468, 1468, 1469, 1469,
+		1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1468,
+		1470, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1470, 1469, 1469, 1470, 1469, 1469, 1468, 1468, 1468, 1468, 1468, 1468, 1468,
+		1468, 1468, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 1471, 1471, 1471, 1471, 1471, 1471,
+		1471, 146, 1471, 1471, 146, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471,
+		1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471,
+		1471, 1472, 1472, 1472, 1472, 1472, 1472, 146, 146, 146, 1472, 146, 1472, 1472, 146, 1472, 1472, 1472, 1473, 1472, 1473,
+		1473, 1471, 1472, 146, 146, 146, 146, 146, 146, 146, 146, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475,
+		1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475,
+		1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475,
+		1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475,
+		1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475,
+		1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475,
+		1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475,
+		1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475,
+		1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475,
+		1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475,
+		1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475,
+		1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1476, 1476, 1476,
+		1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476,
+		1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1477, 1478, 1478,
+		1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478,
+		1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478,
+		1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478,
+		1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478,
+		1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1479, 1479, 1479, 1479, 1479,
+		1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
+		1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
+		1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
+		1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
+		1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480,
+		1480, 1478, 1481, 1481, 1481, 1481, 1482, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1483, 1483, 1483,
+		1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483,
+		1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483,
+		1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483,
+		1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483,
+		1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483,
+		1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483,
+		1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483,
+		1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483,
+		1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483,
+		1483, 1483, 1483, 1483, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484,
+		1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484,
+		1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484,
+		1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484,
+		1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484,
+		1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484,
+		1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484,
+		1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484,
+		1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485,
+		1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485,
+		1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485,
+		1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485,
+		1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485,
+		1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485,
+		1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485,
+		1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485,
+		1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485,
+		1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486,
+		1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486,
+		1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486,
+		1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486,
+		1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486,
+		1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486,
+		1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486,
+		1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486,
+		1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1024, 1024, 1024, 1024,
+		1024, 1024, 1024, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487,
+		1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1488, 1489, 1489, 1489, 1489, 1489, 1489, 1489,
+		1489, 1489, 1489, 1488, 1488, 1488, 1488, 1490, 1490, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491,
+		1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 146, 146, 1492, 1492, 1492, 1492,
+		1492, 1493, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494,
+		1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494,
+		1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1495, 1495, 1495, 1495,
+		1495, 1495, 1495, 1496, 1496, 1497, 1498, 1498, 1499, 1499, 1499, 1499, 1500, 1500, 1501, 1501, 1496, 1499, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 146, 1503, 1503, 1503, 1503,
+		1503, 1503, 1503, 146, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494,
+		1494, 1494, 1494, 1494, 146, 146, 146, 146, 146, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494,
+		1494, 1494, 1494, 1494, 1494, 1494, 1494, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 1504, 1504, 1504,
+		1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
+		1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
+		1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
+		1504, 1504, 1504, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1504, 1506, 1506, 1506, 1506, 1506, 1506,
+		1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506,
+		1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1505, 1505,
+		1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1507, 1507, 1507, 1507, 1508, 1508, 1508,
+		1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 1509, 1510, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511,
+		1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511,
+		1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511,
+		1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511,
+		1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511,
+		1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511,
+		1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511,
+		1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511,
+		1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511,
+		1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511,
+		1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511,
+		1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1512, 1512, 1512, 1512, 1512, 1512, 1512,
+		1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511,
+		1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511,
+		1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511,
+		1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511,
+		1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511,
+		1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511,
+		1511, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1513, 1514, 1515, 1515, 1515, 1515, 1515,
+		1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515,
+		1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515,
+		1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515,
+		1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515,
+		1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515,
+		1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515,
+		1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515,
+		1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515,
+		1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515,
+		1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515,
+		1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515,
+		1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515,
+		1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515,
+		1515, 1515, 1515, 1515, 1515, 1515, 1515, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516,
+		1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516,
+		1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516,
+		1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516,
+		1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516,
+		1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516,
+		1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516,
+		1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516,
+		1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516,
+		1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516,
+		1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516,
+		1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516,
+		1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516,
+		1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1517, 1517, 1517, 1517, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+		1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+		1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+		1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+		1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+		1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1519, 1519, 1519, 1519, 1519, 1518, 1518,
+		1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1519, 1519, 1519, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+		1518, 1518, 1519, 1519, 1519, 1519, 1519, 1519, 1519, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1519, 1519,
+		1520, 1521, 1522, 1523, 1524, 1524, 1524, 1524, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525,
+		1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525,
+		1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525,
+		1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525,
+		1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525,
+		1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525,
+		1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525,
+		1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525,
+		1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525,
+		1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525,
+		1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525,
+		1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525,
+		1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525,
+		1525, 1525, 146, 146, 838, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525,
+		1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525,
+		1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525,
+		1525, 1526, 1527, 1528, 1528, 1528, 1525, 1525, 1525, 1529, 1530, 1530, 1530, 1530, 1530, 1531, 1531, 1531, 1531, 1531, 1531,
+		1531, 1531, 1528, 1528, 1528, 1528, 1528, 1528, 1528, 1528, 1525, 1525, 1528, 1528, 1528, 1528, 1528, 1528, 1528, 1525, 1525,
+		1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525,
+		1525, 1525, 1525, 1525, 1525, 1525, 1525, 1528, 1528, 1528, 1528, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525,
+		1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525,
+		1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 844, 844, 844, 844,
+		844, 844, 844, 844, 844, 844, 844, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 1201, 1201, 1201, 1201, 1201, 1201, 1201, 1201, 1201, 1201, 1201, 1201, 1201, 1201, 1201, 1201,
+		1201, 1201, 1201, 1201, 1201, 1201, 1201, 1201, 1201, 1201, 1201, 1201, 1201, 1201, 1201, 1201, 1201, 1201, 1201, 1201, 1201,
+		1201, 1201, 1201, 1201, 1201, 1201, 1201, 1201, 1201, 1201, 1201, 1201, 1201, 1201, 1201, 1201, 1201, 1201, 1201, 1201, 1201,
+		1201, 1201, 1201, 1201, 1201, 1201, 1201, 1201, 1532, 1532, 1532, 1201, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 828, 828,
+		828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828,
+		828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828,
+		828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 828,
+		828, 828, 828, 828, 828, 828, 828, 828, 828, 828, 146, 146, 146, 146, 146, 146, 146, 146, 146, 1533, 1533, 1533, 1533, 1533,
+		1533, 1533, 1533, 1533, 1533, 1533, 1533, 1533, 1533, 1533, 1533, 1533, 1533, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534,
+		1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1536, 1536, 1535,
+		1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1534, 1534, 1534, 1534, 1534, 1534,
+		1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1535,
+		1535, 1535, 1535, 1535, 1535, 1535, 146, 1536, 1536, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535,
+		1535, 1535, 1535, 1535, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534,
+		1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1536, 1536, 1535, 1535,
+		1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1534, 146, 1534, 1534, 146, 146, 1534,
+		146, 146, 1534, 1534, 146, 146, 1534, 1534, 1534, 1534, 146, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1535, 1535,
+		1535, 1535, 146, 1535, 146, 1535, 1536, 1536, 1535, 1537, 1535, 1535, 146, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535,
+		1535, 1535, 1535, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534,
+		1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1536, 1536, 1535, 1535, 1535,
+		1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1534, 1534, 146, 1534, 1534, 1534, 1534, 146,
+		146, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 146, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 146, 1535, 1535, 1535,
+		1535, 1535, 1535, 1535, 1535, 1536, 1536, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535,
+		1535, 1535, 1534, 1534, 146, 1534, 1534, 1534, 1534, 146, 1534, 1534, 1534, 1534, 1534, 146, 1534, 146, 146, 146, 1534, 1534,
+		1534, 1534, 1534, 1534, 1534, 146, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1536, 1536, 1535, 1535, 1535, 1535, 1535,
+		1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534,
+		1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1535, 1535, 1535, 1535, 1535,
+		1535, 1535, 1535, 1536, 1536, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535,
+		1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534,
+		1534, 1534, 1534, 1534, 1534, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1536, 1536, 1535, 1535, 1535, 1535, 1535, 1535,
+		1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534,
+		1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1535, 1535, 1535, 1535, 1535, 1535,
+		1535, 1535, 1536, 1536, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1534,
+		1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534,
+		1534, 1534, 1534, 1534, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1536, 1536, 1535, 1535, 1535, 1535, 1535, 1535, 1535,
+		1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534,
+		1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1535, 1535, 1535, 1535, 1535, 1535, 1535,
+		1535, 1536, 1536, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1534, 1534,
+		1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534,
+		1534, 1534, 1534, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1536, 1536, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535,
+		1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 829, 829, 146, 146, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534,
+		1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1538, 1535, 1535, 1535, 1535,
+		1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535,
+		1538, 1535, 1535, 1535, 1535, 1535, 1535, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534,
+		1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1538, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535,
+		1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1538, 1535, 1535, 1535, 1535,
+		1535, 1535, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534,
+		1534, 1534, 1534, 1534, 1534, 1534, 1538, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535,
+		1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1538, 1535, 1535, 1535, 1535, 1535, 1535, 1534, 1534, 1534,
+		1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534,
+		1534, 1538, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535,
+		1535, 1535, 1535, 1535, 1535, 1535, 1538, 1535, 1535, 1535, 1535, 1535, 1535, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534,
+		1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1538, 1535, 1535, 1535,
+		1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535,
+		1535, 1538, 1535, 1535, 1535, 1535, 1535, 1535, 1539, 1540, 146, 146, 1541, 1541, 1541, 1541, 1541, 1541, 1541, 1541, 1541,
+		1541, 1541, 1541, 1541, 1541, 1541, 1541, 1541, 1541, 1541, 1541, 1541, 1541, 1541, 1541, 1541, 1541, 1541, 1541, 1541, 1541,
+		1541, 1541, 1541, 1541, 1541, 1541, 1541, 1541, 1541, 1541, 1541, 1541, 1541, 1541, 1541, 1541, 1541, 1541, 1541, 1541, 1542,
+		1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542,
+		1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542,
+		1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542,
+		1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542,
+		1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542,
+		1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542,
+		1542, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543,
+		1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543,
+		1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1542, 1542, 1542, 1542, 1543, 1543, 1543,
+		1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543,
+		1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543,
+		1543, 1543, 1543, 1543, 1543, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1543, 1542, 1542, 1542, 1542, 1542, 1542, 1542,
+		1542, 1542, 1542, 1542, 1542, 1542, 1542, 1543, 1542, 1542, 1544, 1545, 1544, 1544, 1546, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 1543, 1543, 1543, 1543, 1543, 146, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543,
+		1543, 1543, 1543, 1543, 1543, 1543, 1543, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 894, 1547,
+		1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 894, 894, 1547, 1547, 1547,
+		1547, 1547, 1547, 1547, 894, 1547, 1547, 894, 1547, 1547, 1547, 1547, 1547, 894, 894, 894, 894, 894, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548,
+		1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548,
+		1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548,
+		1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548,
+		1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548,
+		1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548,
+		1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548,
+		1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548,
+		1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548,
+		1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 146, 146, 1549, 1549, 1549, 1549, 1549, 1549, 1549, 1549, 1549, 1550,
+		1550, 1550, 1550, 1550, 1550, 1550, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 1551,
+		1551, 1551, 1551, 1551, 1551, 1551, 1551, 1551, 1551, 1551, 1551, 1551, 1551, 1551, 1551, 1551, 1551, 1551, 1551, 1551, 1551,
+		1551, 1551, 1551, 1551, 1551, 1551, 1551, 1551, 1551, 1551, 1551, 1551, 1552, 1552, 1552, 1552, 1552, 1552, 1552, 1552, 1552,
+		1552, 1552, 1552, 1552, 1552, 1552, 1552, 1552, 1552, 1552, 1552, 1552, 1552, 1552, 1552, 1552, 1552, 1552, 1552, 1552, 1552,
+		1552, 1552, 1552, 1552, 1553, 1553, 1553, 1554, 1555, 1555, 1555, 1556, 1556, 1556, 1556, 1556, 1557, 1557, 1557, 1557, 1557,
+		1557, 1557, 1557, 1557, 1557, 1556, 1556, 1556, 1556, 1558, 1558, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 1559, 1559, 1559,
+		1559, 257, 1559, 1559, 1559, 1559, 1559, 1559, 1559, 1559, 1559, 1559, 1559, 1559, 1559, 1559, 1559, 1559, 1559, 1559, 1559,
+		1559, 1559, 1559, 1559, 1559, 1559, 1559, 1559, 257, 1559, 1559, 257, 1559, 257, 257, 1559, 257, 1559, 1559, 1559, 1559,
+		1559, 1559, 1559, 1559, 1559, 1559, 257, 1559, 1559, 1559, 1559, 257, 1559, 257, 1559, 257, 257, 257, 257, 257, 257, 1559,
+		257, 257, 257, 257, 1559, 257, 1559, 257, 1559, 257, 1559, 1559, 1559, 257, 1559, 1559, 257, 1559, 257, 257, 1559, 257, 1559,
+		257, 1559, 257, 1559, 257, 1559, 257, 1559, 1559, 257, 1559, 257, 257, 1559, 1559, 1559, 1559, 257, 1559, 1559, 1559, 1559,
+		1559, 1559, 1559, 257, 1559, 1559, 1559, 1559, 257, 1559, 1559, 1559, 1559, 257, 1559, 257, 1559, 1559, 1559, 1559, 1559,
+		1559, 1559, 1559, 1559, 1559, 257, 1559, 1559, 1559, 1559, 1559, 1559, 1559, 1559, 1559, 1559, 1559, 1559, 1559, 1559, 1559,
+		1559, 1559, 257, 257, 257, 257, 257, 1559, 1559, 1559, 257, 1559, 1559, 1559, 1559, 1559, 257, 1559, 1559, 1559, 1559, 1559,
+		1559, 1559, 1559, 1559, 1559, 1559, 1559, 1559, 1559, 1559, 1559, 1559, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257,
+		257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257,
+		257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 1560, 1560, 257, 257, 257, 257, 257,
+		257, 257, 257, 257, 257, 257, 257, 257, 257, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838,
+		838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838,
+		838, 838, 838, 146, 146, 146, 146, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838,
+		838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838,
+		838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838,
+		838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838, 838,
+		838, 838, 838, 838, 838, 838, 838, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 1561, 1561, 1561, 1561, 1561,
+		1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 146, 146, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561,
+		1561, 1561, 1561, 1561, 1561, 1562, 146, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561,
+		1561, 146, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1562, 1562, 1562, 1562,
+		1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 839, 839, 839, 839, 839, 839, 839, 839, 839, 839, 839, 1563, 1563, 146, 146, 146, 986,
+		986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986,
+		986, 986, 986, 986, 986, 146, 1564, 1565, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1565, 1564, 1565,
+		1564, 1564, 1565, 1564, 1564, 1564, 1565, 1564, 1564, 1564, 986, 986, 986, 986, 986, 1561, 1564, 1564, 1564, 1564, 1564,
+		1564, 1564, 1565, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1565, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564,
+		1566, 1566, 146, 146, 146, 146, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1565, 1564, 1565, 1565, 1564, 1564,
+		1565, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 986, 986, 986, 986, 1561, 1561, 986, 1561, 1561, 1561,
+		1561, 1561, 1561, 1561, 1561, 1561, 1561, 1567, 1567, 1567, 1567, 1567, 1567, 1567, 1567, 1567, 1567, 1567, 1567, 1567, 1567,
+		1567, 1567, 1567, 1567, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 1568, 1568, 1568, 1568, 1568, 1568, 1568, 1568, 1568, 1568, 1568,
+		1568, 1568, 1568, 1568, 1568, 1568, 1568, 1568, 1568, 1568, 1568, 1568, 1568, 1568, 1568, 1569, 1561, 1561, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986,
+		986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 1561, 1561, 1561, 1561, 1561,
+		1561, 1561, 1561, 1561, 1567, 146, 146, 146, 146, 986, 986, 986, 986, 986, 986, 986, 986, 986, 146, 146, 146, 146, 146, 146,
+		146, 1561, 1561, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 1570, 1570, 1570, 1570, 1570, 1570,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561,
+		1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562,
+		1562, 1562, 1562, 1562, 844, 844, 844, 1561, 1561, 1561, 1561, 1561, 1561, 1562, 1561, 1561, 1561, 1561, 1561, 1561, 1561,
+		1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561,
+		1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561,
+		1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561,
+		1562, 844, 844, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561,
+		1561, 1561, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1561, 1561, 1561, 1561, 1561, 1561, 1561,
+		1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561,
+		1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1562, 1561, 1561, 1561, 1561, 1561, 1562, 1562, 1562, 1562, 844, 844,
+		844, 844, 844, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1561, 1561, 1561, 1561, 1561, 1561,
+		1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 844, 844, 844,
+		1571, 1571, 1571, 1571, 1571, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561,
+		1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561,
+		1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561,
+		1561, 1561, 1561, 1561, 1561, 1562, 1561, 1562, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561,
+		1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561,
+		1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561,
+		1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561,
+		1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561,
+		1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561,
+		1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561,
+		1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561,
+		1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561,
+		1561, 1562, 1561, 1561, 1561, 1561, 1562, 1562, 844, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561,
+		1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561,
+		1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561,
+		1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1562, 1562, 1566, 1566, 1566, 1566, 1562, 1562, 1562, 1562, 1562, 1562, 1562,
+		844, 844, 844, 844, 844, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561,
+		1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562,
+		1562, 1562, 1562, 1562, 1562, 1567, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562,
+		1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562,
+		1562, 1562, 1562, 1562, 1562, 1567, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562,
+		1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562,
+		1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562,
+		1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562,
+		1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1561, 1561, 1561, 1561, 1561, 1572, 1573, 1573, 1573, 1573, 1573, 1573, 1573,
+		1573, 1573, 1573, 1573, 1573, 1573, 1573, 1573, 1573, 1572, 1573, 1573, 1573, 1572, 1573, 1572, 1573, 1572, 1573, 1572, 1573,
+		1573, 1573, 1572, 1573, 1573, 1573, 1573, 1573, 1573, 1572, 1572, 1573, 1573, 1573, 1573, 1572, 1573, 1572, 1572, 1573, 1573,
+		1573, 1573, 1572, 1573, 1573, 1573, 1573, 1573, 1573, 1573, 1573, 1573, 1573, 1573, 1573, 1574, 1574, 1575, 1575, 1573, 1573,
+		1573, 1573, 1573, 1573, 1573, 1573, 1573, 1573, 1573, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562,
+		1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562,
+		1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1561, 1561, 1561, 1561, 1561, 1561,
+		1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561,
+		1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561,
+		1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561,
+		1561, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 844, 1567, 1567, 1570, 1570, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 146, 146, 146, 1562,
+		1562, 1562, 1562, 1567, 1567, 1567, 1570, 1570, 146, 146, 146, 146, 146, 146, 146, 1561, 1561, 1561, 1561, 1561, 1561, 1561,
+		1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561,
+		1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561,
+		1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561,
+		1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561,
+		1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561,
+		1561, 1561, 1561, 1561, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 1562, 1562, 1562, 1562, 1562, 1562, 1562,
+		1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562,
+		1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562,
+		1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562,
+		1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562,
+		1562, 146, 146, 146, 146, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562,
+		1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562,
+		1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 146, 146,
+		146, 146, 146, 146, 146, 146, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 146, 146, 146, 146, 146, 146, 1562,
+		1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562,
+		1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 146, 146, 146,
+		146, 146, 146, 146, 146, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562,
+		1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 1570,
+		1570, 1570, 1570, 1570, 1570, 1570, 1570, 1570, 1570, 1570, 1570, 146, 146, 146, 146, 844, 844, 844, 844, 844, 844, 844,
+		844, 844, 1567, 1567, 1567, 1567, 1567, 1567, 1570, 1567, 1567, 1567, 1567, 1567, 1567, 1567, 1567, 1570, 1570, 1570, 1570,
+		1570, 1570, 1570, 1570, 1567, 1570, 1570, 1567, 1567, 1567, 1567, 1567, 1567, 1567, 1567, 1567, 1567, 1567, 1567, 146, 1567,
+		1567, 1567, 1567, 1567, 1567, 1567, 1567, 1567, 1567, 1567, 1567, 1570, 146, 146, 146, 1567, 1567, 1567, 1567, 1567, 1567,
+		1567, 1567, 1567, 1567, 1567, 1567, 1567, 1567, 1567, 1570, 1570, 1570, 1570, 1570, 1570, 1570, 1570, 1570, 1570, 1570, 1570,
+		1570, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 844, 844, 844,
+		844, 844, 1567, 1567, 1567, 1567, 1567, 1567, 1567, 1567, 1567, 1567, 1567, 1567, 1567, 1570, 1570, 1570, 1570, 1570, 1570,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 844, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 1570, 1570, 1570, 1570, 1570, 1570, 1570, 1570, 1570, 1570, 1570, 1570, 1570, 1570, 1570, 1570,
+		1570, 1570, 1570, 1570, 1570, 1570, 1570, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 1576, 1576, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577,
+		1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577,
+		1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577,
+		1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577,
+		1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577,
+		1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577,
+		1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577,
+		1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577,
+		1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577,
+		1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577,
+		1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993,
+		993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993,
+		993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993,
+		993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993,
+		993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993,
+		993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993,
+		993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993,
+		993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578,
+		1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578,
+		1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578,
+		1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578,
+		1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578,
+		1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578,
+		1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578,
+		1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578,
+		1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578,
+		1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578,
+		1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 146, 146, 995, 995, 995, 995, 995,
+		995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995,
+		995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995,
+		995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995,
+		995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995,
+		995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995,
+		995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995,
+		995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995,
+		995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995,
+		995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995,
+		995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995, 995,
+		995, 995, 995, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 996, 996, 996, 996, 996, 996, 996, 996,
+		996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996,
+		996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996,
+		996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996,
+		996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996,
+		996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996,
+		996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996,
+		996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996,
+		996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996,
+		996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996,
+		996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996,
+		996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996,
+		996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 996, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579,
+		1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579,
+		1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579,
+		1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579,
+		1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579,
+		1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579,
+		1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579,
+		1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+		146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 1580, 1581, 1580, 1580, 1580, 1580, 1580, 1580,
+		1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580,
+		1580, 1580, 1580, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582,
+		1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582,
+		1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582,
+		1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582,
+		1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 787, 787, 787, 787, 787, 787, 787,
+		787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787,
+		787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787,
+		787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787,
+		787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787,
+		787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 1583, 1583, 1583,
+		1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583,
+		1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583,
+		1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583,
+		1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583,
+		1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583,
+		1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583,
+		1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583,
+		1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583,
+		1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583,
+		1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583,
+		1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583,
+		1583, 1583, 1583, 1583, 1583, 1583, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 1584,
+		1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584,
+		1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584,
+		1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584,
+		1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584,
+		1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584,
+		1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584,
+		1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584,
+		1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584,
+		1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584,
+		1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584,
+		1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584,
+		1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584,
+		1584, 1576, 1576
 	};
 
-	static constexpr std::array<std::uint_least16_t, 16> cflags =
-	{
-		512, 896, 640, 2432, 3080, 3072, 7280, 7269, 7237, 7176, 7267, 7235, 7233, 7168, 0, 128
-	};
+	static constexpr std::array<raw_record, 1586> records =
+	{ {
+		{ UINT64_C(7), 512, 1024, 25, 1, 16, 0, 0, 0 }, { UINT64_C(7), 512, 1024, 25, 1, 0, 0, 0, 0 }, { UINT64_C(4294967319), 896, 1024, 25, 1, 0, 0, 0, 0 },
+		{ UINT64_C(4294967327), 640, 1024, 25, 1, 0, 0, 0, 0 }, { UINT64_C(140741783322647), 2432, 1024, 24, 1, 32, 0, 0, 0 }, { UINT64_C(140747152032263), 3080, 1024, 16, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140746078290183), 3080, 1024, 16, 1, 32, 0, 0, 0 }, { UINT64_C(140746078289927), 3080, 1024, 16, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140746078289927), 3072, 1024, 18, 1, 32, 0, 0, 0 }, { UINT64_C(141295834104071), 3080, 1024, 16, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140746078289927), 3080, 1024, 17, 1, 32, 0, 0, 0 }, { UINT64_C(140746078289927), 3080, 1024, 13, 1, 32, 0, 0, 0 },
+		{ UINT64_C(703696031711239), 3072, 1024, 20, 1, 32, 0, 0, 0 }, { UINT64_C(140746078290439), 3080, 1024, 16, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140746078290055), 3080, 1024, 12, 1, 32, 0, 0, 0 }, { UINT64_C(141296907846151), 3080, 1024, 16, 1, 32, 0, 0, 0 },
+		{ UINT64_C(11399736556787719), 7280, 1024, 8, 1, 32, 0, 0, 0 }, { UINT64_C(141295834104327), 3080, 1024, 16, 1, 32, 0, 0, 0 },
+		{ UINT64_C(17092320570644487), 7269, 1024, 4, 34, 32, 1, 1, 0 }, { UINT64_C(17092320570638343), 7237, 1024, 4, 34, 32, 1, 1, 0 },
+		{ UINT64_C(704245787558919), 3072, 1024, 19, 1, 32, 0, 0, 0 }, { UINT64_C(11399736556781575), 7176, 1024, 11, 1, 32, 0, 0, 0 },
+		{ UINT64_C(141295834136583), 3072, 1024, 19, 1, 32, 0, 0, 0 }, { UINT64_C(17088953316284423), 7267, 1024, 0, 34, 32, 0, 0, 2 },
+		{ UINT64_C(17088953316278279), 7235, 1024, 0, 34, 32, 0, 0, 2 }, { UINT64_C(17088953383387143), 7235, 1024, 0, 34, 32, 0, 0, 2 },
+		{ UINT64_C(5), 512, 1024, 25, 1, 0, 0, 0, 0 }, { UINT64_C(4294967325), 640, 1024, 25, 1, 0, 0, 0, 0 }, { UINT64_C(140737488355349), 2432, 1024, 24, 1, 0, 0, 0, 0 },
+		{ UINT64_C(140746078289925), 3080, 1024, 16, 1, 32, 0, 0, 0 }, { UINT64_C(140746078289925), 3072, 1024, 18, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140746078289925), 3072, 1024, 21, 1, 32, 0, 0, 0 }, { UINT64_C(141287244201989), 3072, 1024, 19, 1, 32, 0, 0, 0 },
+		{ UINT64_C(17064764060598277), 7235, 1024, 2, 34, 32, 0, 0, 0 }, { UINT64_C(140746078290181), 3080, 1024, 15, 1, 32, 0, 0, 0 },
+		{ UINT64_C(703696031711237), 3072, 1024, 20, 1, 32, 0, 0, 0 }, { UINT64_C(70918499991557), 3072, 1024, 26, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 1024, 10, 1, 32, 0, 0, 0 }, { UINT64_C(17097749409300485), 7235, 1024, 0, 1, 32, 3, 0, 4 },
+		{ UINT64_C(11400286849564677), 3080, 1024, 16, 1, 32, 0, 0, 0 }, { UINT64_C(140746078290181), 3080, 1024, 14, 1, 32, 0, 0, 0 },
+		{ UINT64_C(17092320570638341), 7237, 1024, 4, 34, 32, 1, 1, 0 }, { UINT64_C(17097749409300485), 7235, 1024, 0, 34, 32, 0, 0, 5 },
+		{ UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 2 }, { UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 6 },
+		{ UINT64_C(17092320570638341), 7237, 1024, 4, 34, 32, 7, 7, 0 }, { UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 8 },
+		{ UINT64_C(17088953383387141), 7235, 1024, 0, 34, 32, 0, 0, 8 }, { UINT64_C(17092320570638341), 7237, 1024, 4, 34, 32, 0, 0, 0 },
+		{ UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 0 }, { UINT64_C(17064764060467205), 7235, 1024, 0, 34, 32, 0, 0, 0 },
+		{ UINT64_C(17097749409300485), 7235, 1024, 0, 34, 32, 0, 0, 0 }, { UINT64_C(17092320570638341), 7237, 1024, 4, 34, 32, 9, 9, 0 },
+		{ UINT64_C(17097749409300485), 7235, 1024, 0, 34, 32, 10, 0, 11 }, { UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 12 },
+		{ UINT64_C(17092320570638341), 7237, 1024, 4, 34, 32, 13, 13, 0 }, { UINT64_C(17092320570638341), 7237, 1024, 4, 34, 32, 14, 14, 0 },
+		{ UINT64_C(17092320570638341), 7237, 1024, 4, 34, 32, 15, 15, 0 }, { UINT64_C(17092320570638341), 7237, 1024, 4, 34, 32, 16, 16, 0 },
+		{ UINT64_C(17092320570638341), 7237, 1024, 4, 34, 32, 17, 17, 0 }, { UINT64_C(17092320570638341), 7237, 1024, 4, 34, 32, 18, 18, 0 },
+		{ UINT64_C(17092320570638341), 7237, 1024, 4, 34, 32, 19, 19, 0 }, { UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 20 },
+		{ UINT64_C(17092320570638341), 7237, 1024, 4, 34, 32, 21, 21, 0 }, { UINT64_C(17092320570638341), 7237, 1024, 4, 34, 32, 22, 22, 0 },
+		{ UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 23 }, { UINT64_C(17092320570638341), 7237, 1024, 4, 34, 32, 24, 24, 0 },
+		{ UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 25 }, { UINT64_C(17092320570638341), 7237, 1024, 4, 34, 32, 26, 26, 0 },
+		{ UINT64_C(17092320570638341), 7237, 1024, 4, 34, 32, 27, 27, 0 }, { UINT64_C(17092320570638341), 7237, 1024, 4, 34, 32, 28, 28, 0 },
+		{ UINT64_C(17092320570638341), 7237, 1024, 4, 34, 32, 29, 29, 0 }, { UINT64_C(17064420463083525), 7233, 1024, 2, 34, 32, 0, 0, 0 },
+		{ UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 30 }, { UINT64_C(17096718617149445), 7237, 1024, 4, 34, 32, 31, 31, 0 },
+		{ UINT64_C(17094382154940421), 7233, 1024, 3, 34, 32, 7, 7, 8 }, { UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 32 },
+		{ UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 33 }, { UINT64_C(17092320570638341), 7237, 4096, 4, 34, 32, 34, 34, 0 },
+		{ UINT64_C(17092320570638341), 7237, 4096, 4, 34, 32, 35, 35, 0 }, { UINT64_C(17092320570638341), 7237, 4096, 4, 34, 32, 7, 7, 0 },
+		{ UINT64_C(17088953316278277), 7235, 4096, 0, 34, 32, 0, 0, 8 }, { UINT64_C(17092320570638341), 7237, 6144, 4, 34, 32, 36, 36, 0 },
+		{ UINT64_C(17064764060467205), 7235, 7168, 0, 34, 32, 0, 0, 0 }, { UINT64_C(17064764060467205), 7235, 8192, 0, 34, 32, 0, 0, 0 },
+		{ UINT64_C(17092320570638341), 7237, 8192, 4, 34, 32, 37, 37, 0 }, { UINT64_C(17092320570638341), 7237, 8192, 4, 34, 32, 7, 7, 0 },
+		{ UINT64_C(17088953316278277), 7235, 8192, 0, 34, 32, 0, 0, 8 }, { UINT64_C(17092320570638341), 7237, 8192, 4, 34, 32, 38, 38, 0 },
+		{ UINT64_C(17092320570638341), 7237, 8192, 4, 34, 32, 39, 39, 0 }, { UINT64_C(17088953316278277), 7235, 8192, 0, 34, 32, 0, 0, 40 },
+		{ UINT64_C(17088953316278277), 7235, 9216, 0, 34, 32, 0, 0, 8 }, { UINT64_C(17092320570638341), 7237, 9216, 4, 34, 32, 41, 41, 0 },
+		{ UINT64_C(17092320570638341), 7237, 9216, 4, 34, 32, 42, 42, 0 }, { UINT64_C(17092320570638341), 7237, 9216, 4, 34, 32, 43, 43, 0 },
+		{ UINT64_C(17092320570638341), 7237, 9216, 4, 34, 32, 7, 7, 0 }, { UINT64_C(17088953383387141), 7235, 9216, 0, 34, 32, 0, 0, 8 },
+		{ UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 44 }, { UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 45 },
+		{ UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 46 }, { UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 47 },
+		{ UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 48 }, { UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 49 },
+		{ UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 50 }, { UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 51 },
+		{ UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 52 }, { UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 53 },
+		{ UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 54 }, { UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 55 },
+		{ UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 56 }, { UINT64_C(17088953383387141), 7235, 1024, 0, 34, 32, 0, 0, 57 },
+		{ UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 58 }, { UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 59 },
+		{ UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 60 }, { UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 61 },
+		{ UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 62 }, { UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 63 },
+		{ UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 64 }, { UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 65 },
+		{ UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 66 }, { UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 67 },
+		{ UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 68 }, { UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 69 },
+		{ UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 70 }, { UINT64_C(17088953383387141), 7235, 1024, 0, 34, 32, 0, 0, 71 },
+		{ UINT64_C(17088953316278277), 7235, 1024, 0, 34, 32, 0, 0, 72 }, { UINT64_C(17064764060467205), 7235, 4096, 0, 34, 32, 0, 0, 0 },
+		{ UINT64_C(17065313816444933), 7235, 1024, 1, 34, 32, 0, 0, 0 }, { UINT64_C(17065313883553797), 7235, 1024, 1, 34, 32, 0, 0, 0 },
+		{ UINT64_C(17064970218930181), 7233, 1024, 1, 1, 32, 0, 0, 0 }, { UINT64_C(17065313816444933), 7235, 1024, 1, 1, 32, 0, 0, 0 },
+		{ UINT64_C(17064970218995717), 7233, 1024, 1, 1, 32, 0, 0, 0 }, { UINT64_C(141287244201989), 3072, 4096, 19, 1, 32, 0, 0, 0 },
+		{ UINT64_C(141287244201989), 3072, 4096, 19, 6, 32, 0, 0, 0 }, { UINT64_C(17064970218930181), 7233, 4096, 1, 1, 32, 0, 0, 0 },
+		{ UINT64_C(141287244201989), 3072, 7168, 19, 1, 32, 0, 0, 0 }, { UINT64_C(11541023800983557), 7168, 1024, 7, 2, 16, 0, 0, 0 },
+		{ UINT64_C(11609537119428613), 7235, 1024, 7, 2, 16, 73, 0, 74 }, { UINT64_C(11541023800983557), 7168, 4096, 7, 2, 16, 0, 0, 0 },
+		{ UINT64_C(11611392578682885), 7168, 6144, 7, 2, 16, 0, 0, 0 }, { UINT64_C(11541023800983557), 7168, 7168, 7, 2, 16, 0, 0, 0 },
+		{ UINT64_C(11541023800950789), 7168, 8192, 7, 2, 16, 0, 0, 0 }, { UINT64_C(11541023800950789), 7168, 6144, 7, 2, 16, 0, 0, 0 },
+		{ UINT64_C(17092320570638341), 7237, 10240, 4, 21, 32, 7, 7, 0 }, { UINT64_C(17088953316278277), 7235, 10240, 0, 21, 32, 0, 0, 8 },
+		{ UINT64_C(141287244201989), 3072, 1024, 19, 21, 32, 0, 0, 0 }, { UINT64_C(1), 0, 0, 27, 0, 32, 0, 0, 0 }, { UINT64_C(3554514934333445), 7235, 1024, 1, 21, 32, 0, 0, 0 },
+		{ UINT64_C(17088953316278277), 7235, 9216, 0, 21, 32, 0, 0, 25 }, { UINT64_C(140737488355845), 3080, 1024, 16, 1, 32, 0, 0, 0 },
+		{ UINT64_C(17092320570638341), 7237, 16384, 4, 21, 32, 73, 73, 0 }, { UINT64_C(17092320570638341), 7237, 1024, 4, 21, 32, 75, 75, 0 },
+		{ UINT64_C(11400286849466885), 3080, 1024, 16, 1, 32, 0, 0, 0 }, { UINT64_C(17092320570638341), 7237, 1024, 4, 21, 32, 76, 76, 0 },
+		{ UINT64_C(17092320570638341), 7237, 1024, 4, 21, 32, 77, 77, 0 }, { UINT64_C(17092320570638341), 7237, 1024, 4, 21, 32, 78, 78, 0 },
+		{ UINT64_C(17088953316278277), 7235, 1024, 0, 21, 32, 0, 0, 0 }, { UINT64_C(17092320570638341), 7237, 1024, 4, 21, 32, 1, 1, 0 },
+		{ UINT64_C(17088953316278277), 7235, 1024, 0, 21, 32, 0, 0, 79 }, { UINT64_C(17088953316278277), 7235, 1024, 0, 21, 32, 0, 0, 80 },
+		{ UINT64_C(17088953316278277), 7235, 1024, 0, 21, 32, 0, 0, 2 }, { UINT64_C(17097749409300485), 7235, 1024, 0, 21, 32, 7, 0, 81 },
+		{ UINT64_C(17088953316278277), 7235, 1024, 0, 21, 32, 0, 0, 82 }, { UINT64_C(17088953316278277), 7235, 1024, 0, 21, 32, 0, 0, 83 },
+		{ UINT64_C(17092320570638341), 7237, 10240, 4, 21, 32, 84, 84, 0 }, { UINT64_C(17660699362722821), 7235, 1024, 0, 21, 32, 85, 0, 86 },
+		{ UINT64_C(17660699362722821), 7235, 1024, 0, 21, 32, 87, 0, 88 }, { UINT64_C(17627782733366277), 7237, 1024, 4, 21, 32, 0, 0, 0 },
+		{ UINT64_C(17064832779943941), 7237, 1024, 4, 21, 32, 0, 0, 0 }, { UINT64_C(17660699362722821), 7235, 1024, 0, 21, 32, 89, 0, 90 },
+		{ UINT64_C(17097749409300485), 7235, 1024, 0, 21, 32, 91, 0, 92 }, { UINT64_C(17088953316278277), 7235, 4096, 0, 21, 32, 0, 0, 93 },
+		{ UINT64_C(17092320570638341), 7237, 6144, 4, 21, 32, 7, 7, 0 }, { UINT64_C(17088953316278277), 7235, 6144, 0, 21, 32, 0, 0, 8 },
+		{ UINT64_C(17092320570638341), 7237, 1024, 4, 21, 32, 7, 7, 0 }, { UINT64_C(17088953316278277), 7235, 4096, 0, 21, 32, 0, 0, 8 },
+		{ UINT64_C(17092320570638341), 7237, 1024, 4, 12, 32, 7, 7, 0 }, { UINT64_C(17088953316278277), 7235, 1024, 0, 12, 32, 0, 0, 8 },
+		{ UINT64_C(17660699362722821), 7235, 1024, 0, 21, 32, 92, 0, 94 }, { UINT64_C(17660699362722821), 7235, 1024, 0, 21, 32, 95, 0, 96 },
+		{ UINT64_C(17088953316278277), 7235, 1024, 0, 21, 32, 0, 0, 97 }, { UINT64_C(17088953383387141), 7235, 1024, 0, 21, 32, 0, 0, 98 },
+		{ UINT64_C(17655270524060677), 7237, 5120, 4, 21, 32, 99, 99, 0 }, { UINT64_C(17660699362722821), 7235, 5120, 0, 21, 32, 82, 0, 100 },
+		{ UINT64_C(703687441776645), 3072, 6144, 20, 21, 32, 0, 0, 0 }, { UINT64_C(17092320570638341), 7237, 7168, 4, 21, 32, 7, 7, 0 },
+		{ UINT64_C(17088953316278277), 7235, 7168, 0, 21, 32, 0, 0, 8 }, { UINT64_C(17092320570638341), 7237, 7168, 4, 21, 32, 101, 101, 0 },
+		{ UINT64_C(17064764060467205), 7235, 8192, 0, 21, 32, 0, 0, 0 }, { UINT64_C(17092320570638341), 7237, 8192, 4, 21, 32, 36, 36, 0 },
+		{ UINT64_C(17092320570638341), 7237, 4105, 4, 14, 32, 102, 102, 0 }, { UINT64_C(17092320570638341), 7237, 1033, 4, 14, 32, 102, 102, 0 },
+		{ UINT64_C(17092320570638341), 7237, 1033, 4, 14, 32, 1, 1, 0 }, { UINT64_C(17088953316278277), 7235, 1033, 0, 14, 32, 0, 0, 2 },
+		{ UINT64_C(17088953316278277), 7235, 4105, 0, 14, 32, 0, 0, 96 }, { UINT64_C(17088953316278277), 7235, 1033, 0, 14, 32, 0, 0, 96 },
+		{ UINT64_C(17088953383387141), 7235, 1033, 0, 14, 32, 0, 0, 96 }, { UINT64_C(17092320570638341), 7237, 1033, 4, 14, 32, 7, 7, 0 },
+		{ UINT64_C(17088953316278277), 7235, 1033, 0, 14, 32, 0, 0, 8 }, { UINT64_C(140737488355333), 3072, 1033, 21, 14, 32, 0, 0, 0 },
+		{ UINT64_C(11541023800983557), 7168, 1033, 7, 14, 16, 0, 0, 0 }, { UINT64_C(11541023800983557), 7168, 1033, 7, 2, 16, 0, 0, 0 },
+		{ UINT64_C(11541023800983557), 7168, 10249, 7, 14, 16, 0, 0, 0 }, { UINT64_C(282024732524549), 7168, 4105, 6, 14, 16, 0, 0, 0 },
+		{ UINT64_C(17092320570638341), 7237, 6153, 4, 14, 32, 7, 7, 0 }, { UINT64_C(17088953316278277), 7235, 6153, 0, 14, 32, 0, 0, 8 },
+		{ UINT64_C(17092320570638341), 7237, 4105, 4, 14, 32, 7, 7, 0 }, { UINT64_C(17088953316278277), 7235, 4105, 0, 14, 32, 0, 0, 8 },
+		{ UINT64_C(17092320570638341), 7237, 1033, 4, 14, 32, 103, 103, 0 }, { UINT64_C(17088953316278277), 7235, 9225, 0, 14, 32, 0, 0, 89 },
+		{ UINT64_C(17092320570638341), 7237, 8201, 4, 14, 32, 7, 7, 0 }, { UINT64_C(17088953316278277), 7235, 8201, 0, 14, 32, 0, 0, 8 },
+		{ UINT64_C(17092320570638341), 7237, 9225, 4, 14, 32, 7, 7, 0 }, { UINT64_C(17088953316278277), 7235, 9225, 0, 14, 32, 0, 0, 8 },
+		{ UINT64_C(17092320570638341), 7237, 10249, 4, 14, 32, 7, 7, 0 }, { UINT64_C(17088953316278277), 7235, 10249, 0, 14, 32, 0, 0, 8 },
+		{ UINT64_C(17092320570638341), 7237, 11273, 4, 14, 32, 7, 7, 0 }, { UINT64_C(17088953316278277), 7235, 11273, 0, 14, 32, 0, 0, 8 },
+		{ UINT64_C(17092320570638341), 7237, 12297, 4, 14, 32, 7, 7, 0 }, { UINT64_C(17088953316278277), 7235, 12297, 0, 14, 32, 0, 0, 8 },
+		{ UINT64_C(17092320570638341), 7237, 16393, 4, 14, 32, 7, 7, 0 }, { UINT64_C(17088953316278277), 7235, 16393, 0, 14, 32, 0, 0, 8 },
+		{ UINT64_C(1), 0, 11, 27, 0, 32, 0, 0, 0 }, { UINT64_C(17092320570638341), 7237, 1035, 4, 4, 32, 104, 104, 0 }, { UINT64_C(17064970218930181), 7233, 1035, 1, 4, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3080, 1035, 16, 4, 32, 0, 0, 0 }, { UINT64_C(17088953316278277), 7235, 1035, 0, 4, 32, 0, 0, 95 },
+		{ UINT64_C(17097749409300485), 7235, 1035, 0, 4, 32, 0, 0, 0 }, { UINT64_C(140738562097669), 3080, 1035, 16, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355461), 3080, 4107, 12, 4, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 16395, 21, 4, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 13323, 18, 4, 32, 0, 0, 0 }, { UINT64_C(1), 0, 12, 27, 0, 32, 0, 0, 0 }, { UINT64_C(11541023800983557), 7168, 2060, 7, 27, 16, 0, 0, 0 },
+		{ UINT64_C(11541023800950789), 7168, 8204, 7, 27, 16, 0, 0, 0 }, { UINT64_C(11576208173080581), 7233, 1036, 7, 27, 16, 0, 0, 0 },
+		{ UINT64_C(11576208173080581), 7233, 9228, 7, 27, 16, 0, 0, 0 }, { UINT64_C(140737488355461), 3080, 1036, 12, 27, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3080, 1036, 16, 27, 32, 0, 0, 0 }, { UINT64_C(140737488355845), 3080, 1036, 16, 27, 32, 0, 0, 0 },
+		{ UINT64_C(11576208173080581), 7233, 2060, 7, 27, 16, 0, 0, 0 }, { UINT64_C(11576208173047813), 7233, 8204, 7, 27, 16, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3080, 8204, 16, 27, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 1036, 2, 27, 32, 0, 0, 0 },
+		{ UINT64_C(141287244169221), 3080, 1036, 16, 27, 32, 0, 0, 0 }, { UINT64_C(566935683077), 3072, 7181, 26, 3, 32, 0, 0, 0 },
+		{ UINT64_C(566935683077), 3072, 13325, 26, 3, 32, 0, 0, 0 }, { UINT64_C(566935683077), 3072, 16397, 26, 1, 32, 0, 0, 0 },
+		{ UINT64_C(703687441776645), 3072, 10253, 20, 3, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3080, 10253, 16, 3, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 8205, 18, 3, 32, 0, 0, 0 }, { UINT64_C(140737488355845), 3080, 1037, 16, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3080, 7181, 16, 3, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 7181, 21, 3, 32, 0, 0, 0 },
+		{ UINT64_C(11576208173047813), 7233, 7181, 7, 3, 16, 0, 0, 0 }, { UINT64_C(11576208173047813), 7233, 10253, 7, 3, 16, 0, 0, 0 },
+		{ UINT64_C(70918499991589), 3072, 15373, 26, 3, 32, 0, 0, 0 }, { UINT64_C(1), 0, 13, 27, 0, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3080, 8205, 16, 3, 32, 0, 0, 0 },
+		{ UINT64_C(140738562097669), 3080, 1037, 16, 1, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 12301, 2, 3, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 1037, 2, 3, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 10253, 2, 3, 32, 0, 0, 0 },
+		{ UINT64_C(17064970218962949), 7233, 1037, 1, 1, 32, 0, 0, 0 }, { UINT64_C(11576208173080581), 7233, 1037, 7, 2, 16, 0, 0, 0 },
+		{ UINT64_C(11576208173047813), 7233, 4109, 7, 2, 16, 0, 0, 0 }, { UINT64_C(11576208173080581), 7233, 7181, 7, 3, 16, 0, 0, 0 },
+		{ UINT64_C(11541023800983557), 7168, 7181, 7, 3, 16, 0, 0, 0 }, { UINT64_C(11576208173047813), 7233, 8205, 7, 3, 16, 0, 0, 0 },
+		{ UINT64_C(11576208173047813), 7233, 12301, 7, 3, 16, 0, 0, 0 }, { UINT64_C(11399736556781573), 7280, 1037, 8, 3, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3080, 1037, 16, 3, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 6157, 2, 3, 32, 0, 0, 0 },
+		{ UINT64_C(11576208173047813), 7233, 1037, 7, 2, 16, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 4109, 2, 3, 32, 0, 0, 0 },
+		{ UINT64_C(140738562097669), 3080, 1037, 16, 3, 32, 0, 0, 0 }, { UINT64_C(11576208173047813), 7233, 1037, 7, 3, 16, 0, 0, 0 },
+		{ UINT64_C(566935683077), 3072, 1037, 26, 1, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 1037, 21, 3, 32, 0, 0, 0 },
+		{ UINT64_C(11541023800983557), 7168, 1037, 7, 3, 16, 0, 0, 0 }, { UINT64_C(17064970218930181), 7233, 1037, 1, 3, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 7181, 2, 3, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 4109, 21, 3, 32, 0, 0, 0 },
+		{ UINT64_C(140738562097669), 3080, 4110, 16, 50, 32, 0, 0, 0 }, { UINT64_C(140737488355845), 3080, 4110, 16, 50, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3080, 4110, 16, 50, 32, 0, 0, 0 }, { UINT64_C(1), 0, 14, 27, 0, 32, 0, 0, 0 }, { UINT64_C(566935683077), 3072, 4110, 26, 50, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 4110, 2, 50, 32, 0, 0, 0 }, { UINT64_C(11576208173047813), 7233, 4110, 7, 50, 16, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 7182, 2, 50, 32, 0, 0, 0 }, { UINT64_C(11576208173080581), 7233, 4110, 7, 50, 16, 0, 0, 0 },
+		{ UINT64_C(11541023800983557), 7168, 4110, 7, 50, 16, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 8205, 2, 3, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 4112, 2, 56, 32, 0, 0, 0 }, { UINT64_C(11576208173080581), 7233, 4112, 7, 56, 16, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 6160, 2, 56, 32, 0, 0, 0 }, { UINT64_C(1), 0, 16, 27, 0, 32, 0, 0, 0 }, { UINT64_C(11399736556781573), 7280, 9233, 8, 64, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 9233, 2, 64, 32, 0, 0, 0 }, { UINT64_C(11541023800983557), 7168, 9233, 7, 64, 16, 0, 0, 0 },
+		{ UINT64_C(17064970218930181), 7233, 9233, 1, 64, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 9233, 21, 64, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3080, 9233, 16, 64, 32, 0, 0, 0 }, { UINT64_C(140737488355845), 3080, 9233, 16, 64, 32, 0, 0, 0 },
+		{ UINT64_C(140738562097669), 3080, 9233, 16, 64, 32, 0, 0, 0 }, { UINT64_C(17064970218962949), 7233, 9233, 1, 64, 32, 0, 0, 0 },
+		{ UINT64_C(1), 0, 17, 27, 0, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 11282, 2, 90, 32, 0, 0, 0 }, { UINT64_C(11576208173047813), 7233, 11282, 7, 90, 16, 0, 0, 0 },
+		{ UINT64_C(11541023800983557), 7168, 11282, 7, 90, 16, 0, 0, 0 }, { UINT64_C(17064970218897413), 7233, 11282, 1, 90, 32, 0, 0, 0 },
+		{ UINT64_C(11541023800950789), 7168, 11282, 7, 90, 16, 0, 0, 0 }, { UINT64_C(1), 0, 18, 27, 0, 32, 0, 0, 0 }, { UINT64_C(140737488355845), 3080, 11282, 16, 90, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 12307, 2, 95, 32, 0, 0, 0 }, { UINT64_C(11541023800950789), 7168, 12307, 7, 95, 16, 0, 0, 0 },
+		{ UINT64_C(1), 0, 19, 27, 0, 32, 0, 0, 0 }, { UINT64_C(140737488355845), 3080, 12307, 16, 95, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 19470, 2, 50, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 13325, 2, 3, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 16397, 2, 3, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 17421, 2, 3, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 18445, 2, 3, 32, 0, 0, 0 },
+		{ UINT64_C(11576208173047813), 7233, 18445, 7, 3, 16, 0, 0, 0 }, { UINT64_C(11541023800950789), 7168, 18445, 7, 3, 16, 0, 0, 0 },
+		{ UINT64_C(566935683077), 3072, 18445, 26, 1, 32, 0, 0, 0 }, { UINT64_C(11576208173080581), 7233, 17421, 7, 3, 16, 0, 0, 0 },
+		{ UINT64_C(11576208173080581), 7233, 13325, 7, 3, 16, 0, 0, 0 }, { UINT64_C(11541023800983557), 7168, 13325, 7, 3, 16, 0, 0, 0 },
+		{ UINT64_C(11576208173047813), 7233, 16397, 7, 3, 16, 0, 0, 0 }, { UINT64_C(11576208173047813), 7233, 11286, 7, 16, 16, 0, 0, 0 },
+		{ UINT64_C(11576208173047813), 7233, 1046, 7, 16, 16, 0, 0, 0 }, { UINT64_C(11434920928878597), 7233, 1046, 5, 16, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 7190, 2, 16, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 1046, 2, 16, 32, 0, 0, 0 },
+		{ UINT64_C(11576208173047813), 7233, 12310, 7, 16, 16, 0, 0, 0 }, { UINT64_C(11434920928878597), 7233, 12310, 5, 16, 32, 0, 0, 0 },
+		{ UINT64_C(11541023800983557), 7168, 1046, 7, 16, 16, 0, 0, 0 }, { UINT64_C(11434920928878597), 7233, 11286, 5, 16, 32, 0, 0, 0 },
+		{ UINT64_C(11541023800983557), 7168, 1046, 7, 2, 16, 0, 0, 0 }, { UINT64_C(140738562097669), 3080, 1046, 16, 1, 32, 0, 0, 0 },
+		{ UINT64_C(11399736556781573), 7280, 1046, 8, 16, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3080, 1046, 16, 16, 32, 0, 0, 0 },
+		{ UINT64_C(17064970218930181), 7233, 10262, 1, 16, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 10262, 2, 16, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 12310, 2, 16, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 16406, 2, 16, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 11286, 2, 16, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 9238, 2, 16, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 8214, 2, 16, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 16407, 2, 5, 32, 0, 0, 0 },
+		{ UINT64_C(11576208173047813), 7233, 1047, 7, 5, 16, 0, 0, 0 }, { UINT64_C(11434920928878597), 7233, 1047, 5, 5, 32, 0, 0, 0 },
+		{ UINT64_C(1), 0, 23, 27, 0, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 1047, 2, 5, 32, 0, 0, 0 }, { UINT64_C(11541023800983557), 7168, 1047, 7, 5, 16, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 7191, 2, 5, 32, 0, 0, 0 }, { UINT64_C(11575658418282501), 7233, 1047, 5, 5, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 8215, 2, 5, 32, 0, 0, 0 }, { UINT64_C(11399736556781573), 7280, 1047, 8, 5, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 1047, 18, 5, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 1047, 10, 5, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 1047, 21, 5, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 11287, 18, 5, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 19479, 2, 5, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3080, 19479, 16, 5, 32, 0, 0, 0 },
+		{ UINT64_C(1), 0, 24, 27, 0, 32, 0, 0, 0 }, { UINT64_C(11576208173047813), 7233, 7192, 7, 23, 16, 0, 0, 0 }, { UINT64_C(11576208173047813), 7233, 1048, 7, 23, 16, 0, 0, 0 },
+		{ UINT64_C(11434920928878597), 7233, 7192, 5, 23, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 1048, 2, 23, 32, 0, 0, 0 },
+		{ UINT64_C(11541023800983557), 7168, 1048, 7, 23, 16, 0, 0, 0 }, { UINT64_C(11434920928878597), 7233, 1048, 5, 23, 32, 0, 0, 0 },
+		{ UINT64_C(11576208173047813), 7233, 10264, 7, 23, 16, 0, 0, 0 }, { UINT64_C(11399736556781573), 7280, 1048, 8, 23, 32, 0, 0, 0 },
+		{ UINT64_C(1), 0, 25, 27, 0, 32, 0, 0, 0 }, { UINT64_C(11576208173047813), 7233, 1049, 7, 22, 16, 0, 0, 0 }, { UINT64_C(11434920928878597), 7233, 1049, 5, 22, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 1049, 2, 22, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 7193, 2, 22, 32, 0, 0, 0 },
+		{ UINT64_C(11541023800983557), 7168, 1049, 7, 22, 16, 0, 0, 0 }, { UINT64_C(11576208173047813), 7233, 7193, 7, 22, 16, 0, 0, 0 },
+		{ UINT64_C(11399736556781573), 7280, 1049, 8, 22, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3080, 13337, 16, 22, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 7193, 18, 22, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 17433, 2, 22, 32, 0, 0, 0 },
+		{ UINT64_C(11576208173047813), 7233, 19481, 7, 22, 16, 0, 0, 0 }, { UINT64_C(11541023800983557), 7168, 19481, 7, 22, 16, 0, 0, 0 },
+		{ UINT64_C(1), 0, 26, 27, 0, 32, 0, 0, 0 }, { UINT64_C(11576208173047813), 7233, 1050, 7, 44, 16, 0, 0, 0 }, { UINT64_C(11434920928878597), 7233, 1050, 5, 44, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 1050, 2, 44, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 7194, 2, 44, 32, 0, 0, 0 },
+		{ UINT64_C(11541023800983557), 7168, 1050, 7, 44, 16, 0, 0, 0 }, { UINT64_C(11575658418282501), 7233, 1050, 5, 44, 32, 0, 0, 0 },
+		{ UINT64_C(11576208173047813), 7233, 10266, 7, 44, 16, 0, 0, 0 }, { UINT64_C(11399736556781573), 7280, 1050, 8, 44, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 1050, 21, 44, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 12314, 10, 44, 32, 0, 0, 0 },
+		{ UINT64_C(1), 0, 27, 27, 0, 32, 0, 0, 0 }, { UINT64_C(11576208173047813), 7233, 1051, 7, 54, 16, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 1051, 2, 54, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 8219, 2, 54, 32, 0, 0, 0 }, { UINT64_C(11575658418282501), 7233, 1051, 5, 54, 32, 0, 0, 0 },
+		{ UINT64_C(11434920928878597), 7233, 1051, 5, 54, 32, 0, 0, 0 }, { UINT64_C(11541023800983557), 7168, 1051, 7, 54, 16, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 10267, 2, 54, 32, 0, 0, 0 }, { UINT64_C(11399736556781573), 7280, 8219, 8, 54, 32, 0, 0, 0 },
+		{ UINT64_C(11399736556781573), 7280, 1051, 8, 54, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 1051, 10, 54, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 7195, 21, 54, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 7195, 18, 54, 32, 0, 0, 0 },
+		{ UINT64_C(11576208173047813), 7233, 16412, 7, 55, 16, 0, 0, 0 }, { UINT64_C(11434920928878597), 7233, 1052, 5, 55, 32, 0, 0, 0 },
+		{ UINT64_C(1), 0, 28, 27, 0, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 1052, 2, 55, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 16412, 2, 55, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 10268, 2, 55, 32, 0, 0, 0 }, { UINT64_C(11576208173047813), 7233, 1052, 7, 55, 16, 0, 0, 0 },
+		{ UINT64_C(11541023800983557), 7168, 1052, 7, 55, 16, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 17436, 2, 55, 32, 0, 0, 0 },
+		{ UINT64_C(11576208173047813), 7233, 10268, 7, 55, 16, 0, 0, 0 }, { UINT64_C(11399736556781573), 7280, 1052, 8, 55, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 10268, 10, 55, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 10268, 21, 55, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 18461, 2, 29, 32, 0, 0, 0 }, { UINT64_C(11576208173047813), 7233, 16413, 7, 29, 16, 0, 0, 0 },
+		{ UINT64_C(11434920928878597), 7233, 1053, 5, 29, 32, 0, 0, 0 }, { UINT64_C(1), 0, 29, 27, 0, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 1053, 2, 29, 32, 0, 0, 0 },
+		{ UINT64_C(11541023800983557), 7168, 7197, 7, 29, 16, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 7197, 2, 29, 32, 0, 0, 0 },
+		{ UINT64_C(11576208173047813), 7233, 1053, 7, 29, 16, 0, 0, 0 }, { UINT64_C(11575658418282501), 7233, 1053, 5, 29, 32, 0, 0, 0 },
+		{ UINT64_C(11541023800983557), 7168, 1053, 7, 29, 16, 0, 0, 0 }, { UINT64_C(11576208173047813), 7233, 9245, 7, 29, 16, 0, 0, 0 },
+		{ UINT64_C(11399736556781573), 7280, 1053, 8, 29, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 9245, 2, 29, 32, 0, 0, 0 },
+		{ UINT64_C(11576208173047813), 7233, 19486, 7, 37, 16, 0, 0, 0 }, { UINT64_C(11576208173047813), 7233, 16414, 7, 37, 16, 0, 0, 0 },
+		{ UINT64_C(11434920928878597), 7233, 1054, 5, 37, 32, 0, 0, 0 }, { UINT64_C(1), 0, 30, 27, 0, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 1054, 2, 37, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 12318, 2, 37, 32, 0, 0, 0 }, { UINT64_C(11541023800983557), 7168, 19486, 7, 37, 16, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 10270, 2, 37, 32, 0, 0, 0 }, { UINT64_C(11575658418282501), 7233, 1054, 5, 37, 32, 0, 0, 0 },
+		{ UINT64_C(11576208173047813), 7233, 1054, 7, 37, 16, 0, 0, 0 }, { UINT64_C(11576208173047813), 7233, 10270, 7, 37, 16, 0, 0, 0 },
+		{ UINT64_C(11541023800983557), 7168, 1054, 7, 37, 16, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 18462, 21, 37, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 18462, 2, 37, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 18462, 10, 37, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 17438, 2, 37, 32, 0, 0, 0 }, { UINT64_C(11399736556781573), 7280, 1054, 8, 37, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 10270, 10, 37, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 10270, 21, 37, 32, 0, 0, 0 },
+		{ UINT64_C(1), 0, 31, 27, 0, 32, 0, 0, 0 }, { UINT64_C(11434920928878597), 7233, 4127, 5, 48, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 4127, 2, 48, 32, 0, 0, 0 },
+		{ UINT64_C(11541023800983557), 7168, 4127, 7, 48, 16, 0, 0, 0 }, { UINT64_C(11575658418282501), 7233, 4127, 5, 48, 32, 0, 0, 0 },
+		{ UINT64_C(11576208173047813), 7233, 4127, 7, 48, 16, 0, 0, 0 }, { UINT64_C(11399736556781573), 7280, 16415, 8, 48, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3080, 4127, 16, 48, 32, 0, 0, 0 }, { UINT64_C(1), 0, 32, 27, 0, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 1056, 2, 57, 32, 0, 0, 0 },
+		{ UINT64_C(11576208173047813), 7233, 1056, 7, 57, 16, 0, 0, 0 }, { UINT64_C(12560820835713029), 7233, 1056, 2, 57, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 1056, 18, 1, 32, 0, 0, 0 }, { UINT64_C(17064420597301253), 7233, 1056, 2, 57, 32, 0, 0, 0 },
+		{ UINT64_C(17064970218962949), 7233, 1056, 1, 57, 32, 0, 0, 0 }, { UINT64_C(11541023800983557), 7168, 1056, 7, 57, 16, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3080, 1056, 16, 57, 32, 0, 0, 0 }, { UINT64_C(11399736556781573), 7280, 1056, 8, 57, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355845), 3080, 1056, 16, 57, 32, 0, 0, 0 }, { UINT64_C(1), 0, 33, 27, 0, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 1057, 2, 33, 32, 0, 0, 0 },
+		{ UINT64_C(11576208173047813), 7233, 1057, 7, 33, 16, 0, 0, 0 }, { UINT64_C(12560820835713029), 7233, 1057, 2, 33, 32, 0, 0, 0 },
+		{ UINT64_C(17064420597301253), 7233, 1057, 2, 33, 32, 0, 0, 0 }, { UINT64_C(17064970218962949), 7233, 1057, 1, 33, 32, 0, 0, 0 },
+		{ UINT64_C(11541023800983557), 7168, 1057, 7, 33, 16, 0, 0, 0 }, { UINT64_C(11399736556781573), 7280, 1057, 8, 33, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 13345, 2, 33, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 2082, 2, 58, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 2082, 21, 58, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3080, 2082, 16, 58, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355845), 3080, 2082, 16, 58, 32, 0, 0, 0 }, { UINT64_C(11541023800983557), 7168, 2082, 7, 58, 16, 0, 0, 0 },
+		{ UINT64_C(11399736556781573), 7280, 2082, 8, 58, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 2082, 10, 58, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3080, 2082, 17, 58, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3080, 2082, 13, 58, 32, 0, 0, 0 },
+		{ UINT64_C(11399736556814341), 7168, 2082, 5, 58, 32, 0, 0, 0 }, { UINT64_C(1), 0, 34, 27, 0, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 4130, 2, 58, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 10274, 2, 58, 32, 0, 0, 0 }, { UINT64_C(11576208173047813), 7233, 2082, 7, 58, 16, 0, 0, 0 },
+		{ UINT64_C(11434920928878597), 7233, 2082, 5, 58, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 12322, 2, 58, 32, 0, 0, 0 },
+		{ UINT64_C(11576208173047813), 7233, 12322, 7, 58, 16, 0, 0, 0 }, { UINT64_C(11576208173047813), 7233, 4130, 7, 58, 16, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 4130, 21, 58, 32, 0, 0, 0 }, { UINT64_C(11541023800983557), 7168, 4130, 7, 58, 16, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 10274, 21, 58, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3080, 8226, 16, 58, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3080, 10274, 16, 58, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 11298, 21, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3080, 12322, 16, 58, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 4131, 2, 39, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 10275, 2, 39, 32, 0, 0, 0 }, { UINT64_C(11434920928878597), 7233, 10275, 5, 39, 32, 0, 0, 0 },
+		{ UINT64_C(11434920928878597), 7233, 4131, 5, 39, 32, 0, 0, 0 }, { UINT64_C(11576208173047813), 7233, 4131, 7, 39, 16, 0, 0, 0 },
+		{ UINT64_C(11576208173047813), 7233, 10275, 7, 39, 16, 0, 0, 0 }, { UINT64_C(11541023800983557), 7168, 4131, 7, 39, 16, 0, 0, 0 },
+		{ UINT64_C(11541023800983557), 7168, 10275, 7, 39, 16, 0, 0, 0 }, { UINT64_C(11399736556781573), 7280, 4131, 8, 39, 32, 0, 0, 0 },
+		{ UINT64_C(140738562097669), 3080, 4131, 16, 39, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3080, 4131, 16, 39, 32, 0, 0, 0 },
+		{ UINT64_C(11399736556781573), 7168, 10275, 5, 39, 32, 0, 0, 0 }, { UINT64_C(11399736556814341), 7168, 10275, 5, 39, 32, 0, 0, 0 },
+		{ UINT64_C(11399736556781573), 7280, 10275, 8, 39, 32, 0, 0, 0 }, { UINT64_C(11399736556814341), 7168, 11299, 5, 39, 32, 0, 0, 0 },
+		{ UINT64_C(11434920928878597), 7233, 11299, 5, 39, 32, 0, 0, 0 }, { UINT64_C(11576208173047813), 7233, 11299, 7, 39, 16, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 10275, 21, 39, 32, 0, 0, 0 }, { UINT64_C(17092320570638341), 7237, 1060, 4, 18, 32, 105, 105, 0 },
+		{ UINT64_C(1), 0, 36, 27, 0, 32, 0, 0, 0 }, { UINT64_C(17092320570638341), 7237, 13348, 4, 18, 32, 105, 105, 0 }, { UINT64_C(17064420463083525), 7233, 1060, 2, 18, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 6180, 2, 18, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 8228, 2, 18, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3080, 1060, 16, 1, 32, 0, 0, 0 }, { UINT64_C(17064970218897413), 7233, 8228, 1, 18, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 13348, 2, 18, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 1024, 2, 25, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 11264, 2, 25, 32, 0, 0, 0 }, { UINT64_C(17134789240815621), 7233, 1024, 2, 25, 32, 0, 0, 0 },
+		{ UINT64_C(17134789240815621), 7233, 1024, 2, 25, 16, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 1024, 2, 25, 16, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 11264, 2, 25, 16, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 4134, 2, 17, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 8230, 2, 17, 32, 0, 0, 0 }, { UINT64_C(1), 0, 38, 27, 0, 32, 0, 0, 0 }, { UINT64_C(11541023800950789), 7168, 12326, 7, 17, 16, 0, 0, 0 },
+		{ UINT64_C(11576208173047813), 7233, 8230, 7, 17, 16, 0, 0, 0 }, { UINT64_C(140737488355333), 3080, 8230, 16, 17, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355845), 3080, 4134, 16, 17, 32, 0, 0, 0 }, { UINT64_C(140738562097669), 3080, 4134, 16, 17, 32, 0, 0, 0 },
+		{ UINT64_C(11399737093652485), 3072, 4134, 10, 17, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 4134, 10, 17, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 8230, 21, 17, 32, 0, 0, 0 }, { UINT64_C(17083524477616133), 7237, 4136, 4, 11, 32, 0, 106, 0 },
+		{ UINT64_C(17083524477616133), 7237, 4136, 4, 11, 32, 0, 84, 0 }, { UINT64_C(17083524477616133), 7237, 17448, 4, 11, 32, 0, 84, 0 },
+		{ UINT64_C(1), 0, 40, 27, 0, 32, 0, 0, 0 }, { UINT64_C(17097749409300485), 7235, 17448, 0, 11, 32, 93, 0, 93 }, { UINT64_C(140737488355461), 3080, 11264, 12, 10, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 4096, 2, 10, 32, 0, 0, 0 }, { UINT64_C(140737488355845), 3080, 4096, 16, 10, 32, 0, 0, 0 },
+		{ UINT64_C(140738562097669), 3080, 4096, 16, 10, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 11264, 2, 10, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355349), 2432, 4138, 24, 41, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 4138, 2, 41, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3080, 4138, 17, 41, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3080, 4138, 13, 41, 32, 0, 0, 0 },
+		{ UINT64_C(1), 0, 42, 27, 0, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 4139, 2, 46, 32, 0, 0, 0 }, { UINT64_C(140737488355845), 3080, 4139, 16, 1, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 4139, 9, 46, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 16427, 2, 46, 32, 0, 0, 0 },
+		{ UINT64_C(1), 0, 43, 27, 0, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 6188, 2, 51, 32, 0, 0, 0 }, { UINT64_C(1), 0, 44, 27, 0, 32, 0, 0, 0 },
+		{ UINT64_C(11576208173047813), 7233, 6188, 7, 51, 16, 0, 0, 0 }, { UINT64_C(11541023800950789), 7168, 6188, 7, 51, 16, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 6189, 2, 26, 32, 0, 0, 0 }, { UINT64_C(11576208173047813), 7233, 6189, 7, 26, 16, 0, 0, 0 },
+		{ UINT64_C(11541023800950789), 7168, 6189, 7, 26, 16, 0, 0, 0 }, { UINT64_C(140738562097669), 3080, 6189, 16, 1, 32, 0, 0, 0 },
+		{ UINT64_C(1), 0, 45, 27, 0, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 6190, 2, 9, 32, 0, 0, 0 }, { UINT64_C(11576208173047813), 7233, 6190, 7, 9, 16, 0, 0, 0 },
+		{ UINT64_C(1), 0, 46, 27, 0, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 6191, 2, 52, 32, 0, 0, 0 }, { UINT64_C(1), 0, 47, 27, 0, 32, 0, 0, 0 },
+		{ UINT64_C(11576208173047813), 7233, 6191, 7, 52, 16, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 4144, 2, 32, 32, 0, 0, 0 },
+		{ UINT64_C(11611392578682885), 7168, 4144, 7, 32, 16, 0, 0, 0 }, { UINT64_C(11434920928878597), 7233, 4144, 5, 32, 32, 0, 0, 0 },
+		{ UINT64_C(11576208173047813), 7233, 4144, 7, 32, 16, 0, 0, 0 }, { UINT64_C(11541023800983557), 7168, 4144, 7, 32, 16, 0, 0, 0 },
+		{ UINT64_C(140737488355845), 3080, 4144, 16, 32, 32, 0, 0, 0 }, { UINT64_C(17064970218897413), 7233, 4144, 1, 32, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3080, 4144, 16, 32, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 4144, 18, 32, 32, 0, 0, 0 },
+		{ UINT64_C(11541023800983557), 7168, 7216, 7, 32, 16, 0, 0, 0 }, { UINT64_C(1), 0, 48, 27, 0, 32, 0, 0, 0 }, { UINT64_C(11399736556781573), 7280, 4144, 8, 32, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 7216, 10, 32, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3080, 4145, 16, 38, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355845), 3080, 4145, 16, 1, 32, 0, 0, 0 }, { UINT64_C(140738562097669), 3080, 4145, 16, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355845), 3080, 4145, 16, 38, 32, 0, 0, 0 }, { UINT64_C(140737488355461), 3080, 4145, 12, 38, 32, 0, 0, 0 },
+		{ UINT64_C(140738562097669), 3080, 4145, 16, 38, 32, 0, 0, 0 }, { UINT64_C(140737488420869), 3080, 4145, 16, 38, 32, 0, 0, 0 },
+		{ UINT64_C(11611394692612101), 7168, 4145, 7, 38, 16, 0, 0, 0 }, { UINT64_C(70918499991557), 3072, 4145, 26, 38, 32, 0, 0, 0 },
+		{ UINT64_C(1), 0, 49, 27, 0, 32, 0, 0, 0 }, { UINT64_C(11399736556781573), 7280, 4145, 8, 38, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 4145, 2, 38, 32, 0, 0, 0 },
+		{ UINT64_C(17064970218962949), 7233, 4145, 1, 38, 32, 0, 0, 0 }, { UINT64_C(17205707975696389), 7233, 4145, 7, 38, 16, 0, 0, 0 },
+		{ UINT64_C(11576208173047813), 7233, 4145, 7, 38, 16, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 10289, 2, 38, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 7219, 2, 35, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 16435, 2, 35, 32, 0, 0, 0 },
+		{ UINT64_C(1), 0, 51, 27, 0, 32, 0, 0, 0 }, { UINT64_C(11576208173047813), 7233, 7219, 7, 35, 16, 0, 0, 0 }, { UINT64_C(11434920928878597), 7233, 7219, 5, 35, 32, 0, 0, 0 },
+		{ UINT64_C(11541023800983557), 7168, 7219, 7, 35, 16, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 7219, 21, 35, 32, 0, 0, 0 },
+		{ UINT64_C(140738562097669), 3080, 7219, 16, 35, 32, 0, 0, 0 }, { UINT64_C(11399736556781573), 7280, 7219, 8, 35, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 7168, 2, 53, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 8192, 2, 40, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 11264, 2, 40, 32, 0, 0, 0 }, { UINT64_C(17064420597301253), 7233, 8192, 2, 40, 32, 0, 0, 0 },
+		{ UINT64_C(11399736556781573), 7280, 8192, 8, 40, 32, 0, 0, 0 }, { UINT64_C(11399737093652485), 3072, 11264, 10, 40, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 8192, 21, 40, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 7216, 21, 32, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 8247, 2, 8, 32, 0, 0, 0 }, { UINT64_C(11576208173047813), 7233, 8247, 7, 8, 16, 0, 0, 0 },
+		{ UINT64_C(11434920928878597), 7233, 8247, 5, 8, 32, 0, 0, 0 }, { UINT64_C(1), 0, 55, 27, 0, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3080, 8247, 16, 8, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 11264, 2, 91, 32, 0, 0, 0 }, { UINT64_C(11434920928878597), 7233, 11264, 5, 91, 32, 0, 0, 0 },
+		{ UINT64_C(11576208173047813), 7233, 11264, 7, 91, 16, 0, 0, 0 }, { UINT64_C(11541023800950789), 7168, 11264, 7, 91, 16, 0, 0, 0 },
+		{ UINT64_C(11541023800983557), 7168, 11264, 7, 91, 16, 0, 0, 0 }, { UINT64_C(11399736556781573), 7280, 11264, 8, 91, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3080, 11264, 16, 91, 32, 0, 0, 0 }, { UINT64_C(17064970218962949), 7233, 11264, 1, 91, 32, 0, 0, 0 },
+		{ UINT64_C(140738562097669), 3080, 11264, 16, 91, 32, 0, 0, 0 }, { UINT64_C(11541023800983557), 7168, 16384, 7, 2, 16, 0, 0, 0 },
+		{ UINT64_C(282024732524549), 7168, 16384, 6, 2, 16, 0, 0, 0 }, { UINT64_C(11576208173047813), 7233, 9274, 7, 62, 16, 0, 0, 0 },
+		{ UINT64_C(11434920928878597), 7233, 9274, 5, 62, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 9274, 2, 62, 32, 0, 0, 0 },
+		{ UINT64_C(11541023800983557), 7168, 9274, 7, 62, 16, 0, 0, 0 }, { UINT64_C(11399736556814341), 7168, 9274, 5, 62, 32, 0, 0, 0 },
+		{ UINT64_C(1), 0, 58, 27, 0, 32, 0, 0, 0 }, { UINT64_C(11399736556781573), 7280, 9274, 8, 62, 32, 0, 0, 0 }, { UINT64_C(140738562097669), 3080, 9274, 16, 62, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3080, 9274, 16, 62, 32, 0, 0, 0 }, { UINT64_C(140737488355845), 3080, 9274, 16, 62, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 9274, 21, 62, 32, 0, 0, 0 }, { UINT64_C(11576208173047813), 7233, 10299, 7, 76, 16, 0, 0, 0 },
+		{ UINT64_C(11434920928878597), 7233, 10299, 5, 76, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 10299, 2, 76, 32, 0, 0, 0 },
+		{ UINT64_C(11399736556814341), 7168, 10299, 5, 76, 32, 0, 0, 0 }, { UINT64_C(11541023800983557), 7168, 13371, 7, 76, 16, 0, 0, 0 },
+		{ UINT64_C(11576208173047813), 7233, 13371, 7, 76, 16, 0, 0, 0 }, { UINT64_C(11399736556781573), 7280, 10299, 8, 76, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 13371, 2, 76, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 12348, 2, 93, 32, 0, 0, 0 },
+		{ UINT64_C(11541023800950789), 7168, 12348, 7, 93, 16, 0, 0, 0 }, { UINT64_C(11434920928878597), 7233, 12348, 5, 93, 32, 0, 0, 0 },
+		{ UINT64_C(11576208173047813), 7233, 12348, 7, 93, 16, 0, 0, 0 }, { UINT64_C(11399736556781573), 7168, 12348, 5, 93, 32, 0, 0, 0 },
+		{ UINT64_C(1), 0, 60, 27, 0, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3080, 12348, 16, 93, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 10301, 2, 70, 32, 0, 0, 0 },
+		{ UINT64_C(11434920928878597), 7233, 10301, 5, 70, 32, 0, 0, 0 }, { UINT64_C(11576208173047813), 7233, 10301, 7, 70, 16, 0, 0, 0 },
+		{ UINT64_C(11541023801049093), 7168, 10301, 7, 70, 16, 0, 0, 0 }, { UINT64_C(11541023800983557), 7168, 10301, 7, 70, 16, 0, 0, 0 },
+		{ UINT64_C(1), 0, 61, 27, 0, 32, 0, 0, 0 }, { UINT64_C(140738562097669), 3080, 10301, 16, 70, 32, 0, 0, 0 }, { UINT64_C(140737488355845), 3080, 10301, 16, 70, 32, 0, 0, 0 },
+		{ UINT64_C(11399736556781573), 7280, 10301, 8, 70, 32, 0, 0, 0 }, { UINT64_C(11399736556781573), 7280, 10240, 8, 73, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 10240, 2, 73, 32, 0, 0, 0 }, { UINT64_C(17064970218930181), 7233, 10240, 1, 73, 32, 0, 0, 0 },
+		{ UINT64_C(17064970218995717), 7233, 10240, 1, 73, 32, 0, 0, 0 }, { UINT64_C(140738562097669), 3080, 10240, 16, 73, 32, 0, 0, 0 },
+		{ UINT64_C(17097749409300485), 7235, 18441, 0, 14, 32, 107, 0, 108 }, { UINT64_C(17097749409300485), 7235, 18441, 0, 14, 32, 109, 0, 110 },
+		{ UINT64_C(17097749409300485), 7235, 18441, 0, 14, 32, 111, 0, 112 }, { UINT64_C(17097749409300485), 7235, 18441, 0, 14, 32, 113, 0, 114 },
+		{ UINT64_C(17097749409300485), 7235, 18441, 0, 14, 32, 115, 0, 116 }, { UINT64_C(17097749409300485), 7235, 18441, 0, 14, 32, 117, 0, 118 },
+		{ UINT64_C(17097749409300485), 7235, 18441, 0, 14, 32, 119, 0, 120 }, { UINT64_C(17097749409300485), 7235, 18441, 0, 14, 32, 121, 0, 122 },
+		{ UINT64_C(1), 0, 9, 27, 0, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3080, 13371, 16, 76, 32, 0, 0, 0 }, { UINT64_C(1), 0, 59, 27, 0, 32, 0, 0, 0 },
+		{ UINT64_C(11541023800983557), 7168, 11264, 7, 2, 16, 0, 0, 0 }, { UINT64_C(140737488388101), 3080, 11264, 16, 1, 32, 0, 0, 0 },
+		{ UINT64_C(11399736556814341), 7168, 11264, 5, 1, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 11264, 2, 1, 32, 0, 0, 0 },
+		{ UINT64_C(11434920928878597), 7233, 11264, 5, 1, 32, 0, 0, 0 }, { UINT64_C(11434920928878597), 7233, 13312, 5, 1, 32, 0, 0, 0 },
+		{ UINT64_C(11541023800983557), 7168, 13312, 7, 2, 16, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 13312, 2, 1, 32, 0, 0, 0 },
+		{ UINT64_C(11399736556814341), 7168, 19456, 5, 1, 32, 0, 0, 0 }, { UINT64_C(17064764060467205), 7235, 7168, 0, 21, 32, 0, 0, 0 },
+		{ UINT64_C(17064764060467205), 7235, 7168, 0, 14, 32, 0, 0, 0 }, { UINT64_C(17065313816444933), 7235, 7168, 1, 34, 32, 0, 0, 0 },
+		{ UINT64_C(17065313816444933), 7235, 7168, 1, 21, 32, 0, 0, 0 }, { UINT64_C(17065313883553797), 7235, 7168, 1, 34, 32, 0, 0, 0 },
+		{ UINT64_C(17065313816412165), 7235, 8192, 1, 14, 32, 0, 0, 0 }, { UINT64_C(17088953316278277), 7235, 8192, 0, 34, 32, 0, 0, 123 },
+		{ UINT64_C(17088953316278277), 7235, 8192, 0, 34, 32, 0, 0, 124 }, { UINT64_C(17064764127576069), 7235, 8192, 0, 34, 32, 0, 0, 0 },
+		{ UINT64_C(17065313816412165), 7235, 8192, 1, 34, 32, 0, 0, 0 }, { UINT64_C(17065313883521029), 7235, 8192, 1, 34, 32, 0, 0, 0 },
+		{ UINT64_C(17065313816412165), 7235, 8192, 1, 21, 32, 0, 0, 0 }, { UINT64_C(11541023800983557), 7168, 9216, 7, 2, 16, 0, 0, 0 },
+		{ UINT64_C(11541023800983557), 7168, 10240, 7, 2, 16, 0, 0, 0 }, { UINT64_C(11541023800950789), 7168, 10240, 7, 2, 16, 0, 0, 0 },
+		{ UINT64_C(11576208173047813), 7233, 16384, 7, 2, 16, 0, 0, 0 }, { UINT64_C(11541023800983557), 7168, 19456, 7, 2, 16, 0, 0, 0 },
+		{ UINT64_C(11541023800950789), 7168, 18432, 7, 2, 16, 0, 0, 0 }, { UINT64_C(11541023800950789), 7168, 12288, 7, 2, 16, 0, 0, 0 },
+		{ UINT64_C(17097749409300485), 7235, 2048, 0, 34, 32, 125, 0, 126 }, { UINT64_C(17064764060467205), 7235, 10240, 0, 34, 32, 0, 0, 0 },
+		{ UINT64_C(17092320570638341), 7237, 10240, 4, 34, 32, 127, 127, 0 }, { UINT64_C(17092320570638341), 7237, 10240, 4, 34, 32, 7, 7, 0 },
+		{ UINT64_C(17088953316278277), 7235, 10240, 0, 34, 32, 0, 0, 8 }, { UINT64_C(17088953316278277), 7235, 1024, 0, 21, 32, 0, 0, 84 },
+		{ UINT64_C(17092320570638341), 7237, 1024, 4, 21, 32, 93, 93, 0 }, { UINT64_C(17088953316278277), 7235, 1024, 0, 21, 32, 0, 0, 128 },
+		{ UINT64_C(17088953316278277), 7235, 1024, 0, 21, 32, 0, 0, 129 }, { UINT64_C(17088953316278277), 7235, 1024, 0, 21, 32, 0, 0, 130 },
+		{ UINT64_C(17088953316278277), 7235, 1024, 0, 21, 32, 0, 0, 131 }, { UINT64_C(17088953316278277), 7235, 1024, 0, 21, 32, 0, 0, 132 },
+		{ UINT64_C(17088953316278277), 7235, 1024, 0, 21, 32, 0, 0, 133 }, { UINT64_C(17097749409300485), 7235, 1024, 0, 21, 32, 0, 0, 0 },
+		{ UINT64_C(17094382154940421), 7233, 1024, 3, 21, 32, 93, 93, 93 }, { UINT64_C(17092320570638341), 7237, 1024, 4, 21, 32, 134, 134, 0 },
+		{ UINT64_C(17094382154940421), 7233, 1024, 3, 21, 32, 135, 135, 135 }, { UINT64_C(17088953316278277), 7235, 1024, 0, 21, 32, 136, 0, 137 },
+		{ UINT64_C(17092320570638341), 7237, 1024, 4, 21, 32, 94, 94, 0 }, { UINT64_C(17092320570638341), 7237, 1024, 4, 21, 32, 138, 138, 0 },
+		{ UINT64_C(17092320570638341), 7237, 1024, 4, 21, 32, 139, 139, 0 }, { UINT64_C(17092320570638341), 7237, 1024, 4, 21, 32, 101, 101, 0 },
+		{ UINT64_C(17092320570638341), 7237, 1024, 4, 21, 32, 140, 140, 0 }, { UINT64_C(17092320570638341), 7237, 1024, 4, 21, 32, 141, 141, 0 },
+		{ UINT64_C(140737488355349), 2432, 1024, 24, 1, 32, 0, 0, 0 }, { UINT64_C(70918499991557), 3072, 1024, 26, 1, 16, 0, 0, 0 },
+		{ UINT64_C(352393477750853), 7168, 1024, 26, 2, 16, 0, 0, 0 }, { UINT64_C(70918499991621), 7168, 1024, 26, 2, 16, 0, 0, 0 },
+		{ UINT64_C(70922794958885), 3072, 1024, 26, 1, 16, 0, 0, 0 }, { UINT64_C(140746078290053), 3080, 1024, 12, 1, 32, 0, 0, 0 },
+		{ UINT64_C(703696031712261), 3080, 1024, 16, 1, 32, 0, 0, 0 }, { UINT64_C(141295834104069), 3080, 1024, 15, 1, 32, 0, 0, 0 },
+		{ UINT64_C(141295834104069), 3080, 1024, 14, 1, 32, 0, 0, 0 }, { UINT64_C(140746078290181), 3080, 1024, 17, 1, 32, 0, 0, 0 },
+		{ UINT64_C(141295834103813), 3080, 1024, 16, 1, 32, 0, 0, 0 }, { UINT64_C(4294967325), 128, 1024, 22, 1, 16, 0, 0, 0 }, { UINT64_C(4294967325), 128, 1024, 23, 1, 16, 0, 0, 0 },
+		{ UINT64_C(70918499991589), 3072, 1024, 26, 1, 16, 0, 0, 0 }, { UINT64_C(140737488355349), 2432, 4096, 24, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140747152032261), 3080, 1024, 16, 1, 32, 0, 0, 0 }, { UINT64_C(11399736556781573), 7176, 1024, 11, 1, 32, 0, 0, 0 },
+		{ UINT64_C(11962686510203909), 7176, 1024, 11, 1, 32, 0, 0, 0 }, { UINT64_C(140746078289925), 3080, 1024, 17, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140746078289925), 3080, 1024, 13, 1, 32, 0, 0, 0 }, { UINT64_C(140747152032261), 3080, 6144, 16, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140747152032261), 3080, 4096, 16, 1, 32, 0, 0, 0 }, { UINT64_C(140746078289925), 3080, 4096, 16, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140746078289925), 3080, 6144, 16, 1, 32, 0, 0, 0 }, { UINT64_C(703696031711237), 3072, 6144, 20, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140746078290053), 3080, 7168, 16, 1, 32, 0, 0, 0 }, { UINT64_C(11399736556781573), 7176, 7168, 11, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140746078289925), 3080, 8192, 16, 1, 32, 0, 0, 0 }, { UINT64_C(140737488355349), 2432, 6144, 24, 1, 32, 0, 0, 0 },
+		{ UINT64_C(70918499991557), 3072, 6144, 26, 1, 16, 0, 0, 0 }, { UINT64_C(633868453413893), 3072, 6144, 26, 1, 16, 0, 0, 0 },
+		{ UINT64_C(633868453413893), 3072, 10240, 26, 1, 32, 0, 0, 0 }, { UINT64_C(70368777732097), 0, 0, 27, 0, 32, 0, 0, 0 }, { UINT64_C(70918499991589), 3072, 15360, 26, 1, 32, 0, 0, 0 },
+		{ UINT64_C(17065313883521029), 7235, 6144, 1, 34, 32, 0, 0, 0 }, { UINT64_C(703687441776645), 3072, 1024, 20, 1, 32, 0, 0, 0 },
+		{ UINT64_C(703687441776773), 3072, 1024, 20, 1, 32, 0, 0, 0 }, { UINT64_C(703687441777669), 3080, 1024, 17, 1, 32, 0, 0, 0 },
+		{ UINT64_C(703687441777669), 3080, 1024, 13, 1, 32, 0, 0, 0 }, { UINT64_C(17065313816412165), 7235, 1024, 1, 34, 32, 0, 0, 0 },
+		{ UINT64_C(17065313816412165), 7235, 12288, 1, 34, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 1024, 18, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 2048, 18, 1, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 3072, 18, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 4096, 18, 1, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 6144, 18, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 8192, 18, 1, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 11264, 18, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 12288, 18, 1, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 14336, 18, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 16384, 18, 1, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 17408, 18, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 19456, 18, 1, 32, 0, 0, 0 }, { UINT64_C(12103973754373125), 7168, 1024, 7, 2, 16, 0, 0, 0 },
+		{ UINT64_C(282024732524549), 7168, 1024, 6, 2, 16, 0, 0, 0 }, { UINT64_C(282024732524549), 7168, 4096, 6, 2, 16, 0, 0, 0 },
+		{ UINT64_C(282024732524549), 7168, 6144, 6, 2, 16, 0, 0, 0 }, { UINT64_C(12103973754373125), 7168, 6144, 7, 2, 16, 0, 0, 0 },
+		{ UINT64_C(12103973754373125), 7168, 8192, 7, 2, 16, 0, 0, 0 }, { UINT64_C(12103973754373125), 7168, 9216, 7, 2, 16, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 1024, 21, 1, 32, 0, 0, 0 }, { UINT64_C(17627782733366277), 7237, 1024, 4, 1, 32, 0, 0, 0 },
+		{ UINT64_C(17627714013889541), 7235, 1024, 0, 1, 32, 0, 0, 0 }, { UINT64_C(17592186312851461), 3072, 1024, 20, 1, 32, 0, 0, 0 },
+		{ UINT64_C(17092320570638341), 7237, 1024, 4, 21, 32, 142, 142, 0 }, { UINT64_C(703687441777669), 3072, 1024, 21, 1, 32, 0, 0, 0 },
+		{ UINT64_C(17092320570638341), 7237, 1024, 4, 34, 32, 143, 143, 0 }, { UINT64_C(17092320570638341), 7237, 1024, 4, 34, 32, 144, 144, 0 },
+		{ UINT64_C(17029236359430149), 3072, 1024, 21, 1, 32, 0, 0, 0 }, { UINT64_C(17092320570638341), 7237, 1024, 4, 34, 32, 145, 145, 0 },
+		{ UINT64_C(17627370416505861), 7233, 1024, 2, 1, 32, 0, 0, 0 }, { UINT64_C(17064764060467205), 7235, 4096, 0, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 4096, 21, 1, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 7168, 21, 1, 32, 0, 0, 0 },
+		{ UINT64_C(17627714013889541), 7235, 8192, 0, 1, 32, 0, 0, 0 }, { UINT64_C(17627714013889541), 7235, 6144, 0, 1, 32, 0, 0, 0 },
+		{ UINT64_C(17627782733366277), 7237, 6144, 4, 1, 32, 0, 0, 0 }, { UINT64_C(703687441776645), 3072, 6144, 20, 1, 32, 0, 0, 0 },
+		{ UINT64_C(17627714080998405), 7235, 6144, 0, 1, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 6144, 21, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 8192, 21, 1, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 9216, 21, 1, 32, 0, 0, 0 },
+		{ UINT64_C(17088953316278277), 7235, 9216, 0, 34, 32, 0, 0, 146 }, { UINT64_C(140737488355333), 3072, 10240, 21, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 11264, 10, 1, 32, 0, 0, 0 }, { UINT64_C(17092320570900485), 7237, 1024, 9, 34, 32, 147, 147, 0 },
+		{ UINT64_C(17088953316409349), 7235, 1024, 9, 34, 32, 0, 0, 148 }, { UINT64_C(17064420463083525), 7233, 1024, 9, 34, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 10240, 9, 34, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 17408, 21, 1, 32, 0, 0, 0 },
+		{ UINT64_C(703696031711237), 3072, 1101, 20, 1, 32, 0, 0, 0 }, { UINT64_C(703696031712261), 3072, 1101, 21, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140746078289925), 3072, 1101, 21, 1, 32, 0, 0, 0 }, { UINT64_C(140746078289925), 3072, 4173, 21, 1, 32, 0, 0, 0 },
+		{ UINT64_C(703696031711237), 3072, 6221, 20, 1, 32, 0, 0, 0 }, { UINT64_C(703696031711365), 3072, 1024, 20, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140746078289925), 3072, 4096, 21, 1, 32, 0, 0, 0 }, { UINT64_C(703696031712261), 3080, 1024, 17, 1, 32, 0, 0, 0 },
+		{ UINT64_C(703696031712261), 3080, 1024, 13, 1, 32, 0, 0, 0 }, { UINT64_C(703696031712261), 3072, 6144, 21, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140746078289925), 3072, 6144, 21, 1, 32, 0, 0, 0 }, { UINT64_C(140746078289925), 3072, 7168, 21, 1, 32, 0, 0, 0 },
+		{ UINT64_C(703696031712261), 3072, 7168, 21, 1, 32, 0, 0, 0 }, { UINT64_C(140746078289925), 3072, 8192, 21, 1, 32, 0, 0, 0 },
+		{ UINT64_C(703696031711237), 3072, 9216, 20, 1, 32, 0, 0, 0 }, { UINT64_C(703696031712261), 3072, 9216, 21, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140746078289925), 3072, 9216, 21, 1, 32, 0, 0, 0 }, { UINT64_C(140746078289925), 3072, 11264, 21, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140746078289925), 3072, 12288, 21, 1, 32, 0, 0, 0 }, { UINT64_C(140746078289925), 3072, 16384, 21, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140746078289925), 3072, 18432, 21, 1, 32, 0, 0, 0 }, { UINT64_C(140746078289925), 3072, 19456, 21, 1, 32, 0, 0, 0 },
+		{ UINT64_C(8589934593), 0, 0, 27, 0, 32, 0, 0, 0 }, { UINT64_C(203821968269317), 7237, 1024, 21, 1, 32, 149, 149, 0 }, { UINT64_C(200454713778181), 7235, 1024, 21, 1, 32, 0, 0, 150 },
+		{ UINT64_C(140737488355333), 3072, 6144, 10, 1, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 7168, 10, 1, 32, 0, 0, 0 },
+		{ UINT64_C(703696031712261), 3072, 1024, 21, 1, 32, 0, 0, 0 }, { UINT64_C(140746078289925), 3072, 10240, 21, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140746078289925), 3072, 16471, 21, 1, 32, 0, 0, 0 }, { UINT64_C(140746078289925), 3072, 1111, 21, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140746078289925), 3072, 12375, 21, 1, 32, 0, 0, 0 }, { UINT64_C(140746078289925), 3072, 11351, 21, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140746078289925), 3080, 6231, 17, 1, 32, 0, 0, 0 }, { UINT64_C(140746078289925), 3080, 6231, 13, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 1111, 10, 1, 32, 0, 0, 0 }, { UINT64_C(703696031711237), 3072, 8192, 20, 1, 32, 0, 0, 0 },
+		{ UINT64_C(703696031712261), 3080, 8192, 17, 1, 32, 0, 0, 0 }, { UINT64_C(703696031712261), 3080, 8192, 13, 1, 32, 0, 0, 0 },
+		{ UINT64_C(703696031711237), 3072, 13312, 20, 1, 32, 0, 0, 0 }, { UINT64_C(703696031711237), 3072, 10240, 20, 1, 32, 0, 0, 0 },
+		{ UINT64_C(703696031711237), 3072, 12288, 20, 1, 32, 0, 0, 0 }, { UINT64_C(703696031712261), 3080, 6144, 17, 1, 32, 0, 0, 0 },
+		{ UINT64_C(703696031712261), 3080, 6144, 13, 1, 32, 0, 0, 0 }, { UINT64_C(703696031712261), 3080, 10240, 17, 1, 32, 0, 0, 0 },
+		{ UINT64_C(703696031712261), 3080, 10240, 13, 1, 32, 0, 0, 0 }, { UINT64_C(140746078289925), 3072, 4096, 21, 7, 32, 0, 0, 0 },
+		{ UINT64_C(140746078289925), 3072, 17408, 21, 1, 32, 0, 0, 0 }, { UINT64_C(17092320570638341), 7237, 8287, 4, 19, 32, 104, 104, 0 },
+		{ UINT64_C(1), 0, 95, 27, 0, 32, 0, 0, 0 }, { UINT64_C(17088953316278277), 7235, 8287, 0, 19, 32, 0, 0, 95 }, { UINT64_C(17092320570638341), 7237, 9216, 4, 34, 32, 151, 151, 0 },
+		{ UINT64_C(17092320570638341), 7237, 9216, 4, 34, 32, 152, 152, 0 }, { UINT64_C(17092320570638341), 7237, 9216, 4, 34, 32, 153, 153, 0 },
+		{ UINT64_C(17088953316278277), 7235, 9216, 0, 34, 32, 0, 0, 154 }, { UINT64_C(17088953316278277), 7235, 9216, 0, 34, 32, 0, 0, 155 },
+		{ UINT64_C(17092320570638341), 7237, 10240, 4, 34, 32, 156, 156, 0 }, { UINT64_C(17092320570638341), 7237, 10240, 4, 34, 32, 157, 157, 0 },
+		{ UINT64_C(17092320570638341), 7237, 10240, 4, 34, 32, 158, 158, 0 }, { UINT64_C(17092320570638341), 7237, 11264, 4, 34, 32, 159, 159, 0 },
+		{ UINT64_C(17064764060467205), 7235, 9216, 0, 34, 32, 0, 0, 0 }, { UINT64_C(17065313883521029), 7235, 10240, 1, 34, 32, 0, 0, 0 },
+		{ UINT64_C(17065313816412165), 7235, 10240, 1, 34, 32, 0, 0, 0 }, { UINT64_C(17092320570638341), 7237, 11264, 4, 34, 32, 160, 160, 0 },
+		{ UINT64_C(17092320570638341), 7237, 8289, 4, 12, 32, 7, 7, 0 }, { UINT64_C(17088953316278277), 7235, 8289, 0, 12, 32, 0, 0, 8 },
+		{ UINT64_C(17064764060467205), 7235, 8289, 0, 12, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 8289, 21, 12, 32, 0, 0, 0 },
+		{ UINT64_C(17092320570638341), 7237, 11361, 4, 12, 32, 7, 7, 0 }, { UINT64_C(17088953316278277), 7235, 11361, 0, 12, 32, 0, 0, 8 },
+		{ UINT64_C(11541023800983557), 7168, 11361, 7, 12, 16, 0, 0, 0 }, { UINT64_C(17092320570638341), 7237, 13409, 4, 12, 32, 7, 7, 0 },
+		{ UINT64_C(17088953316278277), 7235, 13409, 0, 12, 32, 0, 0, 8 }, { UINT64_C(1), 0, 97, 27, 0, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3080, 8289, 16, 12, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 8289, 10, 12, 32, 0, 0, 0 }, { UINT64_C(17088953316278277), 7235, 8228, 0, 18, 32, 0, 0, 161 },
+		{ UINT64_C(17088953316278277), 7235, 13348, 0, 18, 32, 0, 0, 161 }, { UINT64_C(17064420463083525), 7233, 8291, 2, 59, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 13411, 2, 59, 32, 0, 0, 0 }, { UINT64_C(1), 0, 99, 27, 0, 32, 0, 0, 0 }, { UINT64_C(17064970218897413), 7233, 8291, 1, 59, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3080, 12387, 16, 59, 32, 0, 0, 0 }, { UINT64_C(11541023800950789), 7168, 12387, 7, 59, 16, 0, 0, 0 },
+		{ UINT64_C(11576208173047813), 7233, 10249, 7, 14, 16, 0, 0, 0 }, { UINT64_C(140746078289925), 3080, 8192, 15, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140746078289925), 3080, 8192, 14, 1, 32, 0, 0, 0 }, { UINT64_C(140746078290053), 3080, 8192, 12, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140746078289925), 3080, 10240, 16, 1, 32, 0, 0, 0 }, { UINT64_C(140746078290053), 3080, 10240, 12, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140746078289925), 3080, 10240, 15, 1, 32, 0, 0, 0 }, { UINT64_C(140746078289925), 3080, 10240, 14, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140746078289925), 3080, 10240, 17, 1, 32, 0, 0, 0 }, { UINT64_C(140746078289925), 3080, 10240, 13, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140747152032261), 3080, 10240, 16, 1, 32, 0, 0, 0 }, { UINT64_C(176480206225413), 7233, 10240, 1, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140746078289925), 3080, 11264, 16, 1, 32, 0, 0, 0 }, { UINT64_C(140746078289925), 3080, 13312, 16, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140746078290053), 3080, 13312, 12, 1, 32, 0, 0, 0 }, { UINT64_C(140747152032261), 3080, 16384, 16, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140746078289925), 3080, 16384, 16, 1, 32, 0, 0, 0 }, { UINT64_C(140746078290053), 3080, 16384, 12, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140746078290437), 3080, 16384, 16, 1, 32, 0, 0, 0 }, { UINT64_C(140746078290181), 3080, 16384, 17, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140746078289925), 3080, 18432, 16, 1, 32, 0, 0, 0 }, { UINT64_C(140746078289925), 3080, 19456, 16, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140737496743941), 3072, 4096, 21, 24, 32, 0, 0, 0 }, { UINT64_C(140737490452485), 3072, 4096, 21, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140746078290437), 3080, 1024, 16, 1, 32, 0, 0, 0 }, { UINT64_C(17064970218962949), 7233, 1024, 1, 24, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463099909), 7233, 1024, 2, 1, 32, 0, 0, 0 }, { UINT64_C(17064420463099909), 7233, 1024, 9, 24, 32, 0, 0, 0 },
+		{ UINT64_C(140746078290181), 3080, 1024, 13, 1, 32, 0, 0, 0 }, { UINT64_C(11540474046218245), 7168, 1024, 5, 25, 32, 0, 0, 0 },
+		{ UINT64_C(17064970218962949), 7233, 1024, 1, 1, 32, 0, 0, 0 }, { UINT64_C(17064420463099909), 7233, 4096, 9, 24, 32, 0, 0, 0 },
+		{ UINT64_C(17064970218897413), 7233, 6144, 1, 24, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 6144, 2, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3080, 6144, 16, 1, 32, 0, 0, 0 }, { UINT64_C(1), 0, 107, 27, 0, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 1131, 2, 28, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 6251, 2, 28, 32, 0, 0, 0 }, { UINT64_C(11541023800983557), 7168, 1131, 7, 2, 16, 0, 0, 0 },
+		{ UINT64_C(3518987233165317), 3072, 1131, 19, 1, 32, 0, 0, 0 }, { UINT64_C(17064970218962949), 7233, 1131, 1, 28, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355461), 3080, 6252, 12, 1, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 1132, 2, 30, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3080, 1132, 16, 1, 32, 0, 0, 0 }, { UINT64_C(17064970218995717), 7233, 1132, 1, 1, 32, 0, 0, 0 },
+		{ UINT64_C(17064970218962949), 7233, 1132, 1, 30, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 6252, 2, 30, 32, 0, 0, 0 },
+		{ UINT64_C(1), 0, 109, 27, 0, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 1133, 2, 6, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 10349, 2, 6, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 19565, 2, 6, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 1135, 21, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 1135, 10, 1, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 4205, 2, 6, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 12397, 2, 6, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 1024, 21, 25, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 7168, 21, 25, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 11264, 21, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 8192, 21, 25, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 1024, 21, 30, 32, 0, 0, 0 },
+		{ UINT64_C(17064420479877125), 7233, 4096, 2, 24, 32, 0, 0, 0 }, { UINT64_C(17064420479877125), 7233, 1024, 2, 24, 32, 0, 0, 0 },
+		{ UINT64_C(17064420479877125), 7233, 8192, 2, 24, 32, 0, 0, 0 }, { UINT64_C(17064420479877125), 7233, 10240, 2, 24, 32, 0, 0, 0 },
+		{ UINT64_C(17064420479877125), 7233, 11264, 2, 24, 32, 0, 0, 0 }, { UINT64_C(17064420479877125), 7233, 13312, 2, 24, 32, 0, 0, 0 },
+		{ UINT64_C(17064420479877125), 7233, 17408, 2, 24, 32, 0, 0, 0 }, { UINT64_C(17064420479877125), 7233, 19456, 2, 24, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 4096, 2, 61, 32, 0, 0, 0 }, { UINT64_C(17064970218962949), 7233, 4096, 1, 61, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 4096, 21, 61, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 6144, 21, 61, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 11386, 2, 86, 32, 0, 0, 0 }, { UINT64_C(17064970218897413), 7233, 11386, 1, 86, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355845), 3080, 11386, 16, 86, 32, 0, 0, 0 }, { UINT64_C(140738562097669), 3080, 11386, 16, 86, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 10363, 2, 77, 32, 0, 0, 0 }, { UINT64_C(17064970218962949), 7233, 10363, 1, 77, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355845), 3080, 10363, 16, 77, 32, 0, 0, 0 }, { UINT64_C(140738562097669), 3080, 10363, 16, 77, 32, 0, 0, 0 },
+		{ UINT64_C(11399736556781573), 7280, 10363, 8, 77, 32, 0, 0, 0 }, { UINT64_C(1), 0, 123, 27, 0, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 10249, 2, 14, 32, 0, 0, 0 },
+		{ UINT64_C(282024732524549), 7168, 10249, 6, 14, 16, 0, 0, 0 }, { UINT64_C(140737488355333), 3080, 10249, 16, 14, 32, 0, 0, 0 },
+		{ UINT64_C(11576208173047813), 7233, 13321, 7, 14, 16, 0, 0, 0 }, { UINT64_C(17064970218930181), 7233, 10249, 1, 14, 32, 0, 0, 0 },
+		{ UINT64_C(17065313816444933), 7235, 16393, 1, 14, 32, 0, 0, 0 }, { UINT64_C(11576208173047813), 7233, 17417, 7, 14, 16, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 11389, 2, 79, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 11389, 9, 79, 32, 0, 0, 0 },
+		{ UINT64_C(11541023800983557), 7168, 11389, 7, 79, 16, 0, 0, 0 }, { UINT64_C(140737488355333), 3080, 11389, 16, 79, 32, 0, 0, 0 },
+		{ UINT64_C(140738562097669), 3080, 11389, 16, 79, 32, 0, 0, 0 }, { UINT64_C(140737488355845), 3080, 11389, 16, 79, 32, 0, 0, 0 },
+		{ UINT64_C(1), 0, 125, 27, 0, 32, 0, 0, 0 }, { UINT64_C(141287244169221), 3072, 8192, 19, 1, 32, 0, 0, 0 }, { UINT64_C(17064970218930181), 7233, 9216, 1, 1, 32, 0, 0, 0 },
+		{ UINT64_C(17064970218930181), 7233, 10240, 1, 1, 32, 0, 0, 0 }, { UINT64_C(141287244201989), 3072, 9216, 19, 1, 32, 0, 0, 0 },
+		{ UINT64_C(17092320570638341), 7237, 10240, 4, 34, 32, 162, 162, 0 }, { UINT64_C(141287244169221), 3072, 10240, 19, 1, 32, 0, 0, 0 },
+		{ UINT64_C(17092320570638341), 7237, 12288, 4, 34, 32, 163, 163, 0 }, { UINT64_C(17064764060467205), 7235, 12288, 0, 34, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 17408, 2, 34, 32, 0, 0, 0 }, { UINT64_C(17092320570638341), 7237, 12288, 4, 34, 32, 7, 7, 0 },
+		{ UINT64_C(17088953316278277), 7235, 12288, 0, 34, 32, 0, 0, 8 }, { UINT64_C(17092320570638341), 7237, 13312, 4, 34, 32, 7, 7, 0 },
+		{ UINT64_C(17088953316278277), 7235, 13312, 0, 34, 32, 0, 0, 8 }, { UINT64_C(17064764060467205), 7235, 16384, 0, 34, 32, 0, 0, 0 },
+		{ UINT64_C(17092320570638341), 7237, 16384, 4, 34, 32, 7, 7, 0 }, { UINT64_C(17088953316278277), 7235, 16384, 0, 34, 32, 0, 0, 8 },
+		{ UINT64_C(17092320570638341), 7237, 13312, 4, 34, 32, 164, 164, 0 }, { UINT64_C(17092320570638341), 7237, 16384, 4, 34, 32, 165, 165, 0 },
+		{ UINT64_C(17092320570638341), 7237, 16384, 4, 34, 32, 166, 166, 0 }, { UINT64_C(17092320570638341), 7237, 16384, 4, 34, 32, 167, 167, 0 },
+		{ UINT64_C(17092320570638341), 7237, 18432, 4, 34, 32, 164, 164, 0 }, { UINT64_C(17092320570638341), 7237, 16384, 4, 34, 32, 168, 168, 0 },
+		{ UINT64_C(17092320570638341), 7237, 16384, 4, 34, 32, 169, 169, 0 }, { UINT64_C(17092320570638341), 7237, 17408, 4, 34, 32, 170, 170, 0 },
+		{ UINT64_C(17092320570638341), 7237, 17408, 4, 34, 32, 171, 171, 0 }, { UINT64_C(17092320570638341), 7237, 17408, 4, 34, 32, 7, 7, 0 },
+		{ UINT64_C(17088953316278277), 7235, 17408, 0, 34, 32, 0, 0, 8 }, { UINT64_C(17064420463083525), 7233, 16384, 2, 34, 32, 0, 0, 0 },
+		{ UINT64_C(17065313816444933), 7235, 13312, 1, 34, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 10240, 2, 34, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 8192, 2, 49, 32, 0, 0, 0 }, { UINT64_C(11541023800950789), 7168, 8192, 7, 49, 16, 0, 0, 0 },
+		{ UINT64_C(11434920928878597), 7233, 8192, 5, 49, 32, 0, 0, 0 }, { UINT64_C(11576208173047813), 7233, 8192, 7, 49, 16, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 8192, 21, 49, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 9346, 2, 65, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3080, 9346, 16, 65, 32, 0, 0, 0 }, { UINT64_C(140738562097669), 3080, 9346, 16, 65, 32, 0, 0, 0 },
+		{ UINT64_C(1), 0, 130, 27, 0, 32, 0, 0, 0 }, { UINT64_C(11434920928878597), 7233, 10371, 5, 75, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 10371, 2, 75, 32, 0, 0, 0 },
+		{ UINT64_C(11541023800983557), 7168, 10371, 7, 75, 16, 0, 0, 0 }, { UINT64_C(11576208173047813), 7233, 18563, 7, 75, 16, 0, 0, 0 },
+		{ UINT64_C(1), 0, 131, 27, 0, 32, 0, 0, 0 }, { UINT64_C(140738562097669), 3080, 10371, 16, 75, 32, 0, 0, 0 }, { UINT64_C(11399736556781573), 7280, 10371, 8, 75, 32, 0, 0, 0 },
+		{ UINT64_C(11541023800983557), 7168, 11286, 7, 16, 16, 0, 0, 0 }, { UINT64_C(140737488355333), 3080, 11286, 16, 16, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3080, 17430, 16, 16, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 17430, 2, 16, 32, 0, 0, 0 },
+		{ UINT64_C(1), 0, 22, 27, 0, 32, 0, 0, 0 }, { UINT64_C(11399736556781573), 7280, 10240, 8, 69, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 10240, 2, 69, 32, 0, 0, 0 },
+		{ UINT64_C(11576208173047813), 7233, 10240, 7, 69, 16, 0, 0, 0 }, { UINT64_C(11541023800983557), 7168, 10240, 7, 69, 16, 0, 0, 0 },
+		{ UINT64_C(140737488388101), 3080, 10240, 16, 1, 32, 0, 0, 0 }, { UINT64_C(140738562097669), 3080, 10240, 16, 69, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 10374, 2, 74, 32, 0, 0, 0 }, { UINT64_C(11576208173047813), 7233, 10374, 7, 74, 16, 0, 0, 0 },
+		{ UINT64_C(11434920928878597), 7233, 10374, 5, 74, 32, 0, 0, 0 }, { UINT64_C(11399736556814341), 7168, 10374, 5, 74, 32, 0, 0, 0 },
+		{ UINT64_C(1), 0, 134, 27, 0, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3080, 10374, 16, 74, 32, 0, 0, 0 }, { UINT64_C(11576208173047813), 7233, 11400, 7, 84, 16, 0, 0, 0 },
+		{ UINT64_C(11434920928878597), 7233, 11400, 5, 84, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 11400, 2, 84, 32, 0, 0, 0 },
+		{ UINT64_C(11541023800983557), 7168, 11400, 7, 84, 16, 0, 0, 0 }, { UINT64_C(11399736556814341), 7168, 11400, 5, 84, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3080, 11400, 16, 84, 32, 0, 0, 0 }, { UINT64_C(140737488355845), 3080, 11400, 16, 84, 32, 0, 0, 0 },
+		{ UINT64_C(140738562097669), 3080, 11400, 16, 84, 32, 0, 0, 0 }, { UINT64_C(1), 0, 136, 27, 0, 32, 0, 0, 0 }, { UINT64_C(17064970218962949), 7233, 11400, 1, 1, 32, 0, 0, 0 },
+		{ UINT64_C(11399736556781573), 7280, 11400, 8, 84, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 16419, 2, 39, 32, 0, 0, 0 },
+		{ UINT64_C(11541023800983557), 7168, 16419, 7, 39, 16, 0, 0, 0 }, { UINT64_C(17064970218962949), 7233, 16419, 1, 39, 32, 0, 0, 0 },
+		{ UINT64_C(11399736556781573), 7280, 16419, 8, 39, 32, 0, 0, 0 }, { UINT64_C(1), 0, 35, 27, 0, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 10378, 2, 68, 32, 0, 0, 0 },
+		{ UINT64_C(11576208173047813), 7233, 10378, 7, 68, 16, 0, 0, 0 }, { UINT64_C(11434920928878597), 7233, 10378, 5, 68, 32, 0, 0, 0 },
+		{ UINT64_C(1), 0, 138, 27, 0, 32, 0, 0, 0 }, { UINT64_C(11399736556781573), 7280, 10378, 8, 68, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3080, 10378, 16, 68, 32, 0, 0, 0 },
+		{ UINT64_C(140738562097669), 3080, 10378, 16, 68, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 11299, 2, 39, 32, 0, 0, 0 },
+		{ UINT64_C(17064970218962949), 7233, 11299, 1, 39, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 11299, 21, 39, 32, 0, 0, 0 },
+		{ UINT64_C(11399736556814341), 7168, 16419, 5, 39, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 11264, 2, 92, 32, 0, 0, 0 },
+		{ UINT64_C(11576208173047813), 7233, 11264, 7, 92, 16, 0, 0, 0 }, { UINT64_C(17064420597301253), 7233, 11264, 2, 92, 32, 0, 0, 0 },
+		{ UINT64_C(11541023800983557), 7168, 11264, 7, 92, 16, 0, 0, 0 }, { UINT64_C(17064420463116293), 7233, 11264, 2, 92, 32, 0, 0, 0 },
+		{ UINT64_C(17064970218962949), 7233, 11264, 1, 92, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3080, 11264, 16, 92, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355845), 3080, 11264, 16, 92, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 13312, 2, 87, 32, 0, 0, 0 },
+		{ UINT64_C(11434920928878597), 7233, 13312, 5, 87, 32, 0, 0, 0 }, { UINT64_C(11576208173047813), 7233, 13312, 7, 87, 16, 0, 0, 0 },
+		{ UINT64_C(140738562097669), 3080, 13312, 16, 87, 32, 0, 0, 0 }, { UINT64_C(17064970218962949), 7233, 13312, 1, 87, 32, 0, 0, 0 },
+		{ UINT64_C(11541023800983557), 7168, 13312, 7, 87, 16, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 12326, 2, 17, 32, 0, 0, 0 },
+		{ UINT64_C(17088953316278277), 7235, 16384, 0, 34, 32, 0, 0, 172 }, { UINT64_C(141287244201989), 3072, 16384, 19, 1, 32, 0, 0, 0 },
+		{ UINT64_C(17065313816444933), 7235, 16384, 1, 34, 32, 0, 0, 0 }, { UINT64_C(17064764060467205), 7235, 17408, 0, 34, 32, 0, 0, 0 },
+		{ UINT64_C(17064764060467205), 7235, 16384, 0, 21, 32, 0, 0, 0 }, { UINT64_C(17097749409300485), 7235, 17448, 0, 11, 32, 173, 0, 173 },
+		{ UINT64_C(17064420463083525), 7233, 11264, 2, 87, 32, 0, 0, 0 }, { UINT64_C(11434920928878597), 7233, 11264, 5, 87, 32, 0, 0, 0 },
+		{ UINT64_C(11576208173047813), 7233, 11264, 7, 87, 16, 0, 0, 0 }, { UINT64_C(140738562097669), 3080, 11264, 16, 87, 32, 0, 0, 0 },
+		{ UINT64_C(11399736556814341), 7168, 11264, 5, 87, 32, 0, 0, 0 }, { UINT64_C(11541023800983557), 7168, 11264, 7, 87, 16, 0, 0, 0 },
+		{ UINT64_C(11399736556781573), 7280, 11264, 8, 87, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 2048, 2, 25, 32, 0, 0, 0 },
+		{ UINT64_C(5), 0, 2048, 29, 0, 32, 0, 0, 0 }, { UINT64_C(5), 3072, 1024, 28, 0, 32, 0, 0, 0 }, { UINT64_C(17064420463099909), 7233, 1024, 2, 24, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463099909), 7233, 13312, 2, 24, 32, 0, 0, 0 }, { UINT64_C(17064420463099909), 7233, 6144, 2, 24, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463099909), 7233, 11264, 2, 24, 32, 0, 0, 0 }, { UINT64_C(17064420463099909), 7233, 8192, 2, 24, 32, 0, 0, 0 },
+		{ UINT64_C(17097749409300485), 7235, 1024, 0, 4, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 4096, 2, 27, 32, 0, 0, 0 },
+		{ UINT64_C(11576208173080581), 7233, 1024, 7, 27, 16, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 1024, 2, 27, 32, 0, 0, 0 },
+		{ UINT64_C(703687441776645), 3072, 1024, 20, 27, 32, 0, 0, 0 }, { UINT64_C(141287244169221), 3072, 12301, 19, 3, 32, 0, 0, 0 },
+		{ UINT64_C(3553621580972037), 7233, 1037, 2, 3, 32, 0, 0, 0 }, { UINT64_C(140746078289925), 3080, 1037, 13, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140746078289925), 3080, 1037, 17, 1, 32, 0, 0, 0 }, { UINT64_C(524289), 0, 5133, 27, 0, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 6157, 18, 3, 32, 0, 0, 0 },
+		{ UINT64_C(11611394692612101), 7168, 6144, 7, 2, 16, 0, 0, 0 }, { UINT64_C(140737488355333), 3080, 8192, 16, 1, 32, 0, 0, 0 },
+		{ UINT64_C(141287244169221), 3080, 8192, 16, 1, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3080, 8192, 17, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3080, 8192, 13, 1, 32, 0, 0, 0 }, { UINT64_C(11541023800983557), 7168, 17408, 7, 14, 16, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3080, 1024, 16, 1, 32, 0, 0, 0 }, { UINT64_C(140737488355461), 3080, 1024, 12, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3080, 1024, 17, 1, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3080, 1024, 13, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355589), 3080, 1024, 17, 1, 32, 0, 0, 0 }, { UINT64_C(140737488355589), 3080, 1024, 13, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3080, 7168, 17, 1, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3080, 7168, 13, 1, 32, 0, 0, 0 },
+		{ UINT64_C(141288317911557), 3080, 1024, 16, 1, 32, 0, 0, 0 }, { UINT64_C(141287244169733), 3080, 1024, 16, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140738562097669), 3080, 1024, 16, 1, 32, 0, 0, 0 }, { UINT64_C(703687441777669), 3080, 1024, 16, 1, 32, 0, 0, 0 },
+		{ UINT64_C(703687441777797), 3080, 1024, 12, 1, 32, 0, 0, 0 }, { UINT64_C(70918499991557), 3072, 1037, 26, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355589), 3080, 1024, 16, 1, 32, 0, 0, 0 }, { UINT64_C(141287244169477), 3080, 1024, 16, 1, 32, 0, 0, 0 },
+		{ UINT64_C(11399736556783621), 7280, 1024, 8, 1, 32, 0, 0, 0 }, { UINT64_C(17092320570640389), 7269, 1024, 4, 34, 32, 1, 1, 0 },
+		{ UINT64_C(704237197624325), 3072, 1024, 19, 1, 32, 0, 0, 0 }, { UINT64_C(17088953316280325), 7267, 1024, 0, 34, 32, 0, 0, 2 },
+		{ UINT64_C(140737488355333), 3080, 6144, 17, 1, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3080, 6144, 13, 1, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 1024, 2, 30, 32, 0, 0, 0 }, { UINT64_C(12702108080963589), 7233, 1024, 1, 1, 32, 0, 0, 0 },
+		{ UINT64_C(70368777732097), 0, 162, 27, 0, 32, 0, 0, 0 }, { UINT64_C(549755813893), 3072, 4258, 26, 1, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 3234, 21, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 1186, 21, 1, 32, 0, 0, 0 }, { UINT64_C(524289), 0, 1186, 27, 0, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 7168, 2, 36, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3080, 7168, 16, 1, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 8192, 9, 21, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 8192, 10, 21, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 8192, 21, 21, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 16384, 10, 21, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 16384, 21, 21, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 18432, 21, 21, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 10409, 2, 71, 32, 0, 0, 0 },
+		{ UINT64_C(1), 0, 169, 27, 0, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 10410, 2, 67, 32, 0, 0, 0 }, { UINT64_C(1), 0, 170, 27, 0, 32, 0, 0, 0 },
+		{ UINT64_C(11541023800983557), 7168, 16481, 7, 2, 16, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 16481, 10, 1, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 5120, 2, 42, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 16384, 2, 42, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 5120, 10, 42, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 19456, 2, 42, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 5293, 2, 20, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 5293, 9, 20, 32, 0, 0, 0 },
+		{ UINT64_C(1), 0, 173, 27, 0, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 16384, 2, 118, 32, 0, 0, 0 }, { UINT64_C(11576208173047813), 7233, 16384, 7, 118, 16, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 7343, 2, 60, 32, 0, 0, 0 }, { UINT64_C(1), 0, 175, 27, 0, 32, 0, 0, 0 }, { UINT64_C(140737488355845), 3080, 7343, 16, 60, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 8192, 2, 43, 32, 0, 0, 0 }, { UINT64_C(140737488355845), 3080, 8192, 16, 43, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 8192, 9, 43, 32, 0, 0, 0 }, { UINT64_C(17092320570638341), 7237, 5297, 4, 15, 32, 174, 174, 0 },
+		{ UINT64_C(17092320570638341), 7237, 7345, 4, 15, 32, 174, 174, 0 }, { UINT64_C(17088953316278277), 7235, 5297, 0, 15, 32, 0, 0, 175 },
+		{ UINT64_C(17088953316278277), 7235, 7345, 0, 15, 32, 0, 0, 175 }, { UINT64_C(17064420463083525), 7233, 7346, 2, 47, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 7347, 2, 45, 32, 0, 0, 0 }, { UINT64_C(1), 0, 179, 27, 0, 32, 0, 0, 0 }, { UINT64_C(11399736556781573), 7280, 7347, 8, 45, 32, 0, 0, 0 },
+		{ UINT64_C(17092320570638341), 7237, 18612, 4, 136, 32, 174, 174, 0 }, { UINT64_C(1), 0, 180, 27, 0, 32, 0, 0, 0 }, { UINT64_C(17088953316278277), 7235, 18612, 0, 136, 32, 0, 0, 175 },
+		{ UINT64_C(17064420463083525), 7233, 16565, 2, 106, 32, 0, 0, 0 }, { UINT64_C(1), 0, 181, 27, 0, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 16384, 2, 104, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3080, 16384, 16, 104, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 16384, 2, 110, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 7168, 2, 13, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 11264, 2, 81, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355845), 3080, 11264, 16, 81, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 11264, 10, 81, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 16570, 2, 120, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 16570, 21, 120, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 16570, 10, 120, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 16571, 2, 116, 32, 0, 0, 0 },
+		{ UINT64_C(1), 0, 187, 27, 0, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 16571, 10, 116, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 17596, 2, 128, 32, 0, 0, 0 },
+		{ UINT64_C(1), 0, 188, 27, 0, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 17596, 10, 128, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 9405, 2, 66, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 9405, 10, 66, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 11453, 10, 66, 32, 0, 0, 0 },
+		{ UINT64_C(1), 0, 189, 27, 0, 32, 0, 0, 0 }, { UINT64_C(140737488355845), 3080, 9405, 16, 66, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 10430, 2, 72, 32, 0, 0, 0 },
+		{ UINT64_C(1), 0, 190, 27, 0, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3080, 10430, 16, 72, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 13312, 2, 98, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 13312, 2, 97, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 17408, 10, 97, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 8385, 2, 31, 32, 0, 0, 0 }, { UINT64_C(11576208173047813), 7233, 8385, 7, 31, 16, 0, 0, 0 },
+		{ UINT64_C(1), 0, 193, 27, 0, 32, 0, 0, 0 }, { UINT64_C(11541023800950789), 7168, 8385, 7, 31, 16, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 8385, 10, 31, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3080, 8385, 16, 31, 32, 0, 0, 0 }, { UINT64_C(140738562097669), 3080, 8385, 16, 31, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 11264, 2, 88, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 11264, 10, 88, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3080, 11264, 16, 88, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 16384, 2, 117, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 16384, 10, 117, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 16580, 2, 112, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 16580, 21, 112, 32, 0, 0, 0 }, { UINT64_C(11541023800983557), 7168, 16580, 7, 112, 16, 0, 0, 0 },
+		{ UINT64_C(1), 0, 196, 27, 0, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 16580, 10, 112, 32, 0, 0, 0 }, { UINT64_C(140737488355845), 3080, 16580, 16, 112, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3080, 16580, 16, 112, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 11461, 2, 78, 32, 0, 0, 0 },
+		{ UINT64_C(1), 0, 197, 27, 0, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3080, 11461, 16, 78, 32, 0, 0, 0 }, { UINT64_C(140737488355845), 3080, 11461, 16, 78, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 11264, 2, 83, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 11264, 10, 83, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 11264, 2, 82, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 11264, 10, 82, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 16384, 2, 121, 32, 0, 0, 0 }, { UINT64_C(140737488355845), 3080, 16384, 16, 121, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 16384, 10, 121, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 11264, 2, 89, 32, 0, 0, 0 },
+		{ UINT64_C(17092320570638341), 7237, 17408, 4, 130, 32, 77, 77, 0 }, { UINT64_C(17088953316278277), 7235, 17408, 0, 130, 32, 0, 0, 82 },
+		{ UINT64_C(140737488355333), 3072, 17408, 10, 130, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 11264, 10, 3, 32, 0, 0, 0 },
+		{ UINT64_C(11434920928878597), 7233, 12492, 5, 94, 32, 0, 0, 0 }, { UINT64_C(11576208173047813), 7233, 12492, 7, 94, 16, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 12492, 2, 94, 32, 0, 0, 0 }, { UINT64_C(11541023800950789), 7168, 12492, 7, 94, 16, 0, 0, 0 },
+		{ UINT64_C(140738562097669), 3080, 12492, 16, 94, 32, 0, 0, 0 }, { UINT64_C(140737488355845), 3080, 12492, 16, 94, 32, 0, 0, 0 },
+		{ UINT64_C(1), 0, 204, 27, 0, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 12492, 10, 94, 32, 0, 0, 0 }, { UINT64_C(11399736556781573), 7280, 12492, 8, 94, 32, 0, 0, 0 },
+		{ UINT64_C(11541023800950789), 7168, 16588, 7, 94, 16, 0, 0, 0 }, { UINT64_C(11541023800950789), 7168, 11469, 7, 85, 16, 0, 0, 0 },
+		{ UINT64_C(11434920928878597), 7233, 11469, 5, 85, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 11469, 2, 85, 32, 0, 0, 0 },
+		{ UINT64_C(11576208173047813), 7233, 11469, 7, 85, 16, 0, 0, 0 }, { UINT64_C(11541023800983557), 7168, 11469, 7, 85, 16, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3080, 11469, 16, 85, 32, 0, 0, 0 }, { UINT64_C(566935683077), 3072, 11469, 26, 85, 32, 0, 0, 0 },
+		{ UINT64_C(140738562097669), 3080, 11469, 16, 85, 32, 0, 0, 0 }, { UINT64_C(1), 0, 205, 27, 0, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 13312, 2, 101, 32, 0, 0, 0 },
+		{ UINT64_C(11399736556781573), 7280, 13312, 8, 101, 32, 0, 0, 0 }, { UINT64_C(11576208173047813), 7233, 13519, 7, 96, 16, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 13519, 2, 96, 32, 0, 0, 0 }, { UINT64_C(11434920928878597), 7233, 13519, 5, 96, 32, 0, 0, 0 },
+		{ UINT64_C(11541023800983557), 7168, 13519, 7, 96, 16, 0, 0, 0 }, { UINT64_C(1), 0, 207, 27, 0, 32, 0, 0, 0 }, { UINT64_C(11399736556781573), 7280, 13519, 8, 96, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3080, 13519, 16, 96, 32, 0, 0, 0 }, { UINT64_C(140738562097669), 3080, 13519, 16, 96, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 16592, 2, 111, 32, 0, 0, 0 }, { UINT64_C(11541023800983557), 7168, 16592, 7, 111, 16, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3080, 16592, 16, 111, 32, 0, 0, 0 }, { UINT64_C(1), 0, 208, 27, 0, 32, 0, 0, 0 }, { UINT64_C(11576208173047813), 7233, 13521, 7, 100, 16, 0, 0, 0 },
+		{ UINT64_C(11434920928878597), 7233, 13521, 5, 100, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 13521, 2, 100, 32, 0, 0, 0 },
+		{ UINT64_C(11399736556814341), 7168, 13521, 5, 100, 32, 0, 0, 0 }, { UINT64_C(140738562097669), 3080, 13521, 16, 100, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3080, 13521, 16, 100, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3080, 17617, 16, 100, 32, 0, 0, 0 },
+		{ UINT64_C(11541023800983557), 7168, 17617, 7, 100, 16, 0, 0, 0 }, { UINT64_C(140738562097669), 3080, 16593, 16, 100, 32, 0, 0, 0 },
+		{ UINT64_C(1), 0, 209, 27, 0, 32, 0, 0, 0 }, { UINT64_C(11399736556781573), 7280, 13521, 8, 100, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 16593, 2, 100, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 17617, 2, 100, 32, 0, 0, 0 }, { UINT64_C(140738562097669), 3080, 17617, 16, 100, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 16415, 10, 48, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 16595, 2, 108, 32, 0, 0, 0 },
+		{ UINT64_C(1), 0, 211, 27, 0, 32, 0, 0, 0 }, { UINT64_C(11434920928878597), 7233, 16595, 5, 108, 32, 0, 0, 0 }, { UINT64_C(11576208173047813), 7233, 16595, 7, 108, 16, 0, 0, 0 },
+		{ UINT64_C(11399736556814341), 7168, 16595, 5, 108, 32, 0, 0, 0 }, { UINT64_C(11541023800983557), 7168, 16595, 7, 108, 16, 0, 0, 0 },
+		{ UINT64_C(140738562097669), 3080, 16595, 16, 108, 32, 0, 0, 0 }, { UINT64_C(140737488355845), 3080, 16595, 16, 108, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3080, 16595, 16, 108, 32, 0, 0, 0 }, { UINT64_C(11576208173047813), 7233, 18643, 7, 108, 16, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 17620, 2, 129, 32, 0, 0, 0 }, { UINT64_C(1), 0, 212, 27, 0, 32, 0, 0, 0 }, { UINT64_C(140738562097669), 3080, 17620, 16, 129, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 16597, 2, 109, 32, 0, 0, 0 }, { UINT64_C(11576208173047813), 7233, 16597, 7, 109, 16, 0, 0, 0 },
+		{ UINT64_C(11434920928878597), 7233, 16597, 5, 109, 32, 0, 0, 0 }, { UINT64_C(11541023800983557), 7168, 16597, 7, 109, 16, 0, 0, 0 },
+		{ UINT64_C(1), 0, 213, 27, 0, 32, 0, 0, 0 }, { UINT64_C(11399736556781573), 7280, 16597, 8, 109, 32, 0, 0, 0 }, { UINT64_C(11576208173047813), 7233, 17622, 7, 107, 16, 0, 0, 0 },
+		{ UINT64_C(11576208173047813), 7233, 16598, 7, 107, 16, 0, 0, 0 }, { UINT64_C(11434920928878597), 7233, 16598, 5, 107, 32, 0, 0, 0 },
+		{ UINT64_C(1), 0, 214, 27, 0, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 16598, 2, 107, 32, 0, 0, 0 }, { UINT64_C(11541023800983557), 7168, 16598, 7, 107, 16, 0, 0, 0 },
+		{ UINT64_C(11575658418282501), 7233, 16598, 5, 107, 32, 0, 0, 0 }, { UINT64_C(11399736556814341), 7168, 16598, 5, 107, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 17622, 2, 107, 32, 0, 0, 0 }, { UINT64_C(17064420463149061), 7233, 16598, 2, 107, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 18647, 2, 135, 32, 0, 0, 0 }, { UINT64_C(11434920928878597), 7233, 18647, 5, 135, 32, 0, 0, 0 },
+		{ UINT64_C(11576208173047813), 7233, 18647, 7, 135, 16, 0, 0, 0 }, { UINT64_C(11541023800983557), 7168, 18647, 7, 135, 16, 0, 0, 0 },
+		{ UINT64_C(140738562097669), 3080, 18647, 16, 135, 32, 0, 0, 0 }, { UINT64_C(140737488355845), 3080, 18647, 16, 135, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3080, 18647, 16, 135, 32, 0, 0, 0 }, { UINT64_C(11399736556781573), 7280, 18647, 8, 135, 32, 0, 0, 0 },
+		{ UINT64_C(1), 0, 215, 27, 0, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 16600, 2, 124, 32, 0, 0, 0 }, { UINT64_C(11575658418282501), 7233, 16600, 5, 124, 32, 0, 0, 0 },
+		{ UINT64_C(11434920928878597), 7233, 16600, 5, 124, 32, 0, 0, 0 }, { UINT64_C(11576208173047813), 7233, 16600, 7, 124, 16, 0, 0, 0 },
+		{ UINT64_C(11541023800983557), 7168, 16600, 7, 124, 16, 0, 0, 0 }, { UINT64_C(140737488355333), 3080, 16600, 16, 124, 32, 0, 0, 0 },
+		{ UINT64_C(1), 0, 216, 27, 0, 32, 0, 0, 0 }, { UINT64_C(11399736556781573), 7280, 16600, 8, 124, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 16601, 2, 123, 32, 0, 0, 0 },
+		{ UINT64_C(11575658418282501), 7233, 16601, 5, 123, 32, 0, 0, 0 }, { UINT64_C(11434920928878597), 7233, 16601, 5, 123, 32, 0, 0, 0 },
+		{ UINT64_C(11576208173047813), 7233, 16601, 7, 123, 16, 0, 0, 0 }, { UINT64_C(1), 0, 217, 27, 0, 32, 0, 0, 0 }, { UINT64_C(11541023800983557), 7168, 16601, 7, 123, 16, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3080, 16601, 16, 123, 32, 0, 0, 0 }, { UINT64_C(140738562097669), 3080, 16601, 16, 123, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355845), 3080, 16601, 16, 123, 32, 0, 0, 0 }, { UINT64_C(140737488420869), 3080, 16601, 16, 123, 32, 0, 0, 0 },
+		{ UINT64_C(140738562097669), 3080, 17625, 16, 123, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 17625, 2, 123, 32, 0, 0, 0 },
+		{ UINT64_C(11576208173047813), 7233, 17625, 7, 123, 16, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 16602, 2, 114, 32, 0, 0, 0 },
+		{ UINT64_C(11434920928878597), 7233, 16602, 5, 114, 32, 0, 0, 0 }, { UINT64_C(11576208173047813), 7233, 16602, 7, 114, 16, 0, 0, 0 },
+		{ UINT64_C(11541023800983557), 7168, 16602, 7, 114, 16, 0, 0, 0 }, { UINT64_C(140738562097669), 3080, 16602, 16, 114, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3080, 16602, 16, 114, 32, 0, 0, 0 }, { UINT64_C(1), 0, 218, 27, 0, 32, 0, 0, 0 }, { UINT64_C(11399736556781573), 7280, 16602, 8, 114, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3080, 18481, 16, 38, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 13532, 2, 102, 32, 0, 0, 0 },
+		{ UINT64_C(11576208173047813), 7233, 13532, 7, 102, 16, 0, 0, 0 }, { UINT64_C(11434920928878597), 7233, 13532, 5, 102, 32, 0, 0, 0 },
+		{ UINT64_C(11399736556814341), 7168, 13532, 5, 102, 32, 0, 0, 0 }, { UINT64_C(11541023800983557), 7168, 13532, 7, 102, 16, 0, 0, 0 },
+		{ UINT64_C(1), 0, 220, 27, 0, 32, 0, 0, 0 }, { UINT64_C(11399736556781573), 7280, 13532, 8, 102, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 17629, 2, 126, 32, 0, 0, 0 },
+		{ UINT64_C(1), 0, 221, 27, 0, 32, 0, 0, 0 }, { UINT64_C(11576208173047813), 7233, 17629, 7, 126, 16, 0, 0, 0 }, { UINT64_C(11434920928878597), 7233, 17629, 5, 126, 32, 0, 0, 0 },
+		{ UINT64_C(11541023800983557), 7168, 17629, 7, 126, 16, 0, 0, 0 }, { UINT64_C(11399736556781573), 7280, 17629, 8, 126, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 17629, 10, 126, 32, 0, 0, 0 }, { UINT64_C(140738562097669), 3080, 17629, 16, 126, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 17629, 21, 126, 32, 0, 0, 0 }, { UINT64_C(17092320570638341), 7237, 16384, 4, 125, 32, 1, 1, 0 },
+		{ UINT64_C(17088953316278277), 7235, 16384, 0, 125, 32, 0, 0, 2 }, { UINT64_C(11399736556781573), 7280, 16384, 8, 125, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 16384, 10, 125, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 16384, 2, 125, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 19456, 2, 141, 32, 0, 0, 0 }, { UINT64_C(11576208173047813), 7233, 19456, 7, 141, 16, 0, 0, 0 },
+		{ UINT64_C(11434920928878597), 7233, 19456, 5, 141, 32, 0, 0, 0 }, { UINT64_C(11541023800950789), 7168, 19456, 7, 141, 16, 0, 0, 0 },
+		{ UINT64_C(11541023800983557), 7168, 19456, 7, 141, 16, 0, 0, 0 }, { UINT64_C(140737488355333), 3080, 19456, 16, 141, 32, 0, 0, 0 },
+		{ UINT64_C(140738562097669), 3080, 19456, 16, 141, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 19680, 2, 140, 32, 0, 0, 0 },
+		{ UINT64_C(11576208173047813), 7233, 19680, 7, 140, 16, 0, 0, 0 }, { UINT64_C(11434920928878597), 7233, 19680, 5, 140, 32, 0, 0, 0 },
+		{ UINT64_C(1), 0, 224, 27, 0, 32, 0, 0, 0 }, { UINT64_C(11541023801016325), 7168, 19680, 7, 140, 16, 0, 0, 0 }, { UINT64_C(11541023800983557), 7168, 19680, 7, 140, 16, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3080, 19680, 16, 140, 32, 0, 0, 0 }, { UINT64_C(140738562097669), 3080, 19680, 16, 140, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355845), 3080, 19680, 16, 140, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 16384, 2, 122, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 18658, 2, 133, 32, 0, 0, 0 }, { UINT64_C(1), 0, 226, 27, 0, 32, 0, 0, 0 }, { UINT64_C(11434920928878597), 7233, 18658, 5, 133, 32, 0, 0, 0 },
+		{ UINT64_C(11576208173047813), 7233, 18658, 7, 133, 16, 0, 0, 0 }, { UINT64_C(11541023800983557), 7168, 18658, 7, 133, 16, 0, 0, 0 },
+		{ UINT64_C(140738562097669), 3080, 18658, 16, 133, 32, 0, 0, 0 }, { UINT64_C(140737488355845), 3080, 18658, 16, 133, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3080, 18658, 16, 133, 32, 0, 0, 0 }, { UINT64_C(11399736556781573), 7280, 18658, 8, 133, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 18658, 10, 133, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3080, 18659, 16, 134, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355845), 3080, 18659, 16, 134, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 18659, 2, 134, 32, 0, 0, 0 },
+		{ UINT64_C(1), 0, 227, 27, 0, 32, 0, 0, 0 }, { UINT64_C(11576208173047813), 7233, 18659, 7, 134, 16, 0, 0, 0 }, { UINT64_C(11434920928878597), 7233, 18659, 5, 134, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 19456, 2, 138, 32, 0, 0, 0 }, { UINT64_C(11576208173047813), 7233, 19456, 7, 138, 16, 0, 0, 0 },
+		{ UINT64_C(11541023800983557), 7168, 19456, 7, 138, 16, 0, 0, 0 }, { UINT64_C(11399736556781573), 7280, 19456, 8, 138, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 9445, 2, 63, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 16613, 2, 63, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 17637, 2, 63, 32, 0, 0, 0 }, { UINT64_C(1), 0, 229, 27, 0, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 9445, 9, 63, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 16613, 9, 63, 32, 0, 0, 0 }, { UINT64_C(140737488355845), 3080, 9445, 16, 63, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355845), 3080, 16613, 16, 63, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 17408, 2, 63, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 11264, 2, 80, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 17408, 2, 127, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 12413, 2, 79, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 16619, 2, 115, 32, 0, 0, 0 },
+		{ UINT64_C(1), 0, 235, 27, 0, 32, 0, 0, 0 }, { UINT64_C(11399736556781573), 7280, 16619, 8, 115, 32, 0, 0, 0 }, { UINT64_C(140738562097669), 3080, 16619, 16, 115, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 16384, 2, 103, 32, 0, 0, 0 }, { UINT64_C(11541023800983557), 7168, 16384, 7, 103, 16, 0, 0, 0 },
+		{ UINT64_C(140738562097669), 3080, 16384, 16, 103, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 16384, 2, 119, 32, 0, 0, 0 },
+		{ UINT64_C(11576208173047813), 7233, 16384, 7, 119, 16, 0, 0, 0 }, { UINT64_C(140738562097669), 3080, 16384, 16, 119, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355845), 3080, 16384, 16, 119, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3080, 16384, 16, 119, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 16384, 21, 119, 32, 0, 0, 0 }, { UINT64_C(17064970218897413), 7233, 16384, 1, 119, 32, 0, 0, 0 },
+		{ UINT64_C(17064970218962949), 7233, 16384, 1, 119, 32, 0, 0, 0 }, { UINT64_C(11399736556781573), 7280, 16384, 8, 119, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 16384, 10, 119, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 13550, 2, 99, 32, 0, 0, 0 },
+		{ UINT64_C(1), 0, 238, 27, 0, 32, 0, 0, 0 }, { UINT64_C(11434920928878597), 7233, 13550, 5, 99, 32, 0, 0, 0 }, { UINT64_C(11541023800983557), 7168, 13550, 7, 99, 16, 0, 0, 0 },
+		{ UINT64_C(17064970218930181), 7233, 13550, 1, 99, 32, 0, 0, 0 }, { UINT64_C(17064970218962949), 7233, 18432, 1, 137, 32, 0, 0, 0 },
+		{ UINT64_C(17064970218962949), 7233, 19456, 1, 139, 32, 0, 0, 0 }, { UINT64_C(17064420463099909), 7233, 18672, 2, 137, 32, 0, 0, 0 },
+		{ UINT64_C(1), 0, 240, 27, 0, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 12288, 2, 30, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 12288, 2, 28, 32, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 19456, 2, 28, 32, 0, 0, 0 }, { UINT64_C(17064420463099909), 7233, 19700, 2, 139, 32, 0, 0, 0 },
+		{ UINT64_C(1), 0, 244, 27, 0, 32, 0, 0, 0 }, { UINT64_C(17064420463083525), 7233, 16629, 2, 105, 32, 0, 0, 0 }, { UINT64_C(1), 0, 245, 27, 0, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 16629, 21, 105, 32, 0, 0, 0 }, { UINT64_C(11541023800950789), 7168, 16629, 7, 105, 16, 0, 0, 0 },
+		{ UINT64_C(11576208173047813), 7233, 16629, 7, 105, 16, 0, 0, 0 }, { UINT64_C(140738562097669), 3080, 16629, 16, 105, 32, 0, 0, 0 },
+		{ UINT64_C(70918499991557), 3072, 16384, 26, 1, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 5120, 21, 1, 32, 0, 0, 0 },
+		{ UINT64_C(11540474046185477), 7168, 5120, 5, 1, 32, 0, 0, 0 }, { UINT64_C(11399736556781573), 7168, 5120, 5, 1, 32, 0, 0, 0 },
+		{ UINT64_C(11541023800983557), 7168, 5120, 7, 2, 16, 0, 0, 0 }, { UINT64_C(11399736556814341), 7168, 5120, 5, 1, 32, 0, 0, 0 },
+		{ UINT64_C(11540474046218245), 7168, 5120, 5, 1, 32, 0, 0, 0 }, { UINT64_C(70918499991557), 3072, 5120, 26, 1, 32, 0, 0, 0 },
+		{ UINT64_C(11541023800950789), 7168, 8192, 7, 21, 16, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 9216, 10, 1, 32, 0, 0, 0 },
+		{ UINT64_C(17627782733366277), 7237, 5120, 4, 1, 32, 0, 0, 0 }, { UINT64_C(17627714013889541), 7235, 5120, 0, 1, 32, 0, 0, 0 },
+		{ UINT64_C(17627714080998405), 7235, 5120, 0, 1, 32, 0, 0, 0 }, { UINT64_C(17627714013889541), 7235, 7168, 0, 1, 32, 0, 0, 0 },
+		{ UINT64_C(703687441776645), 3072, 5120, 20, 1, 32, 0, 0, 0 }, { UINT64_C(17627782733366277), 7237, 9216, 4, 1, 32, 0, 0, 0 },
+		{ UINT64_C(17627714013889541), 7235, 9216, 0, 1, 32, 0, 0, 0 }, { UINT64_C(11962686510203909), 7280, 5120, 8, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 17408, 21, 131, 32, 0, 0, 0 }, { UINT64_C(11541023800950789), 7168, 17408, 7, 131, 16, 0, 0, 0 },
+		{ UINT64_C(140737488355845), 3080, 17408, 16, 131, 32, 0, 0, 0 }, { UINT64_C(140738562097669), 3080, 17408, 16, 131, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3080, 17408, 16, 131, 32, 0, 0, 0 }, { UINT64_C(11576208173047813), 7233, 18527, 7, 19, 16, 0, 0, 0 },
+		{ UINT64_C(17064420463083525), 7233, 16384, 2, 113, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 16384, 10, 113, 32, 0, 0, 0 },
+		{ UINT64_C(11541023800983557), 7168, 16384, 7, 113, 16, 0, 0, 0 }, { UINT64_C(17092320570638341), 7237, 18688, 4, 132, 32, 176, 176, 0 },
+		{ UINT64_C(17088953316278277), 7235, 18688, 0, 132, 32, 0, 0, 177 }, { UINT64_C(11541023801049093), 7168, 18688, 7, 132, 16, 0, 0, 0 },
+		{ UINT64_C(11576208173047813), 7233, 18688, 7, 132, 16, 0, 0, 0 }, { UINT64_C(11541023800983557), 7168, 18688, 7, 132, 16, 0, 0, 0 },
+		{ UINT64_C(1), 0, 256, 27, 0, 32, 0, 0, 0 }, { UINT64_C(11399736556781573), 7280, 18688, 8, 132, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3080, 18688, 16, 132, 32, 0, 0, 0 },
+		{ UINT64_C(17627370416505861), 7233, 13325, 2, 3, 32, 0, 0, 0 }, { UINT64_C(703687441776645), 3072, 13325, 20, 3, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 12288, 21, 1, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 16384, 21, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 16384, 10, 1, 32, 0, 0, 0 }, { UINT64_C(176334177574917), 7237, 12288, 21, 1, 32, 0, 0, 0 },
+		{ UINT64_C(176334177574917), 7237, 11264, 21, 1, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 13312, 21, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 18432, 21, 1, 32, 0, 0, 0 }, { UINT64_C(140771848093701), 3072, 12288, 21, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 11264, 21, 28, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 19456, 21, 1, 32, 0, 0, 0 },
+		{ UINT64_C(141287244169221), 3072, 17408, 19, 1, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 13576, 21, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 12552, 21, 1, 32, 0, 0, 0 }, { UINT64_C(140737488355333), 3072, 16648, 21, 1, 32, 0, 0, 0 },
+		{ UINT64_C(140737488355333), 3072, 17672, 21, 1, 32, 0, 0, 0 }, { UINT64_C(524289), 0, 2048, 27, 0, 32, 0, 0, 0 }, { UINT64_C(17064420479877125), 7233, 5120, 2, 24, 32, 0, 0, 0 },
+		{ UINT64_C(17064420479877125), 7233, 12288, 2, 24, 32, 0, 0, 0 }, { UINT64_C(17064420463099909), 7233, 5120, 2, 24, 32, 0, 0, 0 },
+		{ UINT64_C(70368777732097), 0, 277, 27, 0, 32, 0, 0, 0 }, { UINT64_C(70918499991557), 3072, 5397, 26, 1, 32, 0, 0, 0 }, { UINT64_C(352393477750789), 3072, 5397, 26, 1, 32, 0, 0, 0 },
+		{ UINT64_C(11611394692612101), 7168, 7168, 7, 2, 16, 0, 0, 0 }, { UINT64_C(5), 3072, 2048, 28, 0, 32, 0, 0, 0 }, { UINT64_C(1), 0, 0, 27, 0, 0, 0, 0, 0 }
+	} };
 
-	std::array<std::uint_least8_t, 1586> flyweights;
-	auto table = std::make_unique<raw_record_table>();
-	auto& records = table->records;
-
-	run_length_decode(std::cbegin(rlestage1), std::cend(rlestage1), std::begin(table->stage1));
-	run_length_decode(std::cbegin(rlestage2), std::cend(rlestage2), std::begin(table->stage2));
-
-	run_length_decode(std::cbegin(rlepflagindices), std::cend(rlepflagindices), std::begin(flyweights));
-	for (std::size_t r = 0, e = records.size(); r < e; ++r)
-		records[r].pflags = pflags[flyweights[r]];
-
-	run_length_decode(std::cbegin(rlecflagindices), std::cend(rlecflagindices), std::begin(flyweights));
-	for (std::size_t r = 0, e = records.size(); r < e; ++r)
-		records[r].cflags = cflags[flyweights[r]];
-
-	run_length_decode(std::cbegin(rleabfields), std::cend(rleabfields),
-		make_member_accessor<decltype(&raw_record::abfields), &raw_record::abfields>(std::begin(records)));
-	run_length_decode(std::cbegin(rlegcindices), std::cend(rlegcindices),
-		make_member_accessor<decltype(&raw_record::gcindex), &raw_record::gcindex>(std::begin(records)));
-	run_length_decode(std::cbegin(rlescindices), std::cend(rlescindices),
-		make_member_accessor<decltype(&raw_record::scindex), &raw_record::scindex>(std::begin(records)));
-	run_length_decode(std::cbegin(rlewfields), std::cend(rlewfields),
-		make_member_accessor<decltype(&raw_record::wfields), &raw_record::wfields>(std::begin(records)));
-	run_length_decode(std::cbegin(rlecfindices), std::cend(rlecfindices),
-		make_member_accessor<decltype(&raw_record::cfindex), &raw_record::cfindex>(std::begin(records)));
-	run_length_decode(std::cbegin(rleclindices), std::cend(rleclindices),
-		make_member_accessor<decltype(&raw_record::clindex), &raw_record::clindex>(std::begin(records)));
-	run_length_decode(std::cbegin(rlecuindices), std::cend(rlecuindices),
-		make_member_accessor<decltype(&raw_record::cuindex), &raw_record::cuindex>(std::begin(records)));
-
-	return table;
+	std::size_t index = 1585;
+	if (r < 0x110000) {
+		index = stage1[r >> 7];
+		index = stage2[(index << 7) | (r & 0x7f)];
+	}
+	return &records[index];
 }
 
 } // namespace lug::unicode
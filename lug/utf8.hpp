@@ -28,6 +28,12 @@ constexpr bool is_lead(char octet) noexcept
 	return (static_cast<unsigned char>(octet) & 0xc0) != 0x80;
 }
 
+constexpr std::size_t sequence_length(char lead) noexcept
+{
+	auto const octet = static_cast<unsigned char>(lead);
+	return octet < 0xc0 ? 1 : (octet < 0xe0 ? 2 : (octet < 0xf0 ? 3 : 4));
+}
+
 inline unsigned int decode_rune_octet(char32_t& rune, char octet, unsigned int state)
 {
 	static constexpr std::array<unsigned char, 256> dfa_class_table
@@ -70,7 +76,11 @@ inline unsigned int decode_rune_octet(char32_t& rune, char octet, unsigned int s
 template <class InputIt, class = enable_if_char_input_iterator_t<InputIt>>
 inline std::pair<InputIt, char32_t> decode_rune(InputIt first, InputIt last)
 {
-	char32_t rune = U'\0';
+	if (first == last)
+		return ::std::make_pair(first, U'\U0000fffd');
+	char32_t rune = static_cast<unsigned char>(*first);
+	if (rune < 0x80)
+		return ::std::make_pair(++first, rune);
 	unsigned int state = decode_accept;
 	while (first != last && state != decode_reject)
 		if (state = ::lug::utf8::decode_rune_octet(rune, *first++, state); state == decode_accept)
@@ -78,12 +88,63 @@ inline std::pair<InputIt, char32_t> decode_rune(InputIt first, InputIt last)
 	return ::std::make_pair(::std::find_if(first, last, ::lug::utf8::is_lead), U'\U0000fffd');
 }
 
+template <class InputIt, class = enable_if_char_input_iterator_t<InputIt>>
+inline std::pair<InputIt, char32_t> decode_valid_rune(InputIt first)
+{
+	char32_t rune = static_cast<unsigned char>(*first++);
+	if (rune < 0x80)
+		return ::std::make_pair(first, rune);
+	auto const n = ::lug::utf8::sequence_length(static_cast<char>(rune));
+	rune &= 0x7fu >> n;
+	for (std::size_t i = 1; i < n; ++i)
+		rune = (rune << 6) | (static_cast<unsigned char>(*first++) & 0x3fu);
+	return ::std::make_pair(first, rune);
+}
+
 template <class InputIt, class = enable_if_char_input_iterator_t<InputIt>>
 inline InputIt next_rune(InputIt first, InputIt last)
 {
 	return ::lug::utf8::decode_rune(first, last).first;
 }
 
+inline std::size_t skip_ascii(std::string_view text, std::size_t i = 0) noexcept
+{
+	auto const data = text.data();
+	auto const n = text.size();
+#if defined(LUG_SSE2)
+	for ( ; n - i >= 16; i += 16)
+		if (auto const mask = static_cast<unsigned int>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const*>(data + i)))); mask != 0)
+			return i + detail::count_trailing_zeros(mask);
+#elif defined(LUG_NEON)
+	for ( ; n - i >= 16 && vmaxvq_u8(vld1q_u8(reinterpret_cast<std::uint8_t const*>(data + i))) < 0x80; i += 16) {}
+#endif
+	while (i < n && static_cast<unsigned char>(data[i]) < 0x80)
+		++i;
+	return i;
+}
+
+inline std::size_t valid_prefix(std::string_view text, std::size_t i = 0) noexcept
+{
+	auto const n = text.size();
+	while ((i = ::lug::utf8::skip_ascii(text, i)) < n) {
+		char32_t rune = U'\0';
+		unsigned int state = decode_accept;
+		auto j = i;
+		do {
+			state = ::lug::utf8::decode_rune_octet(rune, text[j++], state);
+		} while (j < n && state != decode_accept && state != decode_reject);
+		if (state != decode_accept)
+			break;
+		i = j;
+	}
+	return i;
+}
+
+inline bool is_valid(std::string_view text) noexcept
+{
+	return ::lug::utf8::valid_prefix(text) == text.size();
+}
+
 template <class InputIt, class = enable_if_char_input_iterator_t<InputIt>>
 inline std::size_t count_runes(InputIt first, InputIt last)
 {
@@ -93,6 +154,18 @@ inline std::size_t count_runes(InputIt first, InputIt last)
 	return count;
 }
 
+inline std::size_t count_runes(std::string_view text)
+{
+	std::size_t count = 0;
+	for (std::size_t i = 0, n = text.size(); i < n; ++count) {
+		auto const j = ::lug::utf8::skip_ascii(text, i);
+		if (count += j - i; j == n)
+			break;
+		i = static_cast<std::size_t>(::lug::utf8::next_rune(text.begin() + static_cast<std::ptrdiff_t>(j), text.end()) - text.begin());
+	}
+	return count;
+}
+
 template <class OutputIt>
 inline std::pair<OutputIt, bool> encode_rune(OutputIt dst, char32_t rune)
 {
@@ -119,6 +192,11 @@ template <class InputIt, class OutputIt>
 inline OutputIt tocasefold(InputIt first, InputIt last, OutputIt dst)
 {
 	while (first != last) {
+		if (auto const octet = static_cast<unsigned char>(*first); octet < 0x80) {
+			*dst++ = static_cast<char>(static_cast<unsigned int>(octet - 'A') < 26u ? octet + ('a' - 'A') : octet);
+			++first;
+			continue;
+		}
 		auto [next, rune] = ::lug::utf8::decode_rune(first, last);
 		dst = ::lug::utf8::encode_rune(dst, unicode::tocasefold(rune)).first;
 		first = next;
@@ -138,6 +216,11 @@ template <class InputIt, class OutputIt>
 inline OutputIt tolower(InputIt first, InputIt last, OutputIt dst)
 {
 	while (first != last) {
+		if (auto const octet = static_cast<unsigned char>(*first); octet < 0x80) {
+			*dst++ = static_cast<char>(static_cast<unsigned int>(octet - 'A') < 26u ? octet + ('a' - 'A') : octet);
+			++first;
+			continue;
+		}
 		auto [next, rune] = ::lug::utf8::decode_rune(first, last);
 		dst = ::lug::utf8::encode_rune(dst, unicode::tolower(rune)).first;
 		first = next;
@@ -157,6 +240,11 @@ template <class InputIt, class OutputIt>
 inline OutputIt toupper(InputIt first, InputIt last, OutputIt dst)
 {
 	while (first != last) {
+		if (auto const octet = static_cast<unsigned char>(*first); octet < 0x80) {
+			*dst++ = static_cast<char>(static_cast<unsigned int>(octet - 'a') < 26u ? octet - ('a' - 'A') : octet);
+			++first;
+			continue;
+		}
 		auto [next, rune] = ::lug::utf8::decode_rune(first, last);
 		dst = ::lug::utf8::encode_rune(dst, unicode::toupper(rune)).first;
 		first = next;
@@ -48,7 +48,8 @@ namespace samples::calc
 int main()
 {
 	try {
-		while (lug::parse(samples::calc::Grammar, samples::calc::Env)) ;
+		lug::parser parser{samples::calc::Grammar, samples::calc::Env};
+		while (parser.reset().push_source(lug::istream_source{std::cin, lug::source_options::interactive}).parse()) ;
 	} catch (std::exception const& e) {
 		std::cerr << "Error: " << e.what() << std::endl;
 		return -1;
@@ -71,6 +71,28 @@ void test_association_and_precedence()
 	assert(!lug::parse("1+", G));
 }
 
+void test_nested_left_recursion()
+{
+	using namespace lug::language;
+	grammar::implicit_space = nop;
+	std::string out;
+	rule N	= chr('1') | chr('2') | chr('3');
+	rule E	= E[1] > chr('+') > E[2] <[&out]{ out += '+'; }
+			| chr('-') > E[3] <[&out]{ out += '~'; }
+			| chr('(') > E > chr(')')
+			| N <[&out](csyntax& x){ out += x.capture(); };
+	rule S = E > eoi;
+	grammar G = start(S);
+	out.clear();
+	assert(lug::parse("-1+2", G) && out == "1~2+");
+	out.clear();
+	assert(lug::parse("-(--1+2)+3", G) && out == "1~~2+~3+");
+	out.clear();
+	assert(lug::parse("1+(2+(3+-(1+2)))", G) && out == "12312+~+++");
+	assert(!lug::parse("-", G));
+	assert(!lug::parse("1+(2+3", G));
+}
+
 /* NOTE: Medeiros' algorithm doesn't appear to support hidden left recursion
 void test_hidden_left_recursion()
 {
@@ -103,6 +125,7 @@ int main()
 		test_direct_left_recursion();
 		test_indirect_left_recursion();
 		test_association_and_precedence();
+		test_nested_left_recursion();
 	} catch (std::exception& e) {
 		std::cerr << "Error: " << e.what() << std::endl;
 		return -1;
@@ -0,0 +1,70 @@
+// lug - Embedded DSL for PE grammar parser combinators in C++
+// Copyright (c) 2017 Jesse W. Towner
+// See LICENSE.md file for license details
+
+#include <lug/native.hpp>
+#include <cassert>
+
+void test_native_terminals()
+{
+	using namespace lug::native::language;
+	assert(lug::native::parse(str("hello") > eoi, "hello"));
+	assert(!lug::native::parse(str("hello") > eoi, "hello!"));
+	assert(lug::native::parse(+chr('a', 'c') > eoi, "abcba"));
+	assert(!lug::native::parse(+chr('a', 'c') > eoi, ""));
+	assert(lug::native::parse(+alpha > digit > eoi, u8"été7"));
+	assert(lug::native::parse(*any > eoi, u8"中文"));
+	assert(lug::native::parse(+(str("x") > eol) > eoi, "x\r\nx\nx\r"));
+	assert(lug::native::parse(!digit > ~chr('-') > eps > "a" > &eoi, "-a"));
+	auto const owned = std::string{"ab"} > str(std::string{"cd"}) > eoi;
+	assert(lug::native::parse(owned, "abcd"));
+	assert(!lug::native::parse(owned, "abc"));
+}
+
+void test_native_rules()
+{
+	using namespace lug::native::language;
+	rule<> Expr;
+	rule<> Value = +digit | "(" > Expr > ")";
+	Expr = Value > *("+" > Value);
+	assert(lug::native::parse(Expr > eoi, "1+(2+34)+5"));
+	assert(!lug::native::parse(Expr > eoi, "1+(2+34+5"));
+	rule<> Unset;
+	bool threw = false;
+	try { lug::native::parse(Unset, ""); } catch (lug::bad_grammar const&) { threw = true; }
+	assert(threw);
+}
+
+void test_native_actions()
+{
+	using namespace lug::native::language;
+	std::vector<std::string> words;
+	int count = 0;
+	rule<> Word = (+alpha < [&words](std::string_view w) { words.emplace_back(w); }) > *space;
+	rule<> Bad = (+alpha < [&count] { ++count; }) > "!";
+	auto const S = *(Bad | Word) > eoi;
+	assert(lug::native::parse(S, "one two three"));
+	assert((words == std::vector<std::string>{"one", "two", "three"}) && count == 0);
+	words.clear();
+	assert(!lug::native::parse(S, "one 2"));
+	assert(words.empty());
+	assert(lug::native::parse(S, "a!b"));
+	assert(count == 1 && words.size() == 1 && words[0] == "b");
+	lug::environment E;
+	std::size_t lines = 0;
+	assert(lug::native::parse(*(+alpha > (eol < [&lines](lug::environment&) { ++lines; })) > eoi, "a\nb\n", E));
+	assert(lines == 2);
+}
+
+int main()
+{
+	try {
+		test_native_terminals();
+		test_native_rules();
+		test_native_actions();
+	} catch (std::exception& e) {
+		std::cerr << "Error: " << e.what() << std::endl;
+		return -1;
+	}
+	return 0;
+}
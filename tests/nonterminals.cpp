@@ -33,6 +33,28 @@ void test_choice()
 	assert(!lug::parse(" a", G));
 }
 
+void test_choice_dispatch()
+{
+	using namespace lug::language;
+	rule Keyword = noskip[ str("if") | "int" | "else" | "while" | "for" ];
+	rule S = noskip[ Keyword > *(chr(' ') > (Keyword | +chr('x'))) > eoi ];
+	grammar G = start(S);
+	assert(lug::parse("if", G));
+	assert(lug::parse("int", G));
+	assert(lug::parse("for while x else int if", G));
+	assert(!lug::parse("", G));
+	assert(!lug::parse("iff", G));
+	assert(!lug::parse("in", G));
+	assert(!lug::parse("for y", G));
+	lug::environment E;
+	lug::parser p{G, E};
+	assert(!p.bind("while wh").parse());
+	assert(p.max_subject_index() == 6);
+	lug::parser q{G, E};
+	assert(!q.bind("else y").parse());
+	assert(q.max_subject_index() == 5);
+}
+
 void test_zero_or_one()
 {
 	using namespace lug::language;
@@ -61,6 +83,47 @@ void test_zero_or_many()
 	assert(!lug::parse("xxxxxy", G));
 }
 
+void test_repetition_span()
+{
+	using namespace lug::language;
+	rule S1 = noskip[ +"[a-z0-9_]"_rx > *"[^;]"_rx > chr(';') > eoi ];
+	grammar G1 = start(S1);
+	assert(G1.optimizer_report().folded_spans == 2);
+	assert(lug::parse("identifier_with_a_long_tail_0123456789;", G1));
+	assert(lug::parse(u8"x \u00E9t\u00E9 and \u4E2D\u6587 text, longer than sixteen bytes;", G1));
+	assert(!lug::parse(";", G1));
+	assert(!lug::parse("abc", G1));
+	assert(!lug::parse("abc;;", G1));
+
+	rule S2 = noskip[ *alpha > *space > eoi ];
+	grammar G2 = start(S2);
+	assert(lug::parse(u8"Stra\u00DFeCaf\u00E9\u0395\u03BB\u03BB\u03AC\u03B4\u03B1abcdefghijklmnop \t\r\n", G2));
+	assert(!lug::parse("abcdefghijklmnopqrstuvwxyz0", G2));
+
+	lug::environment E;
+	lug::parser p{G2, E};
+	assert(!p.bind("abcdefghijklmnopqrstuvwxyz   9").parse());
+	assert(p.max_subject_index() == 30);
+}
+
+void test_implicit_space()
+{
+	using namespace lug::language;
+	rule Word = lexeme[ +alpha ];
+	rule S = *Word > eoi;
+	grammar G = start(S);
+	assert(lug::parse("alpha beta  gamma", G));
+	assert(lug::parse(" \t\r\n\v\f alpha \t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t beta\n", G));
+	assert(lug::parse(u8"alpha\u00A0beta\u3000\u2003gamma \u0085 ", G));
+	assert(!lug::parse("alpha 9", G));
+	assert(!lug::parse(u8"alpha \u00B7", G));
+
+	lug::environment E;
+	lug::parser p{G, E};
+	assert(!p.bind("alpha                         9").parse());
+	assert(p.max_subject_index() == 31);
+}
+
 void test_one_or_many()
 {
 	using namespace lug::language;
@@ -113,16 +176,35 @@ void test_predicate()
 	assert(!lug::parse("x  x", G));
 }
 
+void test_rule_chain()
+{
+	using namespace lug::language;
+	std::vector<rule> R(1000);
+	R.back() = noskip[ bre("[0-9]") ];
+	for (std::size_t i = R.size() - 1; i-- > 0; )
+		R[i] = noskip[ ~chr('a') > R[i + 1] > ~bre("[0-9]") ];
+	grammar G = start(R[0] > eoi);
+	assert(lug::parse("7", G));
+	assert(lug::parse("aa7", G));
+	assert(lug::parse("a7123", G));
+	assert(!lug::parse("aab", G));
+	assert(!lug::parse("", G));
+}
+
 int main()
 {
 	try {
 		test_sequence();
 		test_choice();
+		test_choice_dispatch();
 		test_zero_or_one();
 		test_zero_or_many();
 		test_one_or_many();
+		test_repetition_span();
+		test_implicit_space();
 		test_not();
 		test_predicate();
+		test_rule_chain();
 	} catch (std::exception& e) {
 		std::cerr << "Error: " << e.what() << std::endl;
 		return -1;
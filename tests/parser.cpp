@@ -3,7 +3,18 @@
 // See LICENSE.md file for license details
 
 #include <lug/lug.hpp>
+#include <lug/batch.hpp>
+#include <lug/image.hpp>
 #include <cassert>
+#include <cstdlib>
+#include <sstream>
+#include <thread>
+
+#ifndef _MSC_VER
+#include <lug/posix.hpp>
+#include <csignal>
+#include <pthread.h>
+#endif
 
 using namespace std::string_view_literals;
 
@@ -90,12 +101,647 @@ void test_line_column_tracking()
 
 	assert(p.max_subject_index() == sentences2.size());
 	assert(p.max_subject_position().line == 28 && p.max_subject_position().column == 1);
+
+	std::vector<std::size_t> spans;
+	{
+		using namespace lug::language;
+		rule Word = lexeme[ +alpha ] < [&spans](csyntax& x) { auto const e = x.end(); auto const s = x.start(); spans.insert(spans.end(), {s.line, s.column, e.line, e.column}); };
+		G = start(noskip[ *(Word | any) > eoi ]);
+	}
+
+	auto const sentences3 = u8"ab\r\ncd\u2028e\u0085\tfg\r\n\r\nh"sv;
+	lug::parser q{G, E};
+	success = q.parse(std::begin(sentences3), std::end(sentences3));
+	assert(success);
+	assert((spans == std::vector<std::size_t>{1, 1, 1, 3, 2, 1, 2, 3, 3, 1, 3, 2, 4, 9, 4, 11, 6, 1, 6, 2}));
+	assert(q.max_subject_position().line == 6 && q.max_subject_position().column == 2);
+}
+
+void test_memoization()
+{
+	using namespace lug::language;
+	int evaluations = 0;
+	std::string output;
+	rule Number = lexeme[ +digit ] > [&evaluations]{ ++evaluations; return true; };
+	rule Operand = Number < [&output](csyntax& x) { output.append("[").append(x.capture()).append("]"); };
+	rule Marked = memoize[Operand] > "+" > memoize[Operand] | memoize[Operand] > "-" > memoize[Operand] | memoize[Operand];
+	rule Unmarked = Operand > "+" > Operand | Operand > "-" > Operand | Operand;
+	grammar G1 = start(Marked > eoi);
+	grammar G2 = start(Unmarked > eoi);
+
+	lug::environment E;
+	lug::parser p1{G1, E};
+	assert(p1.parse("12 - 34"sv.begin(), "12 - 34"sv.end()));
+	assert(evaluations == 2 && output == "[12][34]");
+	assert(p1.memo_size() == 2);
+
+	evaluations = 0, output.clear();
+	assert(p1.parse("7"sv.begin(), "7"sv.end()));
+	assert(evaluations == 1 && output == "[7]");
+
+	evaluations = 0, output.clear();
+	lug::parser p2{G2, E};
+	assert(p2.parse("12 - 34"sv.begin(), "12 - 34"sv.end()));
+	assert(evaluations == 3 && output == "[12][34]");
+
+	evaluations = 0, output.clear();
+	lug::parser p3{G2, E};
+	p3.packrat(true);
+	assert(p3.parse("12 - 34"sv.begin(), "12 - 34"sv.end()));
+	assert(evaluations == 2 && output == "[12][34]");
+
+	evaluations = 0, output.clear();
+	lug::parser p4{G1, E};
+	p4.memo_capacity(0);
+	assert(!p4.parse("12 * 34"sv.begin(), "12 * 34"sv.end()));
+	assert(evaluations == 3 && output.empty());
+	assert(p4.max_subject_index() == 3 && p4.memo_size() == 0);
+
+	rule R = ("ab"_sx < []{}) | "ca";
+	grammar G3 = start((&R | alpha) > eoi);
+	grammar G4 = start((&memoize[R] | alpha) > eoi);
+	lug::parser p5{G3, E}, p6{G3, E}, p7{G4, E};
+	p6.packrat(true);
+	assert(!p5.parse("ab"sv.begin(), "ab"sv.end()) && !p6.parse("ab"sv.begin(), "ab"sv.end()) && !p7.parse("ab"sv.begin(), "ab"sv.end()));
+	assert(p5.max_subject_index() == 1 && p6.max_subject_index() == 1 && p7.max_subject_index() == 1);
+}
+
+void test_zero_copy_input()
+{
+	using namespace lug::language;
+	std::string_view first, last;
+	rule Word = lexeme[ +alpha ] < [&](csyntax& x) { if (first.empty()) first = x.capture(); last = x.capture(); };
+	grammar G = start(*Word > eoi);
+	std::string const text = "alpha beta gamma";
+
+	lug::environment E;
+	lug::parser p{G, E};
+	assert(p.bind(text).parse());
+	assert(p.match().data() == text.data() && p.match() == text);
+	assert(first == "alpha" && first.data() == text.data());
+	assert(last == "gamma" && last.data() == text.data() + 11);
+
+	first = last = std::string_view{};
+	assert(lug::parse(text, G, E));
+	assert(first.data() == text.data() && last.data() == text.data() + 11);
+
+	std::string const more = " delta";
+	lug::parser q{G, E};
+	assert(q.bind(text).enqueue(more.begin(), more.end()).parse());
+	assert(q.match() == "alpha beta gamma delta" && q.match().data() != text.data());
+}
+
+#ifndef _MSC_VER
+void test_posix_mapped_file()
+{
+	using namespace lug::language;
+	std::vector<std::string_view> words;
+	rule Word = lexeme[ +alpha ] < [&words](csyntax& x) { words.push_back(x.capture()); };
+	grammar G = start(*Word > eoi);
+	std::string const text = u8"lorem ipsum d\u00f6lor";
+	char path[] = "/tmp/lug-parser-XXXXXX";
+	int const fd = ::mkstemp(path);
+	assert(fd >= 0);
+	assert(::write(fd, text.data(), text.size()) == static_cast<::ssize_t>(text.size()));
+	::close(fd);
+
+	lug::environment E;
+	{
+		lug::posix::mapped_file const file{path};
+		assert(file.view() == text);
+		assert(lug::posix::parse(file, G, E));
+		assert(words.size() == 3 && words[2] == u8"d\u00f6lor" && words[2].data() == file.data() + 12);
+		words.clear();
+		lug::parser p{G, E};
+		assert(p.bind(file.view()).parse() && p.match().data() == file.data());
+		assert(words.size() == 3 && words[0].data() == file.data());
+	}
+
+	assert(::truncate(path, 0) == 0);
+	{
+		lug::posix::mapped_file const file{path};
+		assert(file.size() == 0 && file.view().empty());
+		assert(lug::posix::parse(file, G));
+		assert(!lug::posix::parse(file, start(Word > eoi)));
+	}
+	::unlink(path);
+
+	bool threw = false;
+	try { lug::posix::mapped_file{path}; } catch (std::system_error const& e) { threw = e.code() == std::errc::no_such_file_or_directory; }
+	assert(threw);
+}
+#endif
+
+void test_streaming_input_limit()
+{
+	using namespace lug::language;
+	int records = 0;
+	rule Record = noskip[ +alpha > eol ] < [&records]{ ++records; };
+	rule Records = eoi | Record > cut > Records;
+	grammar G1 = start(Records);
+	grammar G2 = start(*Record > eoi);
+	auto make_source = [](int n) { return [n](std::string& line) mutable { line = "record\n"; return --n > 0; }; };
+
+	lug::environment E;
+	lug::parser p1{G1, E};
+	p1.input_limit(16);
+	assert(p1.parse(make_source(1000)));
+	assert(records == 1000);
+
+	records = 0;
+	lug::parser p2{G2, E};
+	p2.input_limit(16);
+	bool limited = false;
+	try {
+		p2.parse(make_source(1000));
+	} catch (lug::input_limit_error const&) {
+		limited = true;
+	}
+	assert(limited && records == 0);
+}
+
+void test_istream_sources()
+{
+	using namespace lug::language;
+	std::vector<std::string> words;
+	rule Word = lexeme[ +alpha ] < [&words](csyntax& x) { words.emplace_back(x.capture()); };
+	grammar G = start(*Word > eoi);
+
+	std::istringstream blocks{"lorem ipsum\ndolor sit\namet"};
+	lug::environment E;
+	lug::parser p{G, E};
+	assert(p.parse(lug::istream_source{blocks, lug::source_options::none, 3}));
+	assert(p.match() == "lorem ipsum\ndolor sit\namet");
+	assert((words == std::vector<std::string>{"lorem", "ipsum", "dolor", "sit", "amet"}));
+	assert(blocks.eof());
+
+	words.clear();
+	std::istringstream lines{"lorem ipsum\ndolor sit\namet"};
+	lug::parser q{G, E};
+	assert(q.parse(lug::istream_source{lines, lug::source_options::interactive}));
+	assert(q.match() == "lorem ipsum\ndolor sit\namet\n");
+	assert(words.size() == 5);
+
+	std::string output;
+	rule Greeting = noskip[ "hello"_sx > " " > (u8"w\u00f6rld"_sx | "world") > (any < [&output](csyntax& x) { output.append(x.capture()); }) ];
+	grammar H = start(Greeting > eoi);
+	std::string accents;
+	for (int i = 0; i < 5000; ++i)
+		accents.append(u8"\u00e9");
+	rule Accents = noskip[ +alpha > "!" ];
+	grammar I = start(Accents > eoi);
+	for (std::size_t block_size = 1; block_size <= 7; ++block_size) {
+		output.clear();
+		std::istringstream text{u8"hello w\u00f6rld\u4e00"};
+		lug::parser r{H, E};
+		assert(r.parse(lug::istream_source{text, lug::source_options::none, block_size}));
+		assert(output == u8"\u4e00");
+		std::istringstream accented{accents + "!"};
+		lug::parser s{I, E};
+		assert(s.parse(lug::istream_source{accented, lug::source_options::none, block_size}));
+		assert(s.match().size() == accents.size() + 1);
+	}
+}
+
+#ifndef _MSC_VER
+volatile std::sig_atomic_t interruptions = 0;
+
+void test_posix_fd_source()
+{
+	using namespace lug::language;
+	std::vector<std::string> words;
+	rule Word = lexeme[ +alpha ] < [&words](csyntax& x) { words.emplace_back(x.capture()); };
+	grammar G = start(*Word > eoi);
+	std::string const text = u8"lorem ipsum d\u00f6lor \u4e00\u4e8c";
+	lug::environment E;
+	for (std::size_t block_size = 1; block_size <= 4; ++block_size) {
+		int fds[2];
+		assert(::pipe(fds) == 0);
+		assert(::write(fds[1], text.data(), text.size()) == static_cast<::ssize_t>(text.size()));
+		::close(fds[1]);
+		words.clear();
+		lug::parser p{G, E};
+		assert(p.parse(lug::posix::fd_source{fds[0], block_size}));
+		assert(p.match() == text);
+		assert((words == std::vector<std::string>{"lorem", "ipsum", u8"d\u00f6lor", u8"\u4e00\u4e8c"}));
+		::close(fds[0]);
+	}
+
+	struct ::sigaction action = {}, previous = {};
+	action.sa_handler = [](int) { interruptions = interruptions + 1; };
+	::sigemptyset(&action.sa_mask);
+	assert(::sigaction(SIGUSR1, &action, &previous) == 0);
+	int fds[2];
+	assert(::pipe(fds) == 0);
+	std::thread writer{[reader = ::pthread_self(), fd = fds[1], &text] {
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+		::pthread_kill(reader, SIGUSR1);
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+		assert(::write(fd, text.data(), text.size()) == static_cast<::ssize_t>(text.size()));
+		::close(fd);
+	}};
+	words.clear();
+	lug::parser q{G, E};
+	assert(q.parse(lug::posix::fd_source{fds[0], 3}));
+	writer.join();
+	::close(fds[0]);
+	::sigaction(SIGUSR1, &previous, nullptr);
+	assert(interruptions == 1 && words.size() == 4);
+
+	bool threw = false;
+	lug::parser r{G, E};
+	try { r.parse(lug::posix::fd_source{-1}); } catch (std::system_error const& e) { threw = e.code() == std::errc::bad_file_descriptor; }
+	assert(threw);
+}
+#endif
+
+void test_program_optimization()
+{
+	using namespace lug::language;
+	rule Sign, Digits;
+	rule Number = noskip[ ~Sign > Digits ];
+	rule Name = noskip[ chr('i') > chr('d') > +"[a-z]"_rx ];
+	Sign = noskip[ chr('-') | chr('+') ];
+	Digits = noskip[ +"[0-9]"_rx ];
+	grammar G = start((Number | Name) > eoi);
+	auto const& report = G.optimizer_report();
+	assert(report.inlined_calls == 3 && report.removed_instructions > 0);
+	assert(report.merged_matches == 1 && report.instructions_after < report.instructions_before);
+
+	assert(lug::parse("-12", G));
+	assert(lug::parse("7", G));
+	assert(lug::parse("idx", G));
+	assert(!lug::parse("+", G));
+	assert(!lug::parse("id", G));
+
+	lug::environment E;
+	lug::parser p{G, E};
+	assert(!p.bind("ix").parse());
+	assert(p.max_subject_index() == 1);
+	lug::parser q{G, E};
+	assert(!q.bind("-x").parse());
+	assert(q.max_subject_index() == 1);
+}
+
+void test_literal_alternation()
+{
+	using namespace lug::language;
+	rule Keyword = noskip[ ("sel"_sx | "select" | "from" | "s") > !alpha ];
+	grammar G = start(*(Keyword > *space) > eoi);
+	assert(G.optimizer_report().literal_tries == 1);
+	assert(lug::parse("sel from s sel", G));
+	assert(!lug::parse("select", G));
+	assert(!lug::parse("fro", G));
+
+	rule Caseless = noskip[ "select"_isx | "sel"_isx | u8"\u00E9cole"_isx ];
+	grammar H = start(Caseless > eoi);
+	assert(H.optimizer_report().literal_tries == 1);
+	assert(lug::parse("SELECT", H));
+	assert(lug::parse("SeL", H));
+	assert(lug::parse(u8"\u00C9COLE", H));
+	assert(!lug::parse("selec", H));
+
+	lug::environment E;
+	lug::parser p{H, E};
+	assert(!p.bind("Sele").parse());
+	std::istringstream blocks{"SELECT"};
+	lug::parser q{H, E};
+	assert(q.parse(lug::istream_source{blocks, lug::source_options::none, 1}));
+}
+
+void test_parser_reuse()
+{
+	using namespace lug::language;
+	std::vector<std::string> words;
+	rule Word = lexeme[ +alpha ] < [&words](csyntax& x) { words.emplace_back(x.capture()); };
+	grammar G = start(*Word > eoi);
+
+	lug::environment E1, E2;
+	lug::parser p{G, E1};
+	assert(p.bind("lorem ipsum").parse());
+	assert(p.match() == "lorem ipsum" && words.size() == 2);
+	assert(!p.reset().bind("dolor 42").parse());
+	assert(p.max_subject_index() == 7 && words.size() == 2);
+	assert(p.reset(E2).bind("sit amet").parse());
+	assert(&p.environment() == &E2 && p.match() == "sit amet");
+	assert(p.subject_position().line == 1 && p.subject_position().column == 9);
+	assert((words == std::vector<std::string>{"lorem", "ipsum", "sit", "amet"}));
+
+	std::istringstream lines{"consectetur\nadipiscing elit"};
+	assert(p.reset().push_source(lug::istream_source{lines, lug::source_options::interactive}).parse());
+	assert(p.match() == "consectetur\nadipiscing elit\n" && words.size() == 7);
+	assert(p.reset().parse() && p.match().empty());
+}
+
+void test_deferred_cut()
+{
+	using namespace lug::language;
+	std::string output;
+	rule Head = noskip[ (("a"_sx < [&output]{ output += "A"; }) > cut > "b") < [&output](csyntax& x) { output.append("[").append(x.capture()).append("]"); } ];
+	rule S = noskip[ Head > ("c"_sx < [&output]{ output += "C"; }) > eoi ];
+	grammar G = start(S);
+
+	lug::environment E;
+	lug::parser p{G, E};
+	assert(p.bind("abc").parse());
+	assert(output == "A[ab]C");
+	output.clear();
+	assert(!p.reset().bind("abx").parse());
+	assert(output == "A[ab]");
+}
+
+void test_typed_attributes()
+{
+	using namespace lug::language;
+	lug::environment E;
+	variable<std::string> w{E}, l{E}, s{E}, t{E};
+	variable<std::string_view> m{E};
+	variable<long> v{E};
+	rule Item, List;
+	rule Word = lexeme[ capture(m)[ +alpha ] ] < [&]{ return std::string{*m}; };
+	Item = w%Word < [&]{ return *w; } | l%List < [&]{ return *l; };
+	List = "[" > s%Item > *("," > t%Item < [&]{ s->append(",").append(*t); }) > "]" < [&]{ return "[" + *s + "]"; };
+	std::string joined;
+	grammar G1 = start(l%List > eoi < [&]{ joined = *l; });
+	assert(lug::parse("[a, [bb, [ccc], d], [e], ffff]", G1, E));
+	assert(joined == "[a,[bb,[ccc],d],[e],ffff]");
+
+	std::size_t count = 0;
+	joined.clear();
+	rule Long = lexeme[ capture(m)[ +alpha ] ] < [&]{ ++count; return std::string(256, m->front()); };
+	grammar G2 = start(*Long > eoi < [&count, &joined](lug::environment& env) {
+		for ( ; count > 0; --count)
+			joined.append(env.pop_attribute<std::string>().substr(255));
+	});
+	std::string text;
+	for (int i = 0; i < 500; ++i)
+		text.append(1, static_cast<char>('a' + i % 26)).append(1, ' ');
+	assert(lug::parse(text, G2, E));
+	assert(joined.size() == 500 && joined.front() == 'f' && joined.back() == 'a');
+
+	rule Int = lexeme[ +digit ] < [] { return 42; };
+	grammar G3 = start(v%Int > eoi);
+	bool mismatched = false;
+	try {
+		lug::parse("42", G3, E);
+	} catch (std::bad_any_cast const&) {
+		mismatched = true;
+	}
+	assert(mismatched);
+}
+
+void test_streaming_dispatch()
+{
+	using namespace lug::language;
+	int records = 0, dispatched = 0;
+	rule Record = noskip[ +alpha > eol ] < [&records]{ ++records; };
+	grammar G1 = start(*Record > eoi);
+	auto make_source = [&records, &dispatched](int n) { return [&records, &dispatched, n](std::string& line) mutable {
+		line = "record\n";
+		dispatched = (std::max)(dispatched, records);
+		return --n > 0; }; };
+
+	lug::environment E;
+	lug::parser p1{G1, E};
+	p1.streaming(true);
+	p1.input_limit(4096);
+	assert(p1.parse(make_source(5000)));
+	assert(records == 5000 && dispatched > 4000);
+
+	std::string output;
+	rule Bang = lexeme[ +alpha < [&output](csyntax& x) { output.append("!").append(x.capture()); } > "!" ];
+	rule Query = lexeme[ +alpha < [&output](csyntax& x) { output.append("?").append(x.capture()); } > "?" ];
+	grammar G2 = start(*(Bang | Query) > eoi);
+	std::string text;
+	for (int i = 0; i < 1000; ++i)
+		text.append(i % 3 == 0 ? "ab! " : "cd? ");
+	lug::parser p2{G2, E};
+	assert(p2.bind(text).parse());
+	auto const expected = output;
+	output.clear();
+	p2.reset().streaming(true);
+	assert(p2.bind(text).parse());
+	assert(output == expected && expected.size() == 3000);
+
+	variable<std::string_view> m{E};
+	variable<long> n{E}, t{E};
+	long total = 0;
+	rule Number = lexeme[ capture(m)[ +digit ] ] < [&m]{ return std::stol(std::string{*m}); };
+	rule Sum = n%Number < [&]{ *t = *n; } > *("+" > n%Number < [&]{ *t += *n; }) < [&]{ total = *t; };
+	grammar G3 = start(Sum > eoi);
+	text = "1";
+	for (int i = 2; i <= 2000; ++i)
+		text.append(" + ").append(std::to_string(i));
+	lug::parser p3{G3, E};
+	p3.streaming(true);
+	assert(p3.bind(text).parse());
+	assert(total == 2001000);
+}
+
+void test_push_parsing()
+{
+	using namespace lug::language;
+	std::vector<std::string> tokens;
+	rule Keyword = lexeme[ "true"_sx | "false" ] < [&tokens](csyntax& x) { tokens.emplace_back(x.capture()); };
+	rule Word = lexeme[ +alpha ] < [&tokens](csyntax& x) { tokens.emplace_back(x.capture()); };
+	rule Line = noskip[ *(Keyword | Word | +" "_sx) > eol ] < [&tokens]{ tokens.emplace_back("\\n"); };
+	grammar G = start(*Line > eoi);
+	std::string const text = u8"true fals\u00e9 false\r\n\u00c9t\u00e9 truex\r\n";
+
+	lug::environment E;
+	assert(lug::parse(text, G, E));
+	auto const expected = tokens;
+	assert(expected.size() == 8 && expected[1] == u8"fals\u00e9" && expected[4] == u8"\u00c9t\u00e9");
+
+	tokens.clear();
+	lug::parser p{G, E};
+	for (char c : text) {
+		assert(p.feed(std::string_view{&c, 1}) == lug::parse_status::needs_input);
+		assert(p.suspended() && tokens.empty());
+	}
+	assert(p.finish() == lug::parse_status::complete);
+	assert(!p.suspended() && tokens == expected && p.match() == text);
+
+	tokens.clear();
+	p.reset();
+	assert(p.feed(text.substr(0, 7)) == lug::parse_status::needs_input);
+	assert(p.feed(text.substr(7)) == lug::parse_status::needs_input);
+	assert(p.finish() == lug::parse_status::complete && tokens == expected);
+
+	tokens.clear();
+	p.reset();
+	assert(p.feed("true 42") == lug::parse_status::failed);
+	assert(!p.suspended() && tokens.empty() && p.max_subject_index() == 5);
+	assert(p.reset().finish() == lug::parse_status::complete);
+
+	p.reset().streaming(true);
+	std::string const line = "lorem ipsum dolor sit amet\n";
+	for (int i = 0; i < 200; ++i)
+		assert(p.feed(line) == lug::parse_status::needs_input);
+	assert(tokens.size() > 500 && tokens.size() < 1200);
+	assert(p.finish() == lug::parse_status::complete && tokens.size() == 1200);
+}
+
+void test_concurrent_parsing()
+{
+	using namespace lug::language;
+	auto const Digit = "[0-9]"_irx;
+	std::vector<std::thread> threads;
+	grammar built[8];
+	for (auto& g : built)
+		threads.emplace_back([&g, &Digit] { rule Number = lexeme[ +Digit ]; g = start(*Number > eoi); });
+	for (auto& t : threads)
+		t.join();
+	threads.clear();
+	for (auto const& g : built)
+		assert(lug::parse("1 23 456", g) && !lug::parse("1 2x", g));
+
+	rule Expr;
+	rule Number = lexeme[ +Digit ] < [](environment& e, csyntax& x) { e.push_attribute(std::stol(std::string{x.capture()})); };
+	rule Word = lexeme[ +alpha ];
+	rule Value = Number | "("_sx > Expr > ")";
+	Expr = Expr[1] > "+" > Expr[2] < [](environment& e) { auto r = e.pop_attribute<long>(); e.push_attribute(e.pop_attribute<long>() + r); }
+	     | Value;
+	struct sum_environment : environment { long total = 0; };
+	grammar const G = start(*(memoize[Word] | Expr < [](environment& e) { static_cast<sum_environment&>(e).total += e.pop_attribute<long>(); }) > eoi);
+	std::string text;
+	long expected = 0;
+	for (int i = 1; i <= 300; ++i)
+		text.append(i % 5 == 0 ? "word " : "(1 + ").append(std::to_string(i)).append(i % 5 == 0 ? " " : ") "), expected += i % 5 == 0 ? i : i + 1;
+	long totals[8] = {};
+	for (auto& total : totals) {
+		threads.emplace_back([&G, &text, &total] {
+			sum_environment E;
+			lug::parser p{G, E};
+			for (int n = 0; n < 20; ++n) {
+				E.total = 0;
+				assert(p.reset().bind(text).parse());
+			}
+			total = E.total;
+		});
+	}
+	for (auto& t : threads)
+		t.join();
+	for (long total : totals)
+		assert(total == expected);
+}
+
+void test_batch_parsing()
+{
+	using namespace lug::language;
+	struct record_environment : environment { long sum = 0; };
+	rule Number = lexeme[ +digit ] < [](environment& e, csyntax& x) { static_cast<record_environment&>(e).sum += std::stol(std::string{x.capture()}); };
+	grammar const G = start("{"_sx > Number > *("," > Number) > "}" > eoi);
+	std::string text;
+	std::vector<long> expected;
+	for (int i = 0; i < 500; ++i) {
+		text.append("{").append(std::to_string(i));
+		for (int j = 1; j <= i % 7; ++j)
+			text.append(", ").append(std::to_string(i * j));
+		text.append(i % 50 == 49 ? "]\n" : "}\n");
+		expected.push_back(i % 50 == 49 ? -1 : i * (1 + (i % 7) * (i % 7 + 1) / 2));
+	}
+	auto const records = lug::split_records(text);
+	assert(records.size() == 500 && lug::split_records("a\n\nb", '\n').size() == 3);
+
+	lug::batch_parser<record_environment> batch{G, 4};
+	assert(batch.concurrency() == 4);
+	for (int n = 0; n < 3; ++n) {
+		auto const sums = batch.parse(records, [](record_environment& e, lug::parser const&, bool parsed) { return parsed ? std::exchange(e.sum, 0) : (e.sum = 0, -1L); });
+		assert(sums == expected);
+	}
+
+	auto const parsed = lug::parse_batch<record_environment>(records, G, 3);
+	assert(parsed.size() == 500 && parsed[0] && !parsed[49] && parsed[50] && !parsed[499]);
+	std::vector<std::string> const owned{"{1}", "{1,}", "{2, 3}"};
+	auto const lengths = lug::parse_batch<record_environment>(owned, G, [](record_environment&, lug::parser const& p, bool ok) { return ok ? p.match().size() : p.max_subject_index(); });
+	assert((lengths == std::vector<std::size_t>{3, 3, 6}));
+	assert(lug::parse_batch<record_environment>(std::vector<std::string_view>{}, G).empty());
+}
+
+void test_grammar_image()
+{
+	using namespace lug::language;
+	long sum = 0;
+	rule Expr;
+	rule Number = lexeme[ +"[0-9]"_rx ] < [&sum](csyntax& x) { sum += std::stol(std::string{x.capture()}); };
+	rule Keyword = lexeme[ ("select"_isx | "from"_isx | u8"\u00E9t\u00E9"_isx) > !alnum ];
+	Expr = Expr[1] > "+" > Expr[2] | Number | Keyword | "(" > Expr > ")";
+	grammar const G = start(*Expr > eoi);
+	auto const image = lug::save_grammar(G);
+	assert(lug::grammar_image_hash(image) == lug::grammar_image_hash(lug::save_grammar(G)));
+
+	auto const& p = G.program();
+	grammar const H = lug::load_grammar(image, {p.predicates, p.actions, p.captures});
+	assert(lug::save_grammar(H) == image);
+	assert(H.program().instructions.size() == p.instructions.size() && H.program().runesets == p.runesets);
+	assert(H.optimizer_report().literal_tries == G.optimizer_report().literal_tries);
+	for (auto const text : {"1 + (2 + 30) SELECT", u8"FROM 7 \u00C9T\u00C9", "(4 + selection)"}) {
+		sum = 0;
+		bool const expected = lug::parse(text, G);
+		auto const expected_sum = sum;
+		assert(expected == (expected_sum > 0));
+		sum = 0;
+		assert(lug::parse(text, H) == expected && sum == expected_sum);
+	}
+
+	bool rejected = false;
+	try { lug::load_grammar(image); } catch (lug::bad_grammar_image const&) { rejected = true; }
+	assert(rejected);
+	for (std::size_t i : {std::size_t{0}, std::size_t{7}, image.size() / 2, image.size() - 1}) {
+		auto corrupt = image;
+		corrupt[i] = static_cast<char>(corrupt[i] ^ 0x20);
+		rejected = false;
+		try { lug::load_grammar(corrupt, {p.predicates, p.actions, p.captures}); } catch (lug::bad_grammar_image const&) { rejected = true; }
+		assert(rejected);
+	}
+	rejected = false;
+	try { lug::load_grammar(std::string_view{image}.substr(0, 12)); } catch (lug::bad_grammar_image const&) { rejected = true; }
+	assert(rejected);
+
+	rule A = noskip[ +chr('a') ];
+	grammar const T = start(A > eoi);
+	auto const small = lug::save_grammar(T);
+	auto const tail = small.rfind(std::string_view{"\x0e\x00\x00", 3});
+	assert(T.program().instructions.back().pf.op == lug::opcode::ret && tail != std::string::npos);
+	assert(lug::parse("aa", lug::load_grammar(small)));
+	for (char op : {static_cast<char>(lug::opcode::match_casefold), static_cast<char>(lug::opcode::jump_table), '\xff'}) {
+		auto mutated = small;
+		mutated[tail] = op;
+		auto hash = lug::detail::image_fnv1a(std::string_view{mutated}.substr(lug::detail::image_header_size));
+		for (std::size_t i = 8; i < 16; ++i, hash >>= 8)
+			mutated[i] = static_cast<char>(hash & 0xff);
+		assert(lug::grammar_image_hash(mutated) != lug::grammar_image_hash(small));
+		rejected = false;
+		try { lug::load_grammar(mutated); } catch (lug::bad_grammar_image const&) { rejected = true; }
+		assert(rejected);
+	}
 }
 
 int main()
 {
 	try {
 		test_line_column_tracking();
+		test_memoization();
+		test_zero_copy_input();
+#ifndef _MSC_VER
+		test_posix_mapped_file();
+#endif
+		test_streaming_input_limit();
+		test_istream_sources();
+#ifndef _MSC_VER
+		test_posix_fd_source();
+#endif
+		test_program_optimization();
+		test_literal_alternation();
+		test_parser_reuse();
+		test_deferred_cut();
+		test_typed_attributes();
+		test_streaming_dispatch();
+		test_push_parsing();
+		test_concurrent_parsing();
+		test_batch_parsing();
+		test_grammar_image();
 	} catch (std::exception& e) {
 		std::cerr << "Error: " << e.what() << std::endl;
 		return -1;
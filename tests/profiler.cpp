@@ -0,0 +1,68 @@
+// lug - Embedded DSL for PE grammar parser combinators in C++
+// Copyright (c) 2017 Jesse W. Towner
+// See LICENSE.md file for license details
+
+#define LUG_ENABLE_PROFILER
+#include <lug/lug.hpp>
+#include <cassert>
+#include <numeric>
+
+lug::rule_profile const& find_rule(lug::parser_profile const& p, lug::rule const& r)
+{
+	auto const i = std::find_if(p.rules.begin(), p.rules.end(), [&r](auto const& x) { return x.rule == std::addressof(r); });
+	assert(i != p.rules.end());
+	return *i;
+}
+
+void test_rule_profile()
+{
+	using namespace lug::language;
+	rule Number = lexeme[ +digit ] < []{};
+	rule Word = lexeme[ +alpha ] < []{};
+	rule Item = Number | Word;
+	grammar G = start(*Item > eoi);
+
+	lug::environment E;
+	lug::parser p{G, E};
+	assert(p.bind("abc 12 de 345").parse());
+	auto const& profile = p.profile();
+	assert(std::accumulate(profile.instructions.begin(), profile.instructions.end(), std::size_t{0}) == p.instruction_count());
+	assert(profile.instructions[static_cast<std::size_t>(lug::opcode::accept_final)] == 1);
+	auto const& number = find_rule(profile, Number);
+	auto const& word = find_rule(profile, Word);
+	auto const& item = find_rule(profile, Item);
+	assert(item.calls == 5 && item.backtracks == 1 && item.bytes_consumed == 10);
+	assert(number.calls >= 2 && number.bytes_consumed == 5);
+	assert(word.calls >= 2 && word.backtracks >= 1 && word.bytes_consumed == 5);
+	assert(profile.max_input_size == 13 && profile.max_stack_frames >= 3 && profile.max_responses == 4);
+
+	p.reset();
+	assert(p.profile().rules.empty() && p.instruction_count() == 0);
+}
+
+void test_left_recursion_profile()
+{
+	using namespace lug::language;
+	rule N = lexeme[ +digit ] < []{};
+	rule S = S > "+" > N | N;
+	grammar G = start(S > eoi);
+
+	lug::environment E;
+	lug::parser p{G, E};
+	assert(p.bind("1 + 2 + 3").parse());
+	auto const& s = find_rule(p.profile(), S);
+	assert(s.regrowths == 2 && s.bytes_consumed == 9);
+	assert(find_rule(p.profile(), N).calls >= 3 && p.profile().max_lrmemo_frames == 1);
+}
+
+int main()
+{
+	try {
+		test_rule_profile();
+		test_left_recursion_profile();
+	} catch (std::exception& e) {
+		std::cerr << "Error: " << e.what() << std::endl;
+		return -1;
+	}
+	return 0;
+}
@@ -84,6 +84,27 @@ void test_string()
 	assert(!lug::parse("", G));
 }
 
+void test_caseless_string()
+{
+	using namespace lug::language;
+	rule S1 = noskip[ "Hello World"_isx > eoi ];
+	grammar G1 = start(S1);
+	assert(lug::parse("hello world", G1));
+	assert(lug::parse("HELLO WORLD", G1));
+	assert(lug::parse("hElLo wOrLd", G1));
+	assert(!lug::parse("hello worl", G1));
+	assert(!lug::parse("hello world!", G1));
+	assert(!lug::parse("hello_world", G1));
+	assert(!lug::parse("", G1));
+
+	rule S2 = noskip[ u8"Stra\u00DFe \u03A9mega \u2C65x"_isx > eoi ];
+	grammar G2 = start(S2);
+	assert(lug::parse(u8"STRA\u00DFE \u03C9MEGA \u2C65X", G2));
+	assert(lug::parse(u8"stra\u00DFe \u03A9mega \u023Ax", G2));
+	assert(!lug::parse(u8"strasse \u03C9mega \u2C65x", G2));
+	assert(!lug::parse(u8"stra\u00DFe \u03C9mega \u2C65", G2));
+}
+
 void test_regular_expression()
 {
 	using namespace lug::language;
@@ -97,6 +118,119 @@ void test_regular_expression()
 	assert(!lug::parse("", G));
 }
 
+void test_bracket_expression()
+{
+	using namespace lug::language;
+	rule S1 = noskip[ +bre(u8"[a-z\u00E0-\u00FF\u0100-\u017F]") > eoi ];
+	grammar G1 = start(S1);
+	assert(lug::parse("abc", G1));
+	assert(lug::parse(u8"\u00E9t\u00E9", G1));
+	assert(lug::parse(u8"\u00FF\u0100\u017F", G1));
+	assert(!lug::parse("", G1));
+	assert(!lug::parse("aBc", G1));
+	assert(!lug::parse(u8"\u00C9t\u00E9", G1));
+	assert(!lug::parse(u8"a\u0180", G1));
+	assert(!lug::parse("a\xff", G1));
+
+	rule S2 = noskip[ *bre("[^\"\\\\]") > eoi ];
+	grammar G2 = start(S2);
+	assert(lug::parse("", G2));
+	assert(lug::parse(u8"plain \u00E9\u4E2D text", G2));
+	assert(!lug::parse("quote\"", G2));
+	assert(!lug::parse("back\\slash", G2));
+}
+
+void test_utf8_text()
+{
+	std::string_view const text{u8"plain ascii text, \u00E9t\u00E9 \u4E2D\u6587 \U0001F600!"};
+	assert(lug::utf8::is_valid(text));
+	assert(lug::utf8::skip_ascii(text) == 18);
+	assert(lug::utf8::count_runes(text) == lug::utf8::count_runes(text.begin(), text.end()));
+	assert(lug::utf8::count_runes(text) == 27);
+	assert(lug::utf8::valid_prefix("ab\xC3") == 2);
+	assert(lug::utf8::valid_prefix("abc\xC0\x80") == 3);
+	assert(lug::utf8::valid_prefix("\xED\xA0\x80") == 0);
+	assert(!lug::utf8::is_valid("abcdefghijklmnopqrstuvwxyz\x80"));
+	assert(lug::utf8::decode_valid_rune(text.begin() + 18).second == U'\u00E9');
+	assert(lug::utf8::toupper(u8"strada \u00E9t\u00E9") == u8"STRADA \u00C9T\u00C9");
+	assert(lug::utf8::tocasefold("Hello World") == "hello world");
+
+	using namespace lug::language;
+	rule S = noskip[ *any > eoi ];
+	grammar G = start(S);
+	lug::environment E;
+	lug::parser p{G, E};
+	assert(p.bind("ab\xE4\x41\xC3\xA9").parse());
+	assert(p.match().size() == 6);
+}
+
+void test_latin1_properties()
+{
+	using namespace lug::unicode;
+	assert(query(U'a').any_of(ctype::alpha) && query(U'7').any_of(ctype::digit) && query(U'\t').any_of(ctype::space));
+	assert(query(U'\u00E9').all_of(ctype::alpha) && query(U'\u00E9').any_of(ctype::lower) && query(U'\u00A0').any_of(ptype::White_Space));
+	assert(query(U'\u00D7').general_category() == gctype::Sm && query(U'\u00D7').general_category() == query(U'\u2200').general_category());
+	assert(tocasefold(U'\u00C0') == U'\u00E0' && toupper(U'\u00FF') == U'\u0178' && cwidth(U'\u00AD') == query(U'\u00AD').cwidth());
+	assert(query(U'\u00FF').script() == query(U'\u0100').script() && tolower(U'\u0100') == U'\u0101');
+}
+
+void test_unicode_records()
+{
+	using namespace lug::unicode;
+	assert(query(U'\u025B').script() == query(U'a').script() && cwidth(U'\u0243') == 1 && tocasefold(U'\u0243') == U'\u0180');
+	assert(tocasefold(U'\u109A') == U'\u109A' && query(U'\u109A').script() == query(U'\u1000').script());
+	assert(query(U'\u4E00').any_of(ctype::alpha) && query(U'\U0010FFFF').none_of(ctype::alpha));
+}
+
+void test_octets()
+{
+	using namespace lug::language;
+	rule S1 = noskip[ bytes[ any > any ] > eoi ];
+	grammar G1 = start(S1);
+	assert(lug::parse(u8"\u00E9", G1));
+	assert(lug::parse("\xFF\xFE", G1));
+	assert(!lug::parse("a", G1));
+
+	rule S2 = noskip[ bytes[ +chr(0x80, 0xFF) > "Get"_isx > +alpha > +digit > eol ] > eoi ];
+	grammar G2 = start(S2);
+	assert(lug::parse("\x80\xFF\xC3gEtab\xE9" "12\r\n", G2));
+	assert(lug::parse("\xC3GETz7\x85", G2));
+	assert(!lug::parse(u8"\xC3GETz\u00E97\n", G2));
+	assert(G2.optimizer_report().folded_spans > 0);
+
+	auto const Dot = "."_rx;
+	grammar G3 = start(noskip[ bytes[ Dot > Dot ] > eoi ]);
+	grammar G4 = start(noskip[ Dot > eoi ]);
+	assert(lug::parse(u8"\u00E9", G3) && lug::parse(u8"\u00E9", G4));
+	auto const Any = "."_rx;
+	grammar G5 = start(noskip[ Any > eoi ]);
+	grammar G6 = start(noskip[ bytes[ Any > Any ] > eoi ]);
+	assert(lug::parse(u8"\u00E9", G5) && lug::parse(u8"\u00E9", G6));
+
+	bool threw = false;
+	try { rule R = bytes[ chr(0x100) ]; } catch (lug::bad_octet_range const&) { threw = true; }
+	assert(threw);
+}
+
+void test_octet_fields()
+{
+	using namespace lug::language;
+	std::vector<std::string> fields;
+	auto const field = [&fields](csyntax& x) { fields.emplace_back(x.capture()); };
+	rule S = noskip[ (octets(3) < field) > (prefixed(2) < field) > (prefixed_le(4) < field) ] > eoi;
+	grammar G = start(S);
+	std::string const message{"abc\x00\x02xy\x01\x00\x00\x00z", 12};
+	lug::environment E;
+	assert(lug::parse(message.begin(), message.end(), G, E));
+	assert((fields == std::vector<std::string>{"abc", std::string{"\x00\x02xy", 4}, std::string{"\x01\x00\x00\x00z", 5}}));
+	assert(!lug::parse(message.begin(), message.end() - 1, G));
+	assert(!lug::parse("abc\x01", G));
+
+	bool threw = false;
+	try { rule R = prefixed(9); } catch (lug::bad_field_width const&) { threw = true; }
+	assert(threw);
+}
+
 int main()
 {
 	try {
@@ -105,7 +239,14 @@ int main()
 		test_char();
 		test_char_range();
 		test_string();
+		test_caseless_string();
 		test_regular_expression();
+		test_bracket_expression();
+		test_utf8_text();
+		test_latin1_properties();
+		test_unicode_records();
+		test_octets();
+		test_octet_fields();
 	} catch (std::exception& e) {
 		std::cerr << "Error: " << e.what() << std::endl;
 		return -1;
@@ -860,7 +860,7 @@ auto run_length_encode(std::vector<T> const& input, ucd_type_info const& info)
 				T seqlen = (std::min)(static_cast<T>(count - 1), maxseqlen);
 				pass1.insert(std::end(pass1), {static_cast<T>(seqmask | seqlen), value});
 				count -= seqlen + 1;
-			} while (count > maxseqlen);
+			} while (count > 0);
 		} else {
 			pass1.push_back(value);
 		}
@@ -1088,7 +1088,43 @@ public:
 	}
 };
 
-void print_unicode_header()
+class raw_record_table_printer
+{
+	std::string_view name_;
+	std::vector<std::size_t> indices_;
+	ucd_flyweight_compressed_records const& records_;
+
+public:
+	raw_record_table_printer(std::string_view name, std::vector<std::size_t> indices, ucd_flyweight_compressed_records const& records)
+		: name_{name}, indices_{std::move(indices)}, records_{records} {}
+
+	friend std::ostream& operator<<(std::ostream& out, raw_record_table_printer const& p) {
+		out << "\tstatic constexpr std::array<raw_record, " << std::dec << p.indices_.size() << "> " << p.name_ << " =\n\t{ {\n\t\t";
+		std::size_t linelen = 0;
+		for (auto first = p.indices_.begin(), last = p.indices_.end(); first != last; ++first) {
+			auto const i = *first;
+			auto const& record = recordvalues[i];
+			auto const segment = "{ UINT64_C(" + std::to_string(record.pflags) + "), " + std::to_string(record.cflags) + ", " +
+				std::to_string(record.abfields) + ", " + std::to_string(record.gcindex) + ", " + std::to_string(record.scindex) + ", " +
+				std::to_string(record.wfields) + ", " + std::to_string(p.records_.cfindices[i]) + ", " +
+				std::to_string(p.records_.clindices[i]) + ", " + std::to_string(p.records_.cuindices[i]) + " }";
+			out << segment;
+			if (first != last - 1)
+				out << ',' << ((linelen += segment.size() + 2) > 120 ? linelen = 0, "\n\t\t" : " ");
+		}
+		return out << "\n\t} };\n";
+	}
+};
+
+std::vector<std::size_t> record_indices(std::size_t first, std::size_t last, bool mapped)
+{
+	std::vector<std::size_t> indices;
+	for (std::size_t r = first; r < last; ++r)
+		indices.push_back(mapped ? recordtable[r] : r);
+	return indices;
+}
+
+void print_unicode_header(bool expanded)
 {
 double log2_block_size = std::ceil(std::log2(static_cast<double>(recordstagetable.block_size)));
 std::size_t const block_shift = static_cast<std::size_t>(std::lrint(log2_block_size));
@@ -1224,14 +1260,25 @@ class record
 		std::uint_least8_t clindex;
 		std::uint_least8_t cuindex;
 	} const* raw_;
-	explicit record(raw_record const* r) noexcept : raw_(r) {}
-	struct raw_record_table {)c++"
-		<< "\n\t\tstd::array<" << recordstagetable.typeinfo1.name << ", " << std::dec << recordstagetable.stage1.size() << "> stage1;\n"
+	explicit record(raw_record const* r) noexcept : raw_(r) {})c++";
+
+if (expanded) {
+	std::cout << R"c++(
+	static std::int_least32_t case_mapping(std::size_t index) noexcept;
+	static raw_record const* latin1_record(char32_t r) noexcept;
+	static raw_record const* table_record(char32_t r) noexcept;)c++";
+} else {
+	std::cout << "\n\tstruct raw_record_table {\n"
+		<< "\t\tstd::array<" << recordstagetable.typeinfo1.name << ", " << std::dec << recordstagetable.stage1.size() << "> stage1;\n"
 		<< "\t\tstd::array<" << recordstagetable.typeinfo2.name << ", " << std::dec << recordstagetable.stage2.size() << "> stage2;\n"
 		<< "\t\tstd::array<raw_record, " << std::dec << recordvalues.size() << "> records;" << R"c++(
 	};
 	static std::int_least32_t case_mapping(std::size_t index) noexcept;
-	static std::unique_ptr<raw_record_table> decompress_table();
+	static raw_record const* latin1_record(char32_t r) noexcept;
+	static std::unique_ptr<raw_record_table> decompress_table();)c++";
+}
+
+std::cout << R"c++(
 	friend record query(char32_t r);
 public:
 	ctype compatibility() const noexcept { return static_cast<ctype>(raw_->cflags); }
@@ -1259,13 +1306,24 @@ public:
 // Retrieves the UCD record for the given codepoint
 inline record query(char32_t r)
 {
+	if (r < 0x100)
+		return record{record::latin1_record(r)};)c++";
+
+if (expanded) {
+	std::cout << R"c++(
+	return record{record::table_record(r)};)c++";
+} else {
+	std::cout << R"c++(
 	static auto const table = record::decompress_table();
 	std::size_t index = )c++" << std::dec << invalidrecordindex << R"c++(;
 	if (r < 0x)c++" << std::hex << ptable.size() << R"c++() {
 		index = table->stage1[r >> )c++" << std::dec << block_shift << R"c++(];
 		index = table->stage2[(index << )c++" << std::dec << block_shift << R"c++() | (r & 0x)c++" << std::hex << block_mask << R"c++()];
 	}
-	return record{table->records.data() + index};
+	return record{table->records.data() + index};)c++";
+}
+
+std::cout << R"c++(
 }
 
 // Checks if the rune matches all of the string-packed property classes
@@ -1540,6 +1598,40 @@ inline std::int_least32_t record::case_mapping(std::size_t index) noexcept
 	return casemappings[index];
 }
 
+inline record::raw_record const* record::latin1_record(char32_t r) noexcept
+{
+)c++"
+<< raw_record_table_printer("latin1records", record_indices(0, 0x100, true), compressedrecords)
+<< R"c++(
+	return &latin1records[r];
+}
+)c++";
+
+if (expanded) {
+	std::cout << R"c++(
+inline record::raw_record const* record::table_record(char32_t r) noexcept
+{
+)c++"
+<< function_table_printer<decltype(recordstagetable.stage1)>("stage1", recordstagetable.typeinfo1.name, recordstagetable.stage1) << "\n"
+<< function_table_printer<decltype(recordstagetable.stage2)>("stage2", recordstagetable.typeinfo2.name, recordstagetable.stage2) << "\n"
+<< raw_record_table_printer("records", record_indices(0, recordvalues.size(), false), compressedrecords)
+<< R"c++(
+	std::size_t index = )c++" << std::dec << invalidrecordindex << R"c++(;
+	if (r < 0x)c++" << std::hex << ptable.size() << R"c++() {
+		index = stage1[r >> )c++" << std::dec << block_shift << R"c++(];
+		index = stage2[(index << )c++" << std::dec << block_shift << R"c++() | (r & 0x)c++" << std::hex << block_mask << R"c++()];
+	}
+	return &records[index];
+}
+
+} // namespace lug::unicode
+
+#endif
+)c++";
+	return;
+}
+
+std::cout << R"c++(
 inline std::unique_ptr<record::raw_record_table> record::decompress_table()
 {
 	using detail::run_length_decode;
@@ -1591,13 +1683,20 @@ inline std::unique_ptr<record::raw_record_table> record::decompress_table()
 )c++";
 }
 
-int main(int, char**)
+int main(int argc, char** argv)
 {
 	try {
+		bool expanded = true;
+		for (int i = 1; i < argc; ++i) {
+			if (std::string_view{argv[i]} == "--rle")
+				expanded = false;
+			else if (std::string_view{argv[i]} != "--expanded")
+				throw std::invalid_argument{"usage: makeunicode [--expanded | --rle]"};
+		}
 		read_and_build_tables();
 		combine_records();
 		compress_records();
-		print_unicode_header();
+		print_unicode_header(expanded);
 	} catch (std::exception& e) {
 		std::cerr << "Error: " << e.what() << "\nExiting...\n" << std::flush;
 		return 1;